@@ -1,10 +1,17 @@
+import 'dart:async';
+import 'dart:collection';
 import 'dart:typed_data';
 import 'dart:math' as math;
 import 'package:opencv_dart/opencv_dart.dart' as cv;
 import 'types.dart';
 import 'image_utils.dart';
+import 'mat_arena.dart';
 import 'palm_detector.dart';
 import 'hand_landmark_model.dart';
+import 'hand_detector_isolate.dart';
+import 'landmark_smoother.dart';
+import 'native_kernels.dart';
+import 'native_pipeline.dart';
 
 /// Helper class to store preprocessing data for each detected palm.
 ///
@@ -14,9 +21,13 @@ class _HandCropData {
   /// The original palm detection result.
   final PalmDetection palm;
 
-  /// The cropped and rotated hand image for landmark extraction.
+  /// The cropped and rotated hand image for landmark extraction, held in a
+  /// [MatArena] crop slot. Warped straight to the landmark input size.
   final cv.Mat croppedHand;
 
+  /// Source pixels per [croppedHand] pixel.
+  final double cropScale;
+
   /// Rotation angle in radians.
   final double rotation;
 
@@ -32,18 +43,49 @@ class _HandCropData {
   _HandCropData({
     required this.palm,
     required this.croppedHand,
+    required this.cropScale,
     required this.rotation,
     required this.centerX,
     required this.centerY,
     required this.cropSize,
   });
 
-  /// Disposes the cv.Mat to free native memory.
-  void dispose() {
-    croppedHand.dispose();
+  /// Returns the crop's slot to [arena] for the next frame.
+  void release(MatArena arena) {
+    arena.releaseCrop(MatArena.slotOf(croppedHand)!);
   }
 }
 
+/// A JPEG decoded only as finely as detection needs, with the palms found
+/// on it and the size of the full-resolution image.
+typedef _ReducedImage = ({
+  cv.Mat image,
+  int width,
+  int height,
+  List<PalmDetection> palms,
+});
+
+/// The image one detection call runs on: a BGR Mat, or a YUV 4:2:0 frame
+/// staged for the native kernels.
+class _Frame {
+  final cv.Mat? bgr;
+  final NativeYuvFrame? yuv;
+  final int width;
+  final int height;
+
+  _Frame.bgr(cv.Mat image)
+      : bgr = image,
+        yuv = null,
+        width = image.cols,
+        height = image.rows;
+
+  _Frame.yuv(NativeYuvFrame frame)
+      : bgr = null,
+        yuv = frame,
+        width = frame.width,
+        height = frame.height;
+}
+
 /// On-device hand detection and landmark estimation using TensorFlow Lite.
 ///
 /// Implements a two-stage pipeline based on MediaPipe:
@@ -67,6 +109,13 @@ class HandDetector {
   late final PalmDetector _palm;
   late final HandLandmarkModelRunner _lm;
 
+  /// Crop, rotation matrix and letterbox buffers reused across frames by
+  /// both stages, so steady-state detection allocates no pixel buffers.
+  final MatArena _arena = MatArena();
+
+  /// Native copies of YUV frames for [detectOnYuv], one per call in flight.
+  final List<NativeYuvFrame> _yuvFrames = [];
+
   /// Detection mode controlling pipeline behavior.
   final HandMode mode;
 
@@ -82,12 +131,95 @@ class HandDetector {
   /// Minimum confidence score for landmark predictions (0.0 to 1.0).
   final double minLandmarkScore;
 
-  /// Number of TensorFlow Lite interpreter instances in the landmark model pool.
+  /// Number of TensorFlow Lite interpreter instances in each of the palm and
+  /// landmark model pools.
   final int interpreterPoolSize;
 
   /// Performance configuration for TensorFlow Lite inference.
   final PerformanceConfig performanceConfig;
 
+  /// Whether to run landmark extraction for all hands in a frame as one
+  /// batched inference instead of one call per hand.
+  ///
+  /// Adds a landmark interpreter whose input is allocated once for
+  /// [maxDetections] hands; frames with fewer hands pad the unused slots,
+  /// so each batched call costs a full [maxDetections] inference. Frames
+  /// with a single hand, and every hand when the model has a fixed batch of
+  /// 1 or a batched call fails, use the per-hand interpreters.
+  final bool batchLandmarks;
+
+  /// Whether to run the whole pipeline in the native `libhand_pipeline`
+  /// library (Linux only). Falls back to the Dart pipeline when unavailable.
+  final bool useNativePipeline;
+
+  /// Whether to track hands across consecutive [detectOnMat] calls, deriving
+  /// each hand's next crop from its landmarks instead of re-running palm
+  /// detection (video mode). Only applies to [HandMode.boxesAndLandmarks] on
+  /// the Dart pipeline.
+  final bool trackHands;
+
+  /// With [trackHands], palm detection runs at least once every this many
+  /// frames to pick up hands entering the scene. 0 disables the periodic
+  /// refresh, so palm detection only runs when a tracked hand is lost.
+  final int palmRefreshInterval;
+
+  /// Palm detection model file to load instead of the bundled one, e.g. a
+  /// uint8/int8 quantized variant. Null uses the bundled model.
+  final String? palmModelPath;
+
+  /// Landmark model file to load instead of the bundled [landmarkModel],
+  /// e.g. a uint8/int8 quantized variant. Null uses the bundled model.
+  final String? landmarkModelPath;
+
+  /// Tiled palm detection for high-resolution images, or null to detect
+  /// palms on the whole image only. See [PalmTiling].
+  final PalmTiling? palmTiling;
+
+  /// Whether to record a [DetectionStats] stage timing breakdown for each
+  /// detection call, available from [lastStats].
+  final bool collectStats;
+
+  /// Temporal smoothing of the landmarks of consecutive frames, or null for
+  /// none. See [LandmarkSmoothing].
+  final LandmarkSmoothing? landmarkSmoothing;
+
+  /// Whether [detect] and [detectPacked] decode JPEGs at a reduced size
+  /// (`IMREAD_REDUCED_COLOR_2/4/8`, scaled in the DCT domain) that is still
+  /// large enough for palm detection, and only decodes a finer level when a
+  /// detected hand needs it. Applies to the Dart pipeline without
+  /// [trackHands].
+  final bool reducedDecode;
+
+  /// Whether to run the whole pipeline (decode, both models and all pre- and
+  /// post-processing) on a dedicated worker isolate that owns the
+  /// interpreters, instead of hopping to an interpreter isolate once for
+  /// palms and once per landmark call. Each call then sends the encoded
+  /// image over once, or only the native address of a Mat, which the
+  /// worker reads in place, and receives a [PackedHands] back. Ignored when
+  /// the native pipeline is in use.
+  final bool useWorkerIsolate;
+
+  /// Set on the worker isolate's own detector: interpreters run inline.
+  bool _inlineInference = false;
+
+  /// Worker isolate, set when [useWorkerIsolate] is enabled.
+  HandDetectorIsolate? _worker;
+
+  /// Filter state of [landmarkSmoothing], null when smoothing is off.
+  final LandmarkSmoother? _smoother;
+
+  /// Native pipeline, set when [useNativePipeline] is enabled and available.
+  NativeHandPipeline? _nativePipeline;
+
+  /// Tracking state: crops for the next frame, the frame size they are
+  /// normalized to, and frames processed since the last palm detection.
+  List<PalmDetection> _trackedPalms = const [];
+  int _trackedWidth = 0;
+  int _trackedHeight = 0;
+  int _framesSincePalmDetection = 0;
+
+  DetectionStats? _lastStats;
+
   bool _isInitialized = false;
 
   /// Creates a hand detector with the specified configuration.
@@ -98,8 +230,18 @@ class HandDetector {
   /// - [detectorConf]: Palm detection confidence threshold (0.0-1.0). Default: 0.6
   /// - [maxDetections]: Maximum number of hands to detect. Default: 10
   /// - [minLandmarkScore]: Minimum landmark confidence score (0.0-1.0). Default: 0.5
-  /// - [interpreterPoolSize]: Number of landmark model interpreter instances (1-10). Default: 1
+  /// - [interpreterPoolSize]: Number of palm and landmark model interpreter instances each (1-10), for overlapping calls. Default: 1
   /// - [performanceConfig]: TensorFlow Lite performance configuration. Default: no acceleration
+  /// - [batchLandmarks]: Run all hands of a frame through the landmark model in one batch. Default: false
+  /// - [useNativePipeline]: Run both stages in native code via FFI (Linux only). Default: false
+  /// - [trackHands]: Track hands from frame to frame using their landmarks (video mode). Default: false
+  /// - [palmRefreshInterval]: With [trackHands], maximum frames between palm detections. Default: 30
+  /// - [palmModelPath] / [landmarkModelPath]: Model files replacing the bundled models. Quantized (uint8/int8) models get 8-bit inputs and natively dequantized outputs. Default: bundled models
+  /// - [palmTiling]: Also detect palms on overlapping tiles, for small hands in high-resolution images. Default: null (whole image only)
+  /// - [collectStats]: Record a per-stage timing breakdown of each call in [lastStats]. Default: false
+  /// - [landmarkSmoothing]: Smooth landmarks over consecutive frames with a One Euro filter. Default: null (off)
+  /// - [reducedDecode]: Decode JPEGs in [detect] and [detectPacked] only at the resolution palm and landmark detection need. Default: false
+  /// - [useWorkerIsolate]: Run the full pipeline on one long-lived worker isolate, exchanging one message per call. Default: false
   HandDetector({
     this.mode = HandMode.boxesAndLandmarks,
     this.landmarkModel = HandLandmarkModel.full,
@@ -108,11 +250,35 @@ class HandDetector {
     this.minLandmarkScore = 0.5,
     int interpreterPoolSize = 1,
     this.performanceConfig = PerformanceConfig.disabled,
-  }) : interpreterPoolSize = performanceConfig.mode == PerformanceMode.disabled
-            ? interpreterPoolSize
-            : 1 {
-    _palm = PalmDetector(scoreThreshold: detectorConf);
-    _lm = HandLandmarkModelRunner(poolSize: this.interpreterPoolSize);
+    this.batchLandmarks = false,
+    this.useNativePipeline = false,
+    this.trackHands = false,
+    this.palmRefreshInterval = 30,
+    this.palmModelPath,
+    this.landmarkModelPath,
+    this.palmTiling,
+    this.collectStats = false,
+    this.landmarkSmoothing,
+    this.reducedDecode = false,
+    this.useWorkerIsolate = false,
+  })  : interpreterPoolSize =
+            performanceConfig.mode == PerformanceMode.disabled
+                ? interpreterPoolSize
+                : 1,
+        _smoother = landmarkSmoothing == null
+            ? null
+            : LandmarkSmoother(landmarkSmoothing) {
+    _palm = PalmDetector(
+      scoreThreshold: detectorConf,
+      tiling: palmTiling,
+      arena: _arena,
+      poolSize: this.interpreterPoolSize,
+    );
+    _lm = HandLandmarkModelRunner(
+      poolSize: this.interpreterPoolSize,
+      maxBatch: batchLandmarks ? maxDetections : 1,
+      arena: _arena,
+    );
   }
 
   /// Initializes the hand detector by loading TensorFlow Lite models.
@@ -124,26 +290,138 @@ class HandDetector {
       await dispose();
     }
 
+    if (useNativePipeline) {
+      _nativePipeline = NativeHandPipeline.create(
+        mode: mode,
+        detectorConf: detectorConf,
+        maxDetections: maxDetections,
+        minLandmarkScore: minLandmarkScore,
+        numThreads: performanceConfig.getEffectiveThreadCount(),
+        numWorkers: interpreterPoolSize,
+        palmModelPath: palmModelPath,
+        landmarkModelPath: landmarkModelPath,
+        palmTiling: palmTiling,
+      );
+      if (_nativePipeline != null) {
+        _isInitialized = true;
+        return;
+      }
+    }
+
+    if (useWorkerIsolate && !_inlineInference) {
+      _worker = await HandDetectorIsolate.spawn(_workerDetector(this));
+      _isInitialized = true;
+      return;
+    }
+
     // On desktop platforms the TensorFlow Lite C library must be loaded
     // into the process before creating any interpreters. This ensures the
     // native dylib/so is available for both palm and landmark models.
     await HandLandmarkModelRunner.ensureTFLiteLoaded();
 
-    await _palm.initialize(performanceConfig: performanceConfig);
-    await _lm.initialize(landmarkModel, performanceConfig: performanceConfig);
+    await _palm.initialize(
+      performanceConfig: performanceConfig,
+      modelPath: palmModelPath,
+      inlineInference: _inlineInference,
+    );
+    await _lm.initialize(
+      landmarkModel,
+      performanceConfig: performanceConfig,
+      modelPath: landmarkModelPath,
+      inlineInference: _inlineInference,
+    );
     _isInitialized = true;
   }
 
+  /// Returns a closure creating [detector]'s worker-side twin on the worker
+  /// isolate. It captures only the settings, so it can be sent there.
+  static HandDetector Function() _workerDetector(HandDetector detector) {
+    final mode = detector.mode;
+    final landmarkModel = detector.landmarkModel;
+    final detectorConf = detector.detectorConf;
+    final maxDetections = detector.maxDetections;
+    final minLandmarkScore = detector.minLandmarkScore;
+    final interpreterPoolSize = detector.interpreterPoolSize;
+    final performanceConfig = detector.performanceConfig;
+    final batchLandmarks = detector.batchLandmarks;
+    final trackHands = detector.trackHands;
+    final palmRefreshInterval = detector.palmRefreshInterval;
+    final palmModelPath = detector.palmModelPath;
+    final landmarkModelPath = detector.landmarkModelPath;
+    final palmTiling = detector.palmTiling;
+    final collectStats = detector.collectStats;
+    final landmarkSmoothing = detector.landmarkSmoothing;
+    final reducedDecode = detector.reducedDecode;
+    return () => HandDetector(
+          mode: mode,
+          landmarkModel: landmarkModel,
+          detectorConf: detectorConf,
+          maxDetections: maxDetections,
+          minLandmarkScore: minLandmarkScore,
+          interpreterPoolSize: interpreterPoolSize,
+          performanceConfig: performanceConfig,
+          batchLandmarks: batchLandmarks,
+          trackHands: trackHands,
+          palmRefreshInterval: palmRefreshInterval,
+          palmModelPath: palmModelPath,
+          landmarkModelPath: landmarkModelPath,
+          palmTiling: palmTiling,
+          collectStats: collectStats,
+          landmarkSmoothing: landmarkSmoothing,
+          reducedDecode: reducedDecode,
+        ).._inlineInference = true;
+  }
+
+  /// Awaits a call on the worker isolate, adding its stage times to
+  /// [stats].
+  static Future<PackedHands> _fromWorker(
+    Future<(PackedHands, DetectionStats?)> call,
+    DetectionStats? stats,
+  ) async {
+    final (packed, workerStats) = await call;
+    if (workerStats != null) stats?.add(workerStats);
+    return packed;
+  }
+
   /// Returns true if the detector has been initialized and is ready to use.
   bool get isInitialized => _isInitialized;
 
+  /// Stage timings of the most recent [detect], [detectOnYuv] or
+  /// [detectOnMat] call (including calls made by [detectStream]), or null
+  /// before the first call and unless [collectStats] is enabled.
+  ///
+  /// Use it to tell whether image decode, inference or interpreter
+  /// contention dominates on a given host.
+  DetectionStats? get lastStats => _lastStats;
+
   /// Releases all resources used by the detector.
   Future<void> dispose() async {
+    resetTracking();
+    _lastStats = null;
+    _nativePipeline?.dispose();
+    _nativePipeline = null;
+    await _worker?.close();
+    _worker = null;
     await _palm.dispose();
     await _lm.dispose();
+    _arena.dispose();
+    for (final frame in _yuvFrames) {
+      frame.dispose();
+    }
+    _yuvFrames.clear();
     _isInitialized = false;
   }
 
+  /// Drops all tracked hands, so the next [detectOnMat] call runs palm
+  /// detection and landmarks restart unsmoothed. Call this on scene cuts or
+  /// when switching video sources.
+  void resetTracking() {
+    _trackedPalms = const [];
+    _framesSincePalmDetection = 0;
+    _smoother?.reset();
+    _worker?.resetTracking();
+  }
+
   /// Detects hands in an image from raw bytes.
   ///
   /// Decodes the image bytes using OpenCV and performs hand detection.
@@ -160,16 +438,321 @@ class HandDetector {
       throw StateError(
           'HandDetector not initialized. Call initialize() first.');
     }
+    final stats = collectStats ? DetectionStats() : null;
+    final watch = Stopwatch()..start();
     try {
-      final mat = cv.imdecode(Uint8List.fromList(imageBytes), cv.IMREAD_COLOR);
+      final worker = _worker;
+      if (worker != null) {
+        final call = worker.detect(imageBytes, packed: false);
+        return (await _fromWorker(call, stats)).toHands();
+      }
+      final bytes = Uint8List.fromList(imageBytes);
+      if (reducedDecode && _nativePipeline == null && !trackHands) {
+        final size = ImageUtils.jpegSize(bytes);
+        if (size != null) return await _detectReduced(bytes, size, stats);
+      }
+      final mat = cv.imdecode(bytes, cv.IMREAD_COLOR);
+      stats?.decode = watch.elapsed;
       if (mat.isEmpty) return <Hand>[];
       try {
-        return await detectOnMat(mat);
+        return await _detectOnMat(mat, stats);
       } finally {
         mat.dispose();
       }
     } catch (e) {
       return <Hand>[];
+    } finally {
+      _recordStats(stats, watch);
+    }
+  }
+
+  /// Long side, in multiples of the palm input, that a reduced decode keeps
+  /// for palm detection (per tile with [palmTiling]).
+  static const int _palmDecodeScale = 2;
+
+  /// `imdecode` flags of the reduced decode levels, by scale factor.
+  static const Map<int, int> _reducedDecodeFlags = {
+    1: cv.IMREAD_COLOR,
+    2: cv.IMREAD_REDUCED_COLOR_2,
+    4: cv.IMREAD_REDUCED_COLOR_4,
+    8: cv.IMREAD_REDUCED_COLOR_8,
+  };
+
+  /// Largest reduced decode factor (8, 4, 2 or 1) that keeps [extent]
+  /// source pixels at least [minExtent] pixels long.
+  static int _reducedFactor(double extent, int minExtent) {
+    for (final factor in const [8, 4, 2]) {
+      if (extent / factor >= minExtent) return factor;
+    }
+    return 1;
+  }
+
+  /// [detect] for a JPEG whose header gives its [size], see [_decodeReduced].
+  /// Results are scaled to full-resolution pixels.
+  Future<List<Hand>> _detectReduced(
+    Uint8List bytes,
+    (int, int) size,
+    DetectionStats? stats,
+  ) async {
+    final reduced = await _decodeReduced(bytes, size, stats);
+    if (reduced == null) return <Hand>[];
+    final (:image, :width, :height, :palms) = reduced;
+    try {
+      if (mode == HandMode.boxes) {
+        final watch = Stopwatch()..start();
+        final hands = _palmsToHands(width, height, palms, []);
+        stats?.resultBuilding += watch.elapsed;
+        return hands;
+      }
+      final hands = await _detectLandmarks(_Frame.bgr(image), palms, stats);
+      return _smooth(_rescaleHands(hands, image, width, height));
+    } finally {
+      image.dispose();
+    }
+  }
+
+  /// [detectPacked] for a JPEG whose header gives its [size], like
+  /// [_detectReduced].
+  Future<PackedHands> _detectReducedPacked(
+    Uint8List bytes,
+    (int, int) size,
+    DetectionStats? stats,
+  ) async {
+    final reduced = await _decodeReduced(bytes, size, stats);
+    if (reduced == null) return _emptyPacked(0, 0);
+    final (:image, :width, :height, :palms) = reduced;
+    try {
+      if (mode == HandMode.boxes) {
+        final watch = Stopwatch()..start();
+        final packed = _packPalms(width, height, palms);
+        stats?.resultBuilding += watch.elapsed;
+        return packed;
+      }
+      final detected = await _detectLandmarksPacked(image, palms, stats);
+      final packed = _rescalePacked(detected, image, width, height);
+      _smoother?.smoothPacked(packed);
+      return packed;
+    } finally {
+      image.dispose();
+    }
+  }
+
+  /// Decodes a JPEG whose header gives its [size] only at the resolution
+  /// detection needs and detects its palms, or returns null when it does
+  /// not decode. The caller disposes the returned image.
+  ///
+  /// Palms are detected on the coarsest level that keeps the long side at
+  /// [_palmDecodeScale] palm inputs. Palm coordinates are normalized, so the
+  /// crops then come from the same image, or, when a hand's crop would be
+  /// smaller than the landmark input there, from a second decode at the
+  /// finest level any hand needs. OpenCV cannot decode part of a JPEG, so
+  /// the second decode covers the whole image, at a reduced level where
+  /// possible. [width] and [height] are those of the full-resolution image.
+  Future<_ReducedImage?> _decodeReduced(
+    Uint8List bytes,
+    (int, int) size,
+    DetectionStats? stats,
+  ) async {
+    final watch = Stopwatch()..start();
+    final tiles = palmTiling == null
+        ? 1
+        : math.max(palmTiling!.columns, palmTiling!.rows);
+    final palmFactor = _reducedFactor(
+      math.max(size.$1, size.$2).toDouble(),
+      _palmDecodeScale * PalmDetector.inputSize * tiles,
+    );
+    var image = cv.imdecode(bytes, _reducedDecodeFlags[palmFactor]!);
+    stats?.decode += watch.elapsed;
+    try {
+      if (image.isEmpty) {
+        image.dispose();
+        return null;
+      }
+      // imdecode applies EXIF orientation; the header size does not.
+      final rotated = (image.cols > image.rows && size.$1 < size.$2) ||
+          (image.cols < image.rows && size.$1 > size.$2);
+      final width = rotated ? size.$2 : size.$1;
+      final height = rotated ? size.$1 : size.$2;
+
+      final palms = await _palm.detectOnMat(image, stats: stats);
+      final limitedPalms = palms.length > maxDetections
+          ? palms.sublist(0, maxDetections)
+          : palms;
+
+      var factor = palmFactor;
+      if (mode == HandMode.boxesAndLandmarks) {
+        for (final palm in limitedPalms) {
+          factor = math.min(
+            factor,
+            _reducedFactor(palm.sqnRrSize * math.max(width, height),
+                HandLandmarkModelRunner.inputSize),
+          );
+        }
+      }
+      if (factor < palmFactor) {
+        watch.reset();
+        final finer = cv.imdecode(bytes, _reducedDecodeFlags[factor]!);
+        stats?.decode += watch.elapsed;
+        if (finer.isEmpty) {
+          finer.dispose();
+        } else {
+          image.dispose();
+          image = finer;
+        }
+      }
+      return (
+        image: image,
+        width: width,
+        height: height,
+        palms: limitedPalms,
+      );
+    } catch (_) {
+      image.dispose();
+      rethrow;
+    }
+  }
+
+  /// Scales [hands] detected on [image] to a [width] x [height] original.
+  static List<Hand> _rescaleHands(
+    List<Hand> hands,
+    cv.Mat image,
+    int width,
+    int height,
+  ) {
+    if (image.cols == width && image.rows == height) return hands;
+    final sx = width / image.cols;
+    final sy = height / image.rows;
+    final sizeScale =
+        math.max(width, height) / math.max(image.cols, image.rows);
+    return [
+      for (final hand in hands)
+        Hand(
+          boundingBox: BoundingBox(
+            left: (hand.boundingBox.left * sx).clamp(0, width.toDouble()),
+            top: (hand.boundingBox.top * sy).clamp(0, height.toDouble()),
+            right: (hand.boundingBox.right * sx).clamp(0, width.toDouble()),
+            bottom: (hand.boundingBox.bottom * sy).clamp(0, height.toDouble()),
+          ),
+          score: hand.score,
+          landmarks: [
+            for (final lm in hand.landmarks)
+              HandLandmark(
+                type: lm.type,
+                x: (lm.x * sx).clamp(0, width.toDouble()),
+                y: (lm.y * sy).clamp(0, height.toDouble()),
+                z: lm.z,
+                visibility: lm.visibility,
+              ),
+          ],
+          imageWidth: width,
+          imageHeight: height,
+          handedness: hand.handedness,
+          rotation: hand.rotation,
+          rotatedCenterX: hand.rotatedCenterX! * sx,
+          rotatedCenterY: hand.rotatedCenterY! * sy,
+          rotatedSize: hand.rotatedSize! * sizeScale,
+        ),
+    ];
+  }
+
+  /// Scales [packed] hands detected on [image] to a [width] x [height]
+  /// original, in place, like [_rescaleHands].
+  static PackedHands _rescalePacked(
+    PackedHands packed,
+    cv.Mat image,
+    int width,
+    int height,
+  ) {
+    if (image.cols == width && image.rows == height) return packed;
+    final sx = width / image.cols;
+    final sy = height / image.rows;
+    final sizeScale =
+        math.max(width, height) / math.max(image.cols, image.rows);
+    final w = width.toDouble();
+    final h = height.toDouble();
+    final data = packed.data;
+    for (int i = 0; i < packed.length; i++) {
+      final box = packed.boxesOffset + 4 * i;
+      data
+        ..[box] = (data[box] * sx).clamp(0, w)
+        ..[box + 1] = (data[box + 1] * sy).clamp(0, h)
+        ..[box + 2] = (data[box + 2] * sx).clamp(0, w)
+        ..[box + 3] = (data[box + 3] * sy).clamp(0, h);
+      final rot = packed.rotationsOffset + 4 * i;
+      data
+        ..[rot + 1] *= sx
+        ..[rot + 2] *= sy
+        ..[rot + 3] *= sizeScale;
+      if (!packed.hasLandmarks) continue;
+      final base = packed.landmarksOffset + PackedHands.landmarkFloats * i;
+      for (int j = 0; j < numHandLandmarks; j++) {
+        final k = base + j * 3;
+        data
+          ..[k] = (data[k] * sx).clamp(0, w)
+          ..[k + 1] = (data[k + 1] * sy).clamp(0, h);
+      }
+    }
+    return PackedHands(
+      data,
+      length: packed.length,
+      imageWidth: width,
+      imageHeight: height,
+      hasLandmarks: packed.hasLandmarks,
+    );
+  }
+
+  /// Detects hands in a YUV 4:2:0 camera frame (I420, NV12 or NV21).
+  ///
+  /// The Y and UV planes are sampled directly while building the palm and
+  /// landmark model inputs, so no full-resolution BGR image is ever
+  /// created: by the native pipeline ([useNativePipeline] on Linux), or
+  /// otherwise by the native letterbox and crop kernels. Only when those
+  /// kernels are not loaded, palm tiling is on, the palm model takes a
+  /// quantized input or [useWorkerIsolate] is set is the frame converted
+  /// to BGR with OpenCV and passed to [detectOnMat].
+  ///
+  /// Returns hands in frame pixel coordinates.
+  ///
+  /// Throws [StateError] if called before [initialize] and [ArgumentError]
+  /// if the frame planes do not match its size and strides.
+  Future<List<Hand>> detectOnYuv(YuvFrame frame) async {
+    if (!_isInitialized) {
+      throw StateError(
+          'HandDetector not initialized. Call initialize() first.');
+    }
+    frame.validate();
+
+    final stats = collectStats ? DetectionStats() : null;
+    final watch = Stopwatch()..start();
+    try {
+      final native = _nativePipeline;
+      if (native != null) return _smooth(native.detectYuv(frame));
+
+      if (_worker == null && _palm.canDetectOnYuv) {
+        final staged =
+            _yuvFrames.isEmpty ? NativeYuvFrame() : _yuvFrames.removeLast();
+        try {
+          staged.stage(frame);
+          stats?.decode = watch.elapsed;
+          return await _detectOnFrame(_Frame.yuv(staged), stats);
+        } finally {
+          if (_isInitialized) {
+            _yuvFrames.add(staged);
+          } else {
+            staged.dispose();
+          }
+        }
+      }
+
+      final bgr = ImageUtils.yuvToBgr(frame);
+      stats?.decode = watch.elapsed;
+      try {
+        return await _detectOnMat(bgr, stats);
+      } finally {
+        bgr.dispose();
+      }
+    } finally {
+      _recordStats(stats, watch);
     }
   }
 
@@ -189,6 +772,18 @@ class HandDetector {
   /// - 21 landmarks (if [mode] is [HandMode.boxesAndLandmarks])
   /// - Handedness (left or right)
   ///
+  /// With [trackHands], consecutive calls are treated as video frames: while
+  /// every tracked hand keeps a landmark score of at least [minLandmarkScore],
+  /// stage 1 is skipped and each hand is cropped from the rotated square
+  /// derived from its previous landmarks. Palm detection runs again on the
+  /// first frame, when a tracked hand is lost, and every
+  /// [palmRefreshInterval] frames. Tracked hands keep the palm score of the
+  /// detection that started the track.
+  ///
+  /// With [landmarkSmoothing], landmarks are filtered over consecutive
+  /// calls, and tracked crops are derived from the smoothed landmarks, which
+  /// keeps them steady from frame to frame.
+  ///
   /// Note: The caller is responsible for disposing the input Mat after use.
   ///
   /// Throws [StateError] if called before [initialize].
@@ -198,67 +793,658 @@ class HandDetector {
           'HandDetector not initialized. Call initialize() first.');
     }
 
+    final stats = collectStats ? DetectionStats() : null;
+    final watch = Stopwatch()..start();
+    try {
+      return await _detectOnMat(image, stats);
+    } finally {
+      _recordStats(stats, watch);
+    }
+  }
+
+  /// Detects hands in an image from raw bytes like [detect], returning the
+  /// frame's results as one [PackedHands] instead of [Hand] objects.
+  ///
+  /// Returns an empty frame if image decoding fails or no hands are
+  /// detected.
+  ///
+  /// Throws [StateError] if called before [initialize].
+  Future<PackedHands> detectPacked(List<int> imageBytes) async {
+    if (!_isInitialized) {
+      throw StateError(
+          'HandDetector not initialized. Call initialize() first.');
+    }
+    final stats = collectStats ? DetectionStats() : null;
+    final watch = Stopwatch()..start();
+    try {
+      final worker = _worker;
+      if (worker != null) {
+        return await _fromWorker(
+            worker.detect(imageBytes, packed: true), stats);
+      }
+      final bytes = Uint8List.fromList(imageBytes);
+      if (reducedDecode && _nativePipeline == null && !trackHands) {
+        final size = ImageUtils.jpegSize(bytes);
+        if (size != null) return await _detectReducedPacked(bytes, size, stats);
+      }
+      final mat = cv.imdecode(bytes, cv.IMREAD_COLOR);
+      stats?.decode = watch.elapsed;
+      if (mat.isEmpty) return _emptyPacked(0, 0);
+      try {
+        return await _detectPackedOnMat(mat, stats);
+      } finally {
+        mat.dispose();
+      }
+    } catch (e) {
+      return _emptyPacked(0, 0);
+    } finally {
+      _recordStats(stats, watch);
+    }
+  }
+
+  /// Detects hands in an OpenCV Mat like [detectOnMat], returning the
+  /// frame's results as one [PackedHands] instead of [Hand] objects.
+  ///
+  /// The landmark stage writes straight into the packed sections, so a
+  /// frame allocates one [Float32List] for its results rather than a
+  /// [BoundingBox] and 21 [HandLandmark]s per hand, twice over. Use this
+  /// at high frame rates or hand counts, where result objects dominate
+  /// garbage collection. With [trackHands], results are still built as
+  /// [Hand] objects to derive the next crops, then packed.
+  ///
+  /// Note: The caller is responsible for disposing the input Mat after use.
+  ///
+  /// Throws [StateError] if called before [initialize].
+  Future<PackedHands> detectOnMatPacked(cv.Mat image) async {
+    if (!_isInitialized) {
+      throw StateError(
+          'HandDetector not initialized. Call initialize() first.');
+    }
+
+    final stats = collectStats ? DetectionStats() : null;
+    final watch = Stopwatch()..start();
+    try {
+      return await _detectPackedOnMat(image, stats);
+    } finally {
+      _recordStats(stats, watch);
+    }
+  }
+
+  /// Finishes [stats] with the elapsed time of [watch] and publishes it as
+  /// [lastStats].
+  void _recordStats(DetectionStats? stats, Stopwatch watch) {
+    if (stats == null) return;
+    stats.total = watch.elapsed;
+    _lastStats = stats;
+  }
+
+  /// [detectOnMat] without the initialization check, recording stage
+  /// timings into [stats] when given.
+  Future<List<Hand>> _detectOnMat(cv.Mat image, DetectionStats? stats) async {
+    final worker = _worker;
+    if (worker != null) {
+      final call = worker.detectOnMat(image, packed: false);
+      return (await _fromWorker(call, stats)).toHands();
+    }
+
+    final native = _nativePipeline;
+    if (native != null) {
+      final continuous = image.isContinuous ? image : image.clone();
+      try {
+        return _smooth(native.detect(continuous.data, image.cols, image.rows));
+      } finally {
+        if (!identical(continuous, image)) continuous.dispose();
+      }
+    }
+
+    return _detectOnFrame(_Frame.bgr(image), stats);
+  }
+
+  /// The Dart two-stage pipeline of [detectOnMat] and [detectOnYuv] on
+  /// [frame], with tracking and smoothing.
+  Future<List<Hand>> _detectOnFrame(
+      _Frame frame, DetectionStats? stats) async {
+    final tracking = trackHands && mode == HandMode.boxesAndLandmarks;
+    if (tracking && _canReuseTracks(frame.width, frame.height)) {
+      final tracked = await _detectLandmarks(frame, _trackedPalms, stats);
+      if (tracked.length == _trackedPalms.length) {
+        _framesSincePalmDetection++;
+        return _updateTracks(frame.width, frame.height, _smooth(tracked));
+      }
+      // A tracked hand was lost; fall back to palm detection on this frame.
+    }
+
     // Stage 1: Detect palms
-    final List<PalmDetection> palms = await _palm.detectOnMat(image);
+    final yuv = frame.yuv;
+    final List<PalmDetection> palms = yuv != null
+        ? await _palm.detectOnYuv(yuv, stats: stats)
+        : await _palm.detectOnMat(frame.bgr!, stats: stats);
 
     // Limit detections
     final limitedPalms =
         palms.length > maxDetections ? palms.sublist(0, maxDetections) : palms;
 
     if (mode == HandMode.boxes) {
-      return _palmsToHands(image, limitedPalms, []);
+      final watch = Stopwatch()..start();
+      final hands =
+          _palmsToHands(frame.width, frame.height, limitedPalms, []);
+      stats?.resultBuilding += watch.elapsed;
+      return hands;
     }
 
     // Stage 2: Crop, rotate, and extract landmarks
+    final results =
+        _smooth(await _detectLandmarks(frame, limitedPalms, stats));
+    if (!tracking) return results;
+    _framesSincePalmDetection = 1;
+    return _updateTracks(frame.width, frame.height, results);
+  }
+
+  /// [detectOnMatPacked] without the initialization check.
+  Future<PackedHands> _detectPackedOnMat(
+    cv.Mat image,
+    DetectionStats? stats,
+  ) async {
+    final worker = _worker;
+    if (worker != null) {
+      return _fromWorker(worker.detectOnMat(image, packed: true), stats);
+    }
+
+    final native = _nativePipeline;
+    if (native != null) {
+      final continuous = image.isContinuous ? image : image.clone();
+      try {
+        final packed =
+            native.detectPacked(continuous.data, image.cols, image.rows);
+        _smoother?.smoothPacked(packed);
+        return packed;
+      } finally {
+        if (!identical(continuous, image)) continuous.dispose();
+      }
+    }
+
+    if (trackHands && mode == HandMode.boxesAndLandmarks) {
+      final hands = await _detectOnMat(image, stats);
+      return PackedHands.fromHands(
+        hands,
+        imageWidth: image.cols,
+        imageHeight: image.rows,
+        hasLandmarks: true,
+      );
+    }
+
+    final palms = await _palm.detectOnMat(image, stats: stats);
+    final limitedPalms =
+        palms.length > maxDetections ? palms.sublist(0, maxDetections) : palms;
+
+    if (mode == HandMode.boxes) {
+      final watch = Stopwatch()..start();
+      final packed = _packPalms(image.cols, image.rows, limitedPalms);
+      stats?.resultBuilding += watch.elapsed;
+      return packed;
+    }
+
+    final packed = await _detectLandmarksPacked(image, limitedPalms, stats);
+    _smoother?.smoothPacked(packed);
+    return packed;
+  }
+
+  /// Packs palm detections on a [width] x [height] image as boxes without
+  /// landmarks (boxes only mode), like [_palmsToHands].
+  PackedHands _packPalms(int width, int height, List<PalmDetection> palms) {
+    final packed = _emptyPacked(width, height, palms.length);
+    final longSide = math.max(width, height);
+    for (int i = 0; i < palms.length; i++) {
+      final palm = palms[i];
+      _packBox(
+        packed,
+        i,
+        width.toDouble(),
+        height.toDouble(),
+        palm.sqnRrCenterX * width,
+        palm.sqnRrCenterY * height,
+        palm.sqnRrSize * longSide,
+        palm,
+      );
+      packed.data[packed.handednessOffset + i] = double.nan;
+    }
+    return packed;
+  }
 
+  /// Applies [landmarkSmoothing] to a frame's final hands.
+  List<Hand> _smooth(List<Hand> hands) =>
+      _smoother?.smoothHands(hands) ?? hands;
+
+  /// A zeroed frame of [count] hands in this detector's [mode].
+  PackedHands _emptyPacked(int width, int height, [int count = 0]) {
+    return PackedHands.allocate(
+      count,
+      imageWidth: width,
+      imageHeight: height,
+      hasLandmarks: mode == HandMode.boxesAndLandmarks,
+    );
+  }
+
+  /// Runs detection over a stream of frames, emitting one result list per
+  /// processed frame, in order.
+  ///
+  /// Frames are processed one at a time with [detectOnMat]. Frames that
+  /// arrive while one is in flight wait in a queue whose size and overflow
+  /// behavior are set by [policy]:
+  /// - [FrameDropPolicy.latestOnly]: at most one pending frame, the newest.
+  /// - [FrameDropPolicy.boundedQueue]: up to [maxQueuedFrames], dropping the
+  ///   oldest.
+  /// - [FrameDropPolicy.blockProducer]: the input subscription is paused
+  ///   while [maxQueuedFrames] frames are pending; nothing is dropped.
+  ///
+  /// Each drop calls [onFrameDropped] with the total number of frames dropped
+  /// so far, so latency stays bounded under overload and the caller can see
+  /// what was skipped.
+  ///
+  /// The stream takes ownership of the input Mats: each is disposed once it
+  /// has been processed or dropped. Detection errors are forwarded as error
+  /// events and processing continues with the next frame. The output stream
+  /// closes after the input closes and all pending frames are processed;
+  /// cancelling it cancels the input subscription and disposes pending
+  /// frames.
+  ///
+  /// Combine with [trackHands] to skip palm detection on steady-state
+  /// frames.
+  Stream<List<Hand>> detectStream(
+    Stream<cv.Mat> frames, {
+    FrameDropPolicy policy = FrameDropPolicy.latestOnly,
+    int maxQueuedFrames = 2,
+    void Function(int droppedFrames)? onFrameDropped,
+  }) {
+    if (maxQueuedFrames < 1) {
+      throw ArgumentError.value(
+          maxQueuedFrames, 'maxQueuedFrames', 'must be at least 1');
+    }
+    final capacity =
+        policy == FrameDropPolicy.latestOnly ? 1 : maxQueuedFrames;
+    final pending = Queue<cv.Mat>();
+    late final StreamController<List<Hand>> controller;
+    StreamSubscription<cv.Mat>? input;
+    bool inputPaused = false;
+    bool inputDone = false;
+    bool processing = false;
+    bool cancelled = false;
+    int dropped = 0;
+
+    void disposePending() {
+      while (pending.isNotEmpty) {
+        pending.removeFirst().dispose();
+      }
+    }
+
+    Future<void> drain() async {
+      if (processing) return;
+      processing = true;
+      while (pending.isNotEmpty && !cancelled) {
+        final frame = pending.removeFirst();
+        if (inputPaused && pending.length < capacity) {
+          inputPaused = false;
+          input?.resume();
+        }
+        try {
+          final hands = await detectOnMat(frame);
+          if (!cancelled) controller.add(hands);
+        } catch (e, st) {
+          if (!cancelled) controller.addError(e, st);
+        } finally {
+          frame.dispose();
+        }
+      }
+      processing = false;
+      if (inputDone && !cancelled) await controller.close();
+    }
+
+    void onFrame(cv.Mat frame) {
+      if (pending.length >= capacity &&
+          policy != FrameDropPolicy.blockProducer) {
+        pending.removeFirst().dispose();
+        dropped++;
+        onFrameDropped?.call(dropped);
+      }
+      pending.add(frame);
+      if (policy == FrameDropPolicy.blockProducer &&
+          pending.length >= capacity &&
+          !inputPaused) {
+        inputPaused = true;
+        input?.pause();
+      }
+      unawaited(drain());
+    }
+
+    controller = StreamController<List<Hand>>(
+      onListen: () {
+        input = frames.listen(
+          onFrame,
+          onError: controller.addError,
+          onDone: () {
+            inputDone = true;
+            if (!processing) controller.close();
+          },
+        );
+      },
+      onCancel: () async {
+        cancelled = true;
+        disposePending();
+        await input?.cancel();
+      },
+    );
+    return controller.stream;
+  }
+
+  /// Whether the tracked crops can be used for a [width] x [height] frame
+  /// instead of running palm detection.
+  bool _canReuseTracks(int width, int height) {
+    return _trackedPalms.isNotEmpty &&
+        width == _trackedWidth &&
+        height == _trackedHeight &&
+        (palmRefreshInterval <= 0 ||
+            _framesSincePalmDetection < palmRefreshInterval);
+  }
+
+  /// Replaces the tracked crops with ones derived from [hands] on a [width]
+  /// x [height] frame and returns [hands] without duplicates.
+  ///
+  /// Two tracks that converge on the same hand (e.g. after hands cross) are
+  /// merged, keeping the earlier one, which has the higher palm score.
+  List<Hand> _updateTracks(int width, int height, List<Hand> hands) {
+    final kept = <Hand>[];
+    final palms = <PalmDetection>[];
+    final maxSide = math.max(width, height);
+    for (final hand in hands) {
+      final roi = _roiFromLandmarks(hand);
+      if (roi == null) continue;
+      final duplicate = palms.any((other) {
+        final dx = (roi.sqnRrCenterX - other.sqnRrCenterX) * width;
+        final dy = (roi.sqnRrCenterY - other.sqnRrCenterY) * height;
+        final minSize = math.min(roi.sqnRrSize, other.sqnRrSize) * maxSide;
+        return math.sqrt(dx * dx + dy * dy) < 0.5 * minSize;
+      });
+      if (duplicate) continue;
+      kept.add(hand);
+      palms.add(roi);
+    }
+    _trackedPalms = palms;
+    _trackedWidth = width;
+    _trackedHeight = height;
+    return kept;
+  }
+
+  /// Landmarks bounding the tracking crop: the wrist, thumb CMC/MCP/IP and
+  /// the MCP and PIP joints of each finger (MediaPipe's
+  /// HandLandmarksToRectCalculator).
+  static const List<int> _roiLandmarks = [
+    0, 1, 2, 3, 5, 6, 9, 10, 13, 14, 17, 18,
+  ];
+
+  /// Derives the next frame's crop from a hand's landmarks.
+  ///
+  /// The rotation points from the wrist to the middle of the index, middle
+  /// and ring MCP joints, the same convention as the palm detector's
+  /// wrist-to-middle-finger keypoints. The square is twice the landmark
+  /// extent in the rotated frame, shifted 10% towards the fingers. Returns
+  /// null if the hand has no landmarks.
+  static PalmDetection? _roiFromLandmarks(Hand hand) {
+    final lms = hand.landmarks;
+    if (lms.length < 21) return null;
+
+    final wrist = lms[HandLandmarkType.wrist.index];
+    final midX = ((lms[5].x + lms[13].x) / 2 + lms[9].x) / 2;
+    final midY = ((lms[5].y + lms[13].y) / 2 + lms[9].y) / 2;
+    final rotation = PalmDetector.normalizeRadians(
+        0.5 * math.pi - math.atan2(-(midY - wrist.y), midX - wrist.x));
+
+    // Axis-aligned center, then bounds in the hand's rotated frame.
+    double minX = double.infinity, maxX = -double.infinity;
+    double minY = double.infinity, maxY = -double.infinity;
+    for (final i in _roiLandmarks) {
+      minX = math.min(minX, lms[i].x);
+      maxX = math.max(maxX, lms[i].x);
+      minY = math.min(minY, lms[i].y);
+      maxY = math.max(maxY, lms[i].y);
+    }
+    final alignedX = (minX + maxX) / 2;
+    final alignedY = (minY + maxY) / 2;
+
+    final cosR = math.cos(rotation);
+    final sinR = math.sin(rotation);
+    double pMinX = double.infinity, pMaxX = -double.infinity;
+    double pMinY = double.infinity, pMaxY = -double.infinity;
+    for (final i in _roiLandmarks) {
+      final x = lms[i].x - alignedX;
+      final y = lms[i].y - alignedY;
+      // R(-rotation) into the hand frame.
+      final px = x * cosR + y * sinR;
+      final py = -x * sinR + y * cosR;
+      pMinX = math.min(pMinX, px);
+      pMaxX = math.max(pMaxX, px);
+      pMinY = math.min(pMinY, py);
+      pMaxY = math.max(pMaxY, py);
+    }
+    final width = pMaxX - pMinX;
+    final height = pMaxY - pMinY;
+    final longSide = math.max(width, height);
+    if (longSide <= 0) return null;
+
+    // Back to image space with R(rotation), shifted by -0.1 * height along
+    // the hand's y axis.
+    final pcx = (pMinX + pMaxX) / 2;
+    final pcy = (pMinY + pMaxY) / 2 - 0.1 * height;
+    final centerX = pcx * cosR - pcy * sinR + alignedX;
+    final centerY = pcx * sinR + pcy * cosR + alignedY;
+
+    return PalmDetection(
+      sqnRrSize:
+          2.0 * longSide / math.max(hand.imageWidth, hand.imageHeight),
+      rotation: rotation,
+      sqnRrCenterX: centerX / hand.imageWidth,
+      sqnRrCenterY: centerY / hand.imageHeight,
+      score: hand.score,
+    );
+  }
+
+  /// Stage 2: crops each palm's rotated square and extracts landmarks.
+  /// Hands whose landmark score is below [minLandmarkScore] are dropped.
+  Future<List<Hand>> _detectLandmarks(
+    _Frame frame,
+    List<PalmDetection> palms,
+    DetectionStats? stats,
+  ) async {
     // Phase 1: Preprocess all detections (crop and rotate)
+    final watch = Stopwatch()..start();
+    final yuv = frame.yuv;
+    final cropDataList = yuv != null
+        ? _cropHandsYuv(yuv, palms)
+        : _cropHands(frame.bgr!, palms);
+    stats?.crop += watch.elapsed;
+
+    try {
+      // Phase 2: Run landmark extraction for all hands, one call per hand
+      // when not batched or when the batch failed
+      List<HandLandmarks?>? allLandmarks;
+      if (batchLandmarks && cropDataList.length > 1) {
+        try {
+          allLandmarks = await _lm.runBatch(
+              cropDataList.map((data) => data.croppedHand).toList(),
+              stats: stats);
+        } catch (_) {}
+      }
+      allLandmarks ??= await Future.wait(cropDataList.map((data) async {
+        try {
+          return await _lm.run(data.croppedHand, stats: stats);
+        } catch (_) {
+          return null;
+        }
+      }));
+
+      // Phase 3: Post-process results and transform coordinates
+      watch.reset();
+      final results =
+          _buildResults(frame.width, frame.height, cropDataList, allLandmarks);
+      stats?.resultBuilding += watch.elapsed;
+      return results;
+    } finally {
+      // Return the crop buffers to the arena for the next frame
+      for (final data in cropDataList) {
+        data.release(_arena);
+      }
+    }
+  }
+
+  /// Stage 2 of [detectOnMatPacked]: like [_detectLandmarks], with the
+  /// landmark model writing straight into the packed sections. Hands whose
+  /// landmark score is below [minLandmarkScore] are dropped.
+  Future<PackedHands> _detectLandmarksPacked(
+    cv.Mat image,
+    List<PalmDetection> palms,
+    DetectionStats? stats,
+  ) async {
+    final watch = Stopwatch()..start();
+    final cropDataList = _cropHands(image, palms);
+    stats?.crop += watch.elapsed;
+
+    final n = cropDataList.length;
+    final packed = _emptyPacked(image.cols, image.rows, n);
+    final landmarks = packed.landmarks;
+    final scores = packed.landmarkScores;
+    final handedness = packed.handedness;
+    try {
+      final crops = [for (final data in cropDataList) data.croppedHand];
+      bool batched = false;
+      if (batchLandmarks && n > 1) {
+        try {
+          await _lm.runInto(crops, landmarks, scores, handedness,
+              stats: stats);
+          batched = true;
+        } catch (_) {}
+      }
+      if (!batched) {
+        const lmFloats = PackedHands.landmarkFloats;
+        await Future.wait([
+          for (int i = 0; i < n; i++)
+            _lm
+                .runInto(
+                  [crops[i]],
+                  Float32List.sublistView(
+                      landmarks, i * lmFloats, (i + 1) * lmFloats),
+                  Float32List.sublistView(scores, i, i + 1),
+                  Float32List.sublistView(handedness, i, i + 1),
+                  stats: stats,
+                )
+                .catchError((Object _) {
+              scores[i] = double.nan;
+            }),
+        ]);
+      }
+
+      watch.reset();
+      final results = _packResults(image, cropDataList, packed);
+      stats?.resultBuilding += watch.elapsed;
+      return results;
+    } finally {
+      for (final data in cropDataList) {
+        data.release(_arena);
+      }
+    }
+  }
+
+  /// Crops and rotates each palm's square out of [image] straight to the
+  /// landmark input size. Squares of at least twice that size sample from
+  /// the arena's pyramid, built once over the region they cover. Palms
+  /// whose crop fails are skipped; the caller releases the crops to the
+  /// arena.
+  List<_HandCropData> _cropHands(cv.Mat image, List<PalmDetection> palms) {
+    const inputSize = HandLandmarkModelRunner.inputSize;
+    final longSide = math.max(image.cols, image.rows);
+    cv.Rect? region;
+    for (final palm in palms) {
+      if (palm.sqnRrSize * longSide < 2 * inputSize) continue;
+      final bounds = ImageUtils.cropBounds(image, palm);
+      if (bounds == null) continue;
+      region = region == null ? bounds : _union(region, bounds);
+    }
+    final pyramid = _arena.cropPyramid;
+    if (region != null) pyramid.reset(image, region);
+
     final cropDataList = <_HandCropData>[];
-    for (final palm in limitedPalms) {
-      final cropped = ImageUtils.rotateAndCropRectangle(image, palm);
-      if (cropped == null) {
-        continue;
+    try {
+      for (final palm in palms) {
+        final cropped = ImageUtils.rotateAndCropRectangle(
+          image,
+          palm,
+          arena: _arena,
+          outputSize: inputSize,
+          pyramid: region != null ? pyramid : null,
+        );
+        if (cropped == null) {
+          continue;
+        }
+
+        // Calculate pixel coordinates for later transformation
+        final centerX = palm.sqnRrCenterX * image.cols;
+        final centerY = palm.sqnRrCenterY * image.rows;
+        final size = palm.sqnRrSize * longSide;
+
+        cropDataList.add(_HandCropData(
+          palm: palm,
+          croppedHand: cropped,
+          cropScale: size.round() / inputSize,
+          rotation: palm.rotation,
+          centerX: centerX,
+          centerY: centerY,
+          cropSize: size,
+        ));
       }
+    } finally {
+      pyramid.clear();
+    }
+    return cropDataList;
+  }
 
-      // Calculate pixel coordinates for later transformation
-      final centerX = palm.sqnRrCenterX * image.cols;
-      final centerY = palm.sqnRrCenterY * image.rows;
-      final size = palm.sqnRrSize * math.max(image.cols, image.rows);
+  /// [_cropHands] for a YUV 4:2:0 [frame], sampled by the native warp-crop
+  /// kernel without a BGR copy of the frame.
+  List<_HandCropData> _cropHandsYuv(
+      NativeYuvFrame frame, List<PalmDetection> palms) {
+    const inputSize = HandLandmarkModelRunner.inputSize;
+    final native = NativeKernels.instance!;
+    final longSide = math.max(frame.width, frame.height);
+    final cropDataList = <_HandCropData>[];
+    for (final palm in palms) {
+      final cropped = ImageUtils.rotateAndCropYuv(native, frame, palm,
+          arena: _arena, outputSize: inputSize);
+      if (cropped == null) continue;
 
+      final size = palm.sqnRrSize * longSide;
       cropDataList.add(_HandCropData(
         palm: palm,
         croppedHand: cropped,
+        cropScale: size.round() / inputSize,
         rotation: palm.rotation,
-        centerX: centerX,
-        centerY: centerY,
+        centerX: palm.sqnRrCenterX * frame.width,
+        centerY: palm.sqnRrCenterY * frame.height,
         cropSize: size,
       ));
     }
+    return cropDataList;
+  }
 
-    // Phase 2: Run landmark extraction in parallel for all hands
-    final futures = cropDataList.map((data) async {
-      try {
-        return await _lm.run(data.croppedHand);
-      } catch (_) {
-        return null;
-      }
-    }).toList();
-
-    final allLandmarks = await Future.wait(futures);
-
-    // Phase 3: Post-process results and transform coordinates
-    final results = _buildResults(image, cropDataList, allLandmarks);
-
-    // Clean up crop data (dispose cv.Mat objects)
-    for (final data in cropDataList) {
-      data.dispose();
-    }
-
-    return results;
+  static cv.Rect _union(cv.Rect a, cv.Rect b) {
+    final left = math.min(a.x, b.x);
+    final top = math.min(a.y, b.y);
+    final right = math.max(a.x + a.width, b.x + b.width);
+    final bottom = math.max(a.y + a.height, b.y + b.height);
+    return cv.Rect(left, top, right - left, bottom - top);
   }
 
-  /// Converts palm detections to Hand objects (boxes only mode).
+  /// Converts palm detections on a [width] x [height] image to Hand objects
+  /// (boxes only mode).
   List<Hand> _palmsToHands(
-    cv.Mat image,
+    int width,
+    int height,
     List<PalmDetection> palms,
     List<HandLandmarks?> landmarks,
   ) {
@@ -268,22 +1454,22 @@ class HandDetector {
       final palm = palms[i];
 
       // Calculate bounding box from rotation rectangle
-      final centerX = palm.sqnRrCenterX * image.cols;
-      final centerY = palm.sqnRrCenterY * image.rows;
-      final size = palm.sqnRrSize * math.max(image.cols, image.rows);
+      final centerX = palm.sqnRrCenterX * width;
+      final centerY = palm.sqnRrCenterY * height;
+      final size = palm.sqnRrSize * math.max(width, height);
       final halfSize = size / 2;
 
       results.add(Hand(
         boundingBox: BoundingBox(
-          left: (centerX - halfSize).clamp(0, image.cols.toDouble()),
-          top: (centerY - halfSize).clamp(0, image.rows.toDouble()),
-          right: (centerX + halfSize).clamp(0, image.cols.toDouble()),
-          bottom: (centerY + halfSize).clamp(0, image.rows.toDouble()),
+          left: (centerX - halfSize).clamp(0, width.toDouble()),
+          top: (centerY - halfSize).clamp(0, height.toDouble()),
+          right: (centerX + halfSize).clamp(0, width.toDouble()),
+          bottom: (centerY + halfSize).clamp(0, height.toDouble()),
         ),
         score: palm.score,
         landmarks: const [],
-        imageWidth: image.cols,
-        imageHeight: image.rows,
+        imageWidth: width,
+        imageHeight: height,
         handedness: i < landmarks.length ? landmarks[i]?.handedness : null,
         rotation: palm.rotation,
         rotatedCenterX: centerX,
@@ -302,7 +1488,8 @@ class HandDetector {
   /// This method applies rotation and translation to transform them
   /// to original image coordinates.
   List<Hand> _buildResults(
-    cv.Mat image,
+    int width,
+    int height,
     List<_HandCropData> cropDataList,
     List<HandLandmarks?> allLandmarks,
   ) {
@@ -332,6 +1519,7 @@ class HandDetector {
           yCrop,
           cropW,
           cropH,
+          data.cropScale,
           data.rotation,
           data.centerX,
           data.centerY,
@@ -339,8 +1527,8 @@ class HandDetector {
 
         transformedLandmarks.add(HandLandmark(
           type: lm.type,
-          x: xOrig.clamp(0, image.cols.toDouble()),
-          y: yOrig.clamp(0, image.rows.toDouble()),
+          x: xOrig.clamp(0, width.toDouble()),
+          y: yOrig.clamp(0, height.toDouble()),
           z: lm.z,
           visibility: lm.visibility,
         ));
@@ -351,15 +1539,15 @@ class HandDetector {
 
       results.add(Hand(
         boundingBox: BoundingBox(
-          left: (data.centerX - halfSize).clamp(0, image.cols.toDouble()),
-          top: (data.centerY - halfSize).clamp(0, image.rows.toDouble()),
-          right: (data.centerX + halfSize).clamp(0, image.cols.toDouble()),
-          bottom: (data.centerY + halfSize).clamp(0, image.rows.toDouble()),
+          left: (data.centerX - halfSize).clamp(0, width.toDouble()),
+          top: (data.centerY - halfSize).clamp(0, height.toDouble()),
+          right: (data.centerX + halfSize).clamp(0, width.toDouble()),
+          bottom: (data.centerY + halfSize).clamp(0, height.toDouble()),
         ),
         score: data.palm.score,
         landmarks: transformedLandmarks,
-        imageWidth: image.cols,
-        imageHeight: image.rows,
+        imageWidth: width,
+        imageHeight: height,
         handedness: lms.handedness,
         rotation: data.rotation,
         rotatedCenterX: data.centerX,
@@ -371,6 +1559,72 @@ class HandDetector {
     return results;
   }
 
+  /// Finishes [packed] after the landmark model has filled its landmark,
+  /// landmark score and handedness sections: moves the landmarks from crop
+  /// to image space (as [_buildResults]), writes boxes, palm scores and
+  /// rotations, and drops hands below [minLandmarkScore].
+  PackedHands _packResults(
+    cv.Mat image,
+    List<_HandCropData> cropDataList,
+    PackedHands packed,
+  ) {
+    final data = packed.data;
+    final width = image.cols.toDouble();
+    final height = image.rows.toDouble();
+    final kept = <int>[];
+    for (int i = 0; i < cropDataList.length; i++) {
+      final crop = cropDataList[i];
+      // NaN marks a failed landmark call
+      if (!(data[packed.landmarkScoresOffset + i] >= minLandmarkScore)) {
+        continue;
+      }
+      kept.add(i);
+
+      final halfW = crop.croppedHand.cols / 2;
+      final halfH = crop.croppedHand.rows / 2;
+      final cosR = math.cos(crop.rotation);
+      final sinR = math.sin(crop.rotation);
+      final base = packed.landmarksOffset + PackedHands.landmarkFloats * i;
+      for (int j = 0; j < numHandLandmarks; j++) {
+        final k = base + j * 3;
+        final xRel = (data[k] - halfW) * crop.cropScale;
+        final yRel = (data[k + 1] - halfH) * crop.cropScale;
+        data[k] = (xRel * cosR - yRel * sinR + crop.centerX).clamp(0, width);
+        data[k + 1] =
+            (xRel * sinR + yRel * cosR + crop.centerY).clamp(0, height);
+      }
+      _packBox(packed, i, width, height, crop.centerX, crop.centerY,
+          crop.cropSize, crop.palm);
+    }
+    return kept.length == cropDataList.length ? packed : packed.select(kept);
+  }
+
+  /// Writes the box, palm score and rotated square of hand [i] into
+  /// [packed].
+  static void _packBox(
+    PackedHands packed,
+    int i,
+    double width,
+    double height,
+    double centerX,
+    double centerY,
+    double size,
+    PalmDetection palm,
+  ) {
+    final halfSize = size / 2;
+    packed.data
+      ..[packed.boxesOffset + 4 * i] = (centerX - halfSize).clamp(0, width)
+      ..[packed.boxesOffset + 4 * i + 1] = (centerY - halfSize).clamp(0, height)
+      ..[packed.boxesOffset + 4 * i + 2] = (centerX + halfSize).clamp(0, width)
+      ..[packed.boxesOffset + 4 * i + 3] =
+          (centerY + halfSize).clamp(0, height)
+      ..[packed.scoresOffset + i] = palm.score
+      ..[packed.rotationsOffset + 4 * i] = palm.rotation
+      ..[packed.rotationsOffset + 4 * i + 1] = centerX
+      ..[packed.rotationsOffset + 4 * i + 2] = centerY
+      ..[packed.rotationsOffset + 4 * i + 3] = size;
+  }
+
   /// Transforms coordinates from crop space to original image space.
   ///
   /// Applies inverse rotation and translation to convert landmark
@@ -378,18 +1632,21 @@ class HandDetector {
   ///
   /// The forward transform in rotateAndCropRectangle applies R(+rotation) to the image.
   /// To match Python (hand_landmark.py:357), the inverse applies R(-rotation) to undo it.
+  /// The crop was warped straight to the landmark input size, so offsets from
+  /// its center are first scaled back by [scale] source pixels per crop pixel.
   (double, double) _transformToOriginal(
     double xCrop,
     double yCrop,
     double cropW,
     double cropH,
+    double scale,
     double rotation,
     double centerX,
     double centerY,
   ) {
-    // Convert to relative position from crop center
-    final xRel = xCrop - cropW / 2;
-    final yRel = yCrop - cropH / 2;
+    // Convert to relative position from crop center, in source pixels
+    final xRel = (xCrop - cropW / 2) * scale;
+    final yRel = (yCrop - cropH / 2) * scale;
 
     // Apply inverse rotation R(-rotation) to undo the forward R(+rotation)
     // R(-θ) = [cos(-θ), sin(-θ); -sin(-θ), cos(-θ)]
@@ -0,0 +1,276 @@
+import 'dart:async';
+import 'dart:ffi' as ffi;
+import 'dart:isolate';
+import 'dart:typed_data';
+import 'package:flutter/services.dart';
+import 'package:opencv_dart/opencv_dart.dart' as cv;
+import 'hand_detector.dart';
+import 'types.dart';
+
+/// Detection calls a [HandDetectorIsolate] forwards to its worker.
+enum _Call { detect, detectPacked, detectOnMat, detectOnMatPacked }
+
+/// A detection request: id, call, and the encoded image or the native
+/// address of the caller's BGR Mat.
+typedef _Request = (
+  int id,
+  _Call call,
+  TransferableTypedData? encoded,
+  int mat,
+);
+
+/// A reply to request `id`: the frame's results and the worker detector's
+/// stage timings, or an error message and stack trace.
+typedef _Reply = (
+  int id,
+  PackedHands? result,
+  DetectionStats? stats,
+  (String, String)? error,
+);
+
+/// Runs a [HandDetector] end to end on a dedicated, long-lived worker
+/// isolate (`HandDetector(useWorkerIsolate: true)`).
+///
+/// The worker owns the palm and landmark interpreters, which run inline on
+/// it rather than each on an `IsolateInterpreter`, together with all
+/// buffers, and it decodes, detects, crops and post-processes every frame
+/// there. A call sends one message with the encoded image or the address
+/// of the caller's Mat, which the worker reads in place, and receives one
+/// [PackedHands], however many hands the frame has. Calls are processed in
+/// order; tracking and smoothing state lives on the worker.
+class HandDetectorIsolate {
+  final SendPort _requests;
+  final ReceivePort _replies;
+  final Map<int, Completer<(PackedHands, DetectionStats?)>> _pending = {};
+
+  /// Mats whose address is on the worker, kept reachable until their reply
+  /// so they are not finalized while it reads them.
+  final Map<int, cv.Mat> _inFlight = {};
+  int _nextId = 0;
+
+  /// Completes when the worker isolate has exited.
+  final Future<void> _exited;
+
+  /// Why calls fail once the worker is gone, or null while it runs.
+  Object? _gone;
+
+  HandDetectorIsolate._(this._requests, this._replies, this._exited);
+
+  /// Spawns a worker, creates its detector with [create] and initializes it
+  /// there. [create] must capture only sendable settings.
+  ///
+  /// Throws a [RemoteError] when the worker's detector fails to initialize.
+  /// If the worker later dies, pending and further calls fail with the
+  /// uncaught error as a [RemoteError], or a [StateError].
+  static Future<HandDetectorIsolate> spawn(
+      HandDetector Function() create) async {
+    final replies = ReceivePort();
+    final ready = Completer<SendPort>();
+    HandDetectorIsolate? worker;
+    replies.listen((message) {
+      if (worker != null) {
+        worker!._reply(message as _Reply);
+      } else if (message is SendPort) {
+        ready.complete(message);
+      } else {
+        final (error, stack) = message as (String, String);
+        ready.completeError(RemoteError(error, stack));
+      }
+    });
+
+    // Uncaught errors arrive as [error, stack] lists, then null on exit.
+    final events = ReceivePort();
+    final exited = Completer<void>();
+    RemoteError? crash;
+    events.listen((message) {
+      if (message is List) {
+        crash = RemoteError('${message[0]}', '${message[1]}');
+        return;
+      }
+      events.close();
+      final error =
+          crash ?? StateError('HandDetectorIsolate worker exited.');
+      if (!ready.isCompleted) ready.completeError(error);
+      worker?._fail(error);
+      exited.complete();
+    });
+
+    Isolate? isolate;
+    try {
+      isolate = await Isolate.spawn(
+        _main,
+        (replies.sendPort, create, RootIsolateToken.instance),
+        onError: events.sendPort,
+        onExit: events.sendPort,
+        debugName: 'HandDetectorIsolate',
+      );
+      return worker =
+          HandDetectorIsolate._(await ready.future, replies, exited.future);
+    } catch (_) {
+      replies.close();
+      if (isolate == null) events.close();
+      isolate?.kill();
+      rethrow;
+    }
+  }
+
+  /// [HandDetector.detect] or, with [packed], [HandDetector.detectPacked]
+  /// on the worker.
+  Future<(PackedHands, DetectionStats?)> detect(
+    List<int> imageBytes, {
+    required bool packed,
+  }) {
+    final bytes =
+        imageBytes is Uint8List ? imageBytes : Uint8List.fromList(imageBytes);
+    return _send(packed ? _Call.detectPacked : _Call.detect,
+        TransferableTypedData.fromList([bytes]), null);
+  }
+
+  /// [HandDetector.detectOnMat] or, with [packed],
+  /// [HandDetector.detectOnMatPacked] on the BGR [image].
+  ///
+  /// Only [image]'s native address is sent: the worker reads the pixels in
+  /// place, so [image] must not be disposed or written to until the
+  /// returned future completes.
+  Future<(PackedHands, DetectionStats?)> detectOnMat(
+    cv.Mat image, {
+    required bool packed,
+  }) {
+    return _send(
+      packed ? _Call.detectOnMatPacked : _Call.detectOnMat,
+      null,
+      image,
+    );
+  }
+
+  /// [HandDetector.resetTracking] on the worker, ordered with the calls
+  /// around it.
+  void resetTracking() => _requests.send(true);
+
+  /// Disposes the worker's detector and shuts the isolate down once the
+  /// calls already sent have been answered.
+  Future<void> close() async {
+    _gone ??= StateError('HandDetectorIsolate closed.');
+    _requests.send(null);
+    await _exited;
+  }
+
+  Future<(PackedHands, DetectionStats?)> _send(
+    _Call call,
+    TransferableTypedData? encoded,
+    cv.Mat? image,
+  ) {
+    final gone = _gone;
+    if (gone != null) return Future.error(gone);
+    final id = _nextId++;
+    final completer = Completer<(PackedHands, DetectionStats?)>();
+    _pending[id] = completer;
+    if (image != null) _inFlight[id] = image;
+    _requests.send((id, call, encoded, image?.ptr.address ?? 0));
+    return completer.future;
+  }
+
+  /// Fails the pending calls once the worker has exited.
+  void _fail(Object error) {
+    _gone ??= error;
+    _replies.close();
+    for (final call in _pending.values) {
+      call.completeError(_gone!);
+    }
+    _pending.clear();
+    _inFlight.clear();
+  }
+
+  void _reply(_Reply reply) {
+    final (id, result, stats, error) = reply;
+    _inFlight.remove(id);
+    final completer = _pending.remove(id);
+    if (completer == null) return;
+    if (error != null) {
+      completer.completeError(RemoteError(error.$1, error.$2));
+    } else {
+      completer.complete((result!, stats));
+    }
+  }
+
+  /// Worker entry point: initializes the detector, then serves requests in
+  /// order until it receives null.
+  static Future<void> _main(
+    (SendPort, HandDetector Function(), RootIsolateToken?) args,
+  ) async {
+    final (replies, create, token) = args;
+    // Bundled models are read through the asset bundle off Linux.
+    if (token != null) {
+      BackgroundIsolateBinaryMessenger.ensureInitialized(token);
+    }
+
+    final detector = create();
+    try {
+      await detector.initialize();
+    } catch (e, stack) {
+      replies.send((e.toString(), stack.toString()));
+      return;
+    }
+    final requests = ReceivePort();
+    replies.send(requests.sendPort);
+
+    await for (final message in requests) {
+      if (message == null) break;
+      if (message == true) {
+        detector.resetTracking();
+        continue;
+      }
+      final (id, call, encoded, mat) = message as _Request;
+      _Reply reply;
+      try {
+        final result = await _run(detector, call, encoded, mat);
+        reply = (id, result, detector.lastStats, null);
+      } catch (e, stack) {
+        reply = (id, null, null, (e.toString(), stack.toString()));
+      }
+      replies.send(reply);
+    }
+    requests.close();
+    await detector.dispose();
+  }
+
+  static Future<PackedHands> _run(
+    HandDetector detector,
+    _Call call,
+    TransferableTypedData? encoded,
+    int mat,
+  ) async {
+    switch (call) {
+      case _Call.detect:
+        final bytes = encoded!.materialize().asUint8List();
+        return _pack(detector, await detector.detect(bytes), 0, 0);
+      case _Call.detectPacked:
+        return detector.detectPacked(encoded!.materialize().asUint8List());
+      case _Call.detectOnMat:
+      case _Call.detectOnMatPacked:
+        // The caller's Mat, borrowed without a finalizer: it stays owned
+        // and kept alive by the caller until the reply.
+        final image = cv.Mat.fromPointer(ffi.Pointer.fromAddress(mat), false);
+        if (call == _Call.detectOnMatPacked) {
+          return detector.detectOnMatPacked(image);
+        }
+        return _pack(detector, await detector.detectOnMat(image), image.cols,
+            image.rows);
+    }
+  }
+
+  /// Packs [hands] for the trip back; an empty frame keeps the given size.
+  static PackedHands _pack(
+    HandDetector detector,
+    List<Hand> hands,
+    int width,
+    int height,
+  ) {
+    return PackedHands.fromHands(
+      hands,
+      imageWidth: hands.isEmpty ? width : hands.first.imageWidth,
+      imageHeight: hands.isEmpty ? height : hands.first.imageHeight,
+      hasLandmarks: detector.mode == HandMode.boxesAndLandmarks,
+    );
+  }
+}
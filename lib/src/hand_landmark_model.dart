@@ -8,6 +8,11 @@ import 'package:path/path.dart' as p;
 import 'package:meta/meta.dart';
 import 'package:tflite_flutter_custom/tflite_flutter.dart';
 import 'image_utils.dart';
+import 'mat_arena.dart';
+import 'native_kernels.dart';
+import 'native_pipeline.dart';
+import 'tensor_memory.dart';
+import 'tensor_quantization.dart';
 import 'types.dart';
 
 /// A single interpreter instance with its associated resources.
@@ -17,36 +22,82 @@ import 'types.dart';
 /// Also holds pre-allocated input/output buffers to avoid GC pressure.
 class _InterpreterInstance {
   final Interpreter interpreter;
-  final IsolateInterpreter isolateInterpreter;
 
-  // Pre-allocated input buffer as flat Float32List [1 * 224 * 224 * 3]
-  final Float32List inputBuffer;
+  /// Isolate the interpreter runs on, or null for inline inference or
+  /// with [memory].
+  final IsolateInterpreter? isolateInterpreter;
 
-  // Pre-allocated output buffers - matches Python hand landmark model outputs
-  final List<List<double>>
-      outputLandmarks; // [1, 63] - 21 landmarks × 3 (x, y, z)
-  final List<List<double>> outputScore; // [1, 1] - hand confidence score
-  final List<List<double>> outputHandedness; // [1, 1] - 0=left, 1=right
-  final List<List<double>>
-      outputWorldLandmarks; // [1, 63] - 21 world landmarks × 3
+  /// Direct access to the interpreter's tensors, or null where the
+  /// TensorFlow Lite C API is not reachable from Dart. With it crops are
+  /// letterboxed straight into the input tensor and outputs are read in
+  /// place; the batch buffers then only hold dequantized outputs.
+  final TensorMemory? memory;
+
+  /// Batch dimension of input 0, fixed at creation.
+  final int batchSize;
+
+  // Flat buffers matching the model's tensors, sized for [batchSize]
+  // hands: the input and the four outputs, one block of values per hand.
+  Float32List? batchInput; // [N * 224 * 224 * 3]
+  Float32List? batchLandmarks; // [N * 63] - 21 landmarks × 3 (x, y, z)
+  Float32List? batchScores; // [N] - hand confidence logit
+  Float32List? batchHandedness; // [N] - 0=left, 1=right
+  Float32List? batchWorldLandmarks; // [N * 63] - 21 world landmarks × 3
+
+  // Quantized models: 8-bit input [N * 224 * 224 * 3] and raw bytes of each
+  // quantized output (null entries for float outputs).
+  Uint8List? batchInputBytes;
+  List<Uint8List?>? batchOutputBytes;
 
   _InterpreterInstance({
     required this.interpreter,
     required this.isolateInterpreter,
-    required this.inputBuffer,
-    required this.outputLandmarks,
-    required this.outputScore,
-    required this.outputHandedness,
-    required this.outputWorldLandmarks,
+    required this.memory,
+    required this.batchSize,
   });
 
+  /// Runs the interpreter on its isolate, or on the calling isolate for
+  /// inline inference, copying [inputs] and [outputs] through it.
+  Future<void> run(List<Object> inputs, Map<int, Object> outputs) async {
+    final iso = isolateInterpreter;
+    if (iso != null) {
+      await iso.runForMultipleInputs(inputs, outputs);
+    } else {
+      interpreter.runForMultipleInputs(inputs, outputs);
+    }
+  }
+
   /// Disposes interpreter and isolate wrapper.
   Future<void> dispose() async {
-    isolateInterpreter.close();
+    await memory?.close();
+    isolateInterpreter?.close();
     interpreter.close();
   }
 }
 
+/// Letterbox geometry of one crop, mapping landmark model outputs from the
+/// 224x224 input back to crop pixels.
+typedef _CropMapping = ({
+  double halfPadW,
+  double halfPadH,
+  double resizeScaleW,
+  double resizeScaleH,
+  int cropWidth,
+  int cropHeight,
+});
+
+/// Turns the outputs of crop [index] into a result: [raw] holds its 63
+/// landmark values from [rawOffset], [rawScore] and [rawHandedness] the
+/// score logit and the handedness probability.
+typedef _OutputParser<T> = T Function(
+  int index,
+  Float32List raw,
+  int rawOffset,
+  double rawScore,
+  double rawHandedness,
+  _CropMapping crop,
+);
+
 /// Hand landmark extraction model runner for Stage 2 of the hand detection pipeline.
 ///
 /// Extracts 21 landmarks from hand crops using the MediaPipe hand landmark model.
@@ -62,27 +113,62 @@ class HandLandmarkModelRunner {
   /// Pool of interpreter instances for parallel processing.
   final List<_InterpreterInstance> _interpreterPool = [];
 
+  /// Interpreter with its input allocated once for [_maxBatch] crops, for
+  /// calls with several crops. Null when [_maxBatch] is 1 or the model does
+  /// not take a batch dimension; crops then run one per invocation on the
+  /// pool.
+  _InterpreterInstance? _batchInstance;
+
   /// Maximum number of concurrent inferences.
   final int _poolSize;
 
+  /// Number of crops the batch interpreter holds.
+  final int _maxBatch;
+
+  /// Buffers reused for the letterbox fallback, shared with the owning
+  /// detector. Null allocates intermediate Mats per call.
+  final MatArena? arena;
+
   /// Delegate instances - one per interpreter (XNNPACK is NOT thread-safe for sharing).
   final List<Delegate> _delegates = [];
 
-  /// Serialization locks to prevent concurrent inference on the same interpreter.
+  /// Shared memory-mapped model (Linux), null when loaded from the asset.
+  NativeModel? _model;
+
+  /// Serialization locks to prevent concurrent inference on the same
+  /// interpreter; the last one guards [_batchInstance] when there is one.
   final List<Future<void>> _interpreterLocks = [];
 
   /// Round-robin counter for interpreter selection.
   int _poolCounter = 0;
 
+  /// Input and output encodings read from the model at [initialize].
+  TensorQuantization _inputQuant = TensorQuantization.float32;
+  List<TensorQuantization> _outputQuant = const [];
+  Uint8List? _inputLut;
+
+  /// Whether the input or any output is uint8/int8 quantized; the batch
+  /// buffers then carry the 8-bit input and the raw output bytes.
+  bool _quantized = false;
+
   bool _isInitialized = false;
   static ffi.DynamicLibrary? _tfliteLib;
 
   /// Input dimensions (224x224 for MediaPipe hand landmark model).
   static const int inputSize = 224;
 
-  /// Creates a landmark model runner with the specified pool size.
-  HandLandmarkModelRunner({int poolSize = 1})
-      : _poolSize = poolSize.clamp(1, 10);
+  /// Floats per hand in the input tensor.
+  static const int _inputFloats = inputSize * inputSize * 3;
+
+  /// Floats per hand in the landmark outputs (21 landmarks × 3).
+  static const int _landmarkFloats = numHandLandmarks * 3;
+
+  /// Creates a landmark model runner with the specified pool size, reusing
+  /// the buffers of [arena] when given. With [maxBatch] above 1 a separate
+  /// interpreter runs up to that many crops per invocation.
+  HandLandmarkModelRunner({int poolSize = 1, int maxBatch = 1, this.arena})
+      : _poolSize = poolSize.clamp(1, 10),
+        _maxBatch = math.max(1, maxBatch);
 
   /// Ensures TensorFlow Lite native library is loaded for desktop platforms.
   static Future<void> ensureTFLiteLoaded({
@@ -146,6 +232,10 @@ class HandLandmarkModelRunner {
     return 'other';
   }
 
+  /// The TensorFlow Lite C library loaded by [ensureTFLiteLoaded], or null
+  /// before it or when none was found.
+  static ffi.DynamicLibrary? get tfliteLibrary => _tfliteLib;
+
   /// Resets the TFLite native library cache for testing.
   @visibleForTesting
   static void resetNativeLibForTest() {
@@ -164,61 +254,136 @@ class HandLandmarkModelRunner {
   /// Parameters:
   /// - [model]: Which hand landmark variant to use (lite, full, or heavy)
   /// - [performanceConfig]: Optional performance configuration for TFLite delegates.
+  /// - [modelPath]: Optional landmark model file replacing the bundled asset.
+  ///   Float and uint8/int8 quantized models are supported; the encodings
+  ///   are read from the model's tensors.
+  /// - [inlineInference]: Run the interpreters on the calling isolate instead
+  ///   of each on an `IsolateInterpreter`, for callers that are themselves a
+  ///   worker isolate.
   Future<void> initialize(
     HandLandmarkModel model, {
     PerformanceConfig? performanceConfig,
+    String? modelPath,
+    bool inlineInference = false,
   }) async {
     if (_isInitialized) await dispose();
     await ensureTFLiteLoaded();
 
     final String path = _getModelPath(model);
 
-    // Create pool of interpreter instances
-    for (int i = 0; i < _poolSize; i++) {
+    // On Linux every pool entry (and every other detector in the process)
+    // shares one memory-mapped copy of the weights.
+    _model = modelPath != null
+        ? NativeModel.acquire(modelPath)
+        : NativeModel.acquireBundled(p.join('models', p.basename(path)));
+
+    Future<Interpreter> createInterpreter() async {
       final (options, delegate) = _createInterpreterOptions(performanceConfig);
       if (delegate != null) {
         _delegates.add(delegate);
       }
+      return _model?.createInterpreter(options) ??
+          (modelPath != null
+              ? Interpreter.fromFile(File(modelPath), options: options)
+              : await Interpreter.fromAsset(path, options: options));
+    }
 
-      final interpreter = await Interpreter.fromAsset(path, options: options);
+    // Create pool of interpreter instances
+    for (int i = 0; i < _poolSize; i++) {
+      final interpreter = await createInterpreter();
       interpreter.resizeInputTensor(0, [1, inputSize, inputSize, 3]);
       interpreter.allocateTensors();
 
-      final isolateInterpreter =
-          await IsolateInterpreter.create(address: interpreter.address);
-
-      // Pre-allocate input buffer as flat Float32List [1 * 224 * 224 * 3]
-      final inputBuffer = Float32List(inputSize * inputSize * 3);
-
-      // Pre-allocate output buffers matching Python model outputs
-      // Output 0: [1, 63] - 21 landmarks × 3 (x, y, z)
-      // Output 1: [1, 1] - hand confidence score
-      // Output 2: [1, 1] - handedness (0=left, 1=right)
-      // Output 3: [1, 63] - 21 world landmarks × 3 (x, y, z)
-      final outputLandmarks = [List<double>.filled(63, 0.0, growable: false)];
-      final outputScore = [List<double>.filled(1, 0.0, growable: false)];
-      final outputHandedness = [List<double>.filled(1, 0.0, growable: false)];
-      final outputWorldLandmarks = [
-        List<double>.filled(63, 0.0, growable: false)
-      ];
+      if (i == 0) {
+        _inputQuant = TensorQuantization.of(interpreter.getInputTensor(0));
+        _inputLut = _inputQuant.isQuantized ? _inputQuant.pixelLut() : null;
+        _outputQuant = [
+          for (final tensor in interpreter.getOutputTensors())
+            TensorQuantization.of(tensor),
+        ];
+        _quantized = _inputQuant.isQuantized ||
+            _outputQuant.any((q) => q.isQuantized);
+      }
 
-      _interpreterPool.add(_InterpreterInstance(
-        interpreter: interpreter,
-        isolateInterpreter: isolateInterpreter,
-        inputBuffer: inputBuffer,
-        outputLandmarks: outputLandmarks,
-        outputScore: outputScore,
-        outputHandedness: outputHandedness,
-        outputWorldLandmarks: outputWorldLandmarks,
-      ));
+      _interpreterPool
+          .add(await _createInstance(interpreter, 1, inlineInference));
 
       // Initialize serialization lock for this interpreter
       _interpreterLocks.add(Future.value());
     }
 
+    if (_maxBatch > 1) {
+      // Models with a fixed batch of 1 run every crop on the pool.
+      final interpreter = await createInterpreter();
+      bool batched = false;
+      try {
+        interpreter
+            .resizeInputTensor(0, [_maxBatch, inputSize, inputSize, 3]);
+        interpreter.allocateTensors();
+        batched = interpreter.getOutputTensor(1).shape.first == _maxBatch;
+      } catch (_) {}
+      if (batched) {
+        _batchInstance =
+            await _createInstance(interpreter, _maxBatch, inlineInference);
+        _interpreterLocks.add(Future.value());
+      } else {
+        interpreter.close();
+      }
+    }
+
     _isInitialized = true;
   }
 
+  /// Wraps [interpreter], whose input is allocated for [batch] crops, with
+  /// its tensor memory or isolate and flat buffers for that many crops.
+  ///
+  /// With tensor memory the input and float outputs live in the tensors,
+  /// so only quantized outputs get a buffer, to be dequantized into.
+  Future<_InterpreterInstance> _createInstance(
+    Interpreter interpreter,
+    int batch,
+    bool inlineInference,
+  ) async {
+    final memory =
+        await TensorMemory.create(interpreter, inline: inlineInference);
+    final isolateInterpreter = memory != null || inlineInference
+        ? null
+        : await IsolateInterpreter.create(address: interpreter.address);
+    final instance = _InterpreterInstance(
+      interpreter: interpreter,
+      isolateInterpreter: isolateInterpreter,
+      memory: memory,
+      batchSize: batch,
+    );
+
+    final copied = memory == null;
+    if (copied && _inputQuant.isQuantized) {
+      instance.batchInputBytes = Uint8List(batch * _inputFloats);
+    } else if (copied) {
+      instance.batchInput = Float32List(batch * _inputFloats);
+    }
+    final sizes = [
+      batch * _landmarkFloats,
+      batch,
+      batch,
+      batch * _landmarkFloats,
+    ];
+    Float32List? output(int k) =>
+        copied || _outputQuant[k].isQuantized ? Float32List(sizes[k]) : null;
+    instance
+      ..batchLandmarks = output(0)
+      ..batchScores = output(1)
+      ..batchHandedness = output(2)
+      ..batchWorldLandmarks = output(3);
+    if (copied && _quantized) {
+      instance.batchOutputBytes = [
+        for (int k = 0; k < sizes.length; k++)
+          _outputQuant[k].isQuantized ? Uint8List(sizes[k]) : null,
+      ];
+    }
+    return instance;
+  }
+
   /// Creates interpreter options with delegates based on performance configuration.
   (InterpreterOptions, Delegate?) _createInterpreterOptions(
       PerformanceConfig? config) {
@@ -266,6 +431,11 @@ class HandLandmarkModelRunner {
       await instance.dispose();
     }
     _interpreterPool.clear();
+    await _batchInstance?.dispose();
+    _batchInstance = null;
+
+    _model?.release();
+    _model = null;
 
     for (final delegate in _delegates) {
       delegate.delete();
@@ -273,27 +443,46 @@ class HandLandmarkModelRunner {
     _delegates.clear();
 
     _interpreterLocks.clear();
+    _inputQuant = TensorQuantization.float32;
+    _outputQuant = const [];
+    _inputLut = null;
+    _quantized = false;
     _isInitialized = false;
   }
 
   /// Serializes inference calls on a specific interpreter to prevent race conditions.
+  ///
+  /// Runs [fn] on [_batchInstance] when [batched] is set, otherwise on the
+  /// next pool interpreter. The time spent waiting for the interpreter is
+  /// added to [stats].
   Future<T> _withInterpreterLock<T>(
-      Future<T> Function(_InterpreterInstance) fn) async {
+    Future<T> Function(_InterpreterInstance) fn, {
+    DetectionStats? stats,
+    bool batched = false,
+  }) async {
     if (_interpreterPool.isEmpty) {
       throw StateError('Interpreter pool is empty. Call initialize() first.');
     }
 
     // Round-robin selection
-    final int poolIndex = _poolCounter % _interpreterPool.length;
-    _poolCounter = (_poolCounter + 1) % _interpreterPool.length;
+    final int poolIndex;
+    if (batched) {
+      poolIndex = _interpreterPool.length;
+    } else {
+      poolIndex = _poolCounter % _interpreterPool.length;
+      _poolCounter = (_poolCounter + 1) % _interpreterPool.length;
+    }
+    final instance = batched ? _batchInstance! : _interpreterPool[poolIndex];
 
     final previous = _interpreterLocks[poolIndex];
     final completer = Completer<void>();
     _interpreterLocks[poolIndex] = completer.future;
 
     try {
+      final wait = Stopwatch()..start();
       await previous;
-      return await fn(_interpreterPool[poolIndex]);
+      stats?.interpreterLockWait += wait.elapsed;
+      return await fn(instance);
     } finally {
       completer.complete();
     }
@@ -305,104 +494,280 @@ class HandLandmarkModelRunner {
   /// The input image should be a cropped and rotated hand region from the palm detector.
   ///
   /// Parameters:
-  /// - [roiImage]: Cropped hand image (will be resized to 224x224 internally)
+  /// - [roiImage]: Cropped hand image (letterboxed to 224x224 internally;
+  ///   crops already at that size, as `HandDetector` makes, are used as is)
   ///
   /// Returns [HandLandmarks] containing 21 landmarks with coordinates in the
   /// original crop image pixel space (matching Python's postprocessing),
   /// a confidence score, and handedness (left/right).
-  Future<HandLandmarks> run(cv.Mat roiImage) async {
+  ///
+  /// When [stats] is given, the lock wait, preprocess, inference and output
+  /// parsing times are added to it.
+  Future<HandLandmarks> run(cv.Mat roiImage, {DetectionStats? stats}) async {
     if (!_isInitialized) {
       throw StateError(
           'HandLandmarkModelRunner not initialized. Call initialize() first.');
     }
+    return (await _runFlat([roiImage], stats, _parseLandmarks)).first;
+  }
 
-    return await _withInterpreterLock((instance) async {
-      // Use keep_aspect_resize_and_pad to match Python implementation
-      final (paddedImage, resizedImage) = ImageUtils.keepAspectResizeAndPad(
-        roiImage,
-        inputSize,
-        inputSize,
-      );
+  /// Runs landmark extraction on several hand crops in a single inference.
+  ///
+  /// Packs the crops into the batch interpreter's `[maxBatch, 224, 224, 3]`
+  /// input and parses the outputs of the first N slots in one pass, so N
+  /// hands cost one interpreter invocation instead of N. The input is
+  /// allocated once; slots past N are padding. More than `maxBatch` crops
+  /// take several invocations, and without a batch interpreter every crop
+  /// takes its own.
+  ///
+  /// Returns one [HandLandmarks] per crop, in the order of [roiImages]. When
+  /// [stats] is given, the stage times are added to it as for [run].
+  Future<List<HandLandmarks>> runBatch(
+    List<cv.Mat> roiImages, {
+    DetectionStats? stats,
+  }) async {
+    if (!_isInitialized) {
+      throw StateError(
+          'HandLandmarkModelRunner not initialized. Call initialize() first.');
+    }
+    if (roiImages.isEmpty) return <HandLandmarks>[];
+    return _runFlat(roiImages, stats, _parseLandmarks);
+  }
+
+  /// Runs landmark extraction on [roiImages] like [runBatch], but writes
+  /// the results into flat lists instead of creating [HandLandmarks]
+  /// objects.
+  ///
+  /// For crop i, [landmarks] receives its 21 x, y, z values in crop pixel
+  /// space at `i * 63`, [scores] its landmark score at i and [handedness]
+  /// 0 (left) or 1 (right) at i. The lists may be views into the sections
+  /// of a [PackedHands].
+  Future<void> runInto(
+    List<cv.Mat> roiImages,
+    Float32List landmarks,
+    Float32List scores,
+    Float32List handedness, {
+    DetectionStats? stats,
+  }) async {
+    if (!_isInitialized) {
+      throw StateError(
+          'HandLandmarkModelRunner not initialized. Call initialize() first.');
+    }
+    if (roiImages.isEmpty) return;
+    await _runFlat(roiImages, stats,
+        (i, raw, rawOffset, rawScore, rawHandedness, crop) {
+      _writeLandmarks(raw, rawOffset, crop, landmarks, i * _landmarkFloats);
+      scores[i] = _sigmoid(rawScore);
+      handedness[i] = rawHandedness > 0.5 ? 1 : 0;
+      return i;
+    });
+  }
+
+  /// Runs [roiImages] on the batch interpreter in chunks of up to
+  /// [_maxBatch] crops, and single crops on the pool, parsing each crop's
+  /// outputs with [parse].
+  Future<List<T>> _runFlat<T>(
+    List<cv.Mat> roiImages,
+    DetectionStats? stats,
+    _OutputParser<T> parse,
+  ) async {
+    final n = roiImages.length;
+    final batch = _batchInstance != null ? _maxBatch : 1;
+    final results = <T>[];
+    for (int first = 0; first < n; first += batch) {
+      final crops = roiImages.sublist(first, math.min(n, first + batch));
+      results.addAll(await _withInterpreterLock(
+        stats: stats,
+        batched: crops.length > 1,
+        (instance) => _invoke(instance, crops, first, stats, parse),
+      ));
+    }
+    return results;
+  }
 
-      // Calculate padding info for coordinate transformation
-      // resize_scale = resized_dim / original_dim (how much we scaled down)
-      final resizeScaleH = resizedImage.rows / roiImage.rows;
-      final resizeScaleW = resizedImage.cols / roiImage.cols;
-      final padH = paddedImage.rows - resizedImage.rows;
-      final padW = paddedImage.cols - resizedImage.cols;
-      final halfPadH = math.max(0, padH ~/ 2).toDouble();
-      final halfPadW = math.max(0, padW ~/ 2).toDouble();
-
-      // Convert to flat Float32List tensor with normalization (BGR -> RGB)
-      ImageUtils.matToFloat32Tensor(paddedImage, buffer: instance.inputBuffer);
-
-      // Clean up OpenCV Mats
-      resizedImage.dispose();
-      paddedImage.dispose();
-
-      // Run inference using IsolateInterpreter for thread safety
-      await instance.isolateInterpreter.runForMultipleInputs(
-        [instance.inputBuffer.buffer],
+  /// Runs [roiImages] in one inference of [instance] through the flat
+  /// buffers, or in place on the tensor memory, encoding the input and
+  /// dequantizing outputs for quantized models, and parses each crop's
+  /// outputs with [parse] straight from the flat landmark output. Crop i is
+  /// passed to [parse] as `first + i`.
+  Future<List<T>> _invoke<T>(
+    _InterpreterInstance instance,
+    List<cv.Mat> roiImages,
+    int first,
+    DetectionStats? stats,
+    _OutputParser<T> parse,
+  ) async {
+    final watch = Stopwatch()..start();
+    final n = roiImages.length;
+    final memory = instance.memory;
+    final ByteBuffer inputBuffer;
+    final List<LetterboxInfo> letterboxes;
+    final inputBytes = memory != null && _inputQuant.isQuantized
+        ? memory.inputBytes(0)
+        : instance.batchInputBytes;
+    if (inputBytes != null) {
+      inputBuffer = inputBytes.buffer;
+      letterboxes = [
+        for (int i = 0; i < n; i++)
+          ImageUtils.letterboxToUint8Tensor(
+            roiImages[i],
+            inputSize,
+            inputSize,
+            Uint8List.sublistView(
+                inputBytes, i * _inputFloats, (i + 1) * _inputFloats),
+            lut: _inputLut,
+            scratch: arena?.landmarkLetterbox,
+          ),
+      ];
+    } else {
+      final input = memory?.inputFloats(0) ?? instance.batchInput!;
+      inputBuffer = input.buffer;
+      letterboxes = [
+        for (int i = 0; i < n; i++)
+          ImageUtils.letterboxToTensor(
+            roiImages[i],
+            inputSize,
+            inputSize,
+            Float32List.sublistView(
+                input, i * _inputFloats, (i + 1) * _inputFloats),
+            scratch: arena?.landmarkLetterbox,
+          ),
+      ];
+    }
+
+    stats?.landmarkPreprocess += watch.elapsed;
+    watch.reset();
+    if (memory != null) {
+      await memory.invoke();
+    } else {
+      final outputs = [
+        instance.batchLandmarks!,
+        instance.batchScores!,
+        instance.batchHandedness!,
+        instance.batchWorldLandmarks!,
+      ];
+      final outputBytes = instance.batchOutputBytes;
+      await instance.run(
+        [inputBuffer],
         {
-          0: instance.outputLandmarks,
-          1: instance.outputScore,
-          2: instance.outputHandedness,
-          3: instance.outputWorldLandmarks,
+          for (int k = 0; k < outputs.length; k++)
+            k: (outputBytes?[k] ?? outputs[k]).buffer,
         },
       );
-
-      // Parse landmarks and transform to original crop pixel space
-      // This matches Python's postprocessing: (raw - half_pad) / resize_scale
-      return _parseLandmarks(
-        instance.outputLandmarks,
-        instance.outputScore,
-        instance.outputHandedness,
-        halfPadW: halfPadW,
-        halfPadH: halfPadH,
-        resizeScaleW: resizeScaleW,
-        resizeScaleH: resizeScaleH,
-        cropWidth: roiImage.cols,
-        cropHeight: roiImage.rows,
+    }
+    stats?.landmarkInference.add(watch.elapsed);
+    watch.reset();
+    // World landmarks (output 3) are not used.
+    final landmarks = _flatOutput(instance, 0, instance.batchLandmarks);
+    final scores = _flatOutput(instance, 1, instance.batchScores);
+    final handedness = _flatOutput(instance, 2, instance.batchHandedness);
+
+    final results = List<T>.generate(n, (i) {
+      return parse(
+        first + i,
+        landmarks,
+        i * _landmarkFloats,
+        scores[i],
+        handedness[i],
+        _cropMapping(roiImages[i], letterboxes[i]),
       );
     });
+    stats?.resultBuilding += watch.elapsed;
+    return results;
+  }
+
+  /// Float output [index] of [instance] after a flat inference: the output
+  /// tensor itself with tensor memory, otherwise [buffer] as copied by the
+  /// interpreter. Quantized outputs are dequantized into [buffer].
+  Float32List _flatOutput(
+    _InterpreterInstance instance,
+    int index,
+    Float32List? buffer,
+  ) {
+    final memory = instance.memory;
+    final quant = _outputQuant[index];
+    if (quant.isQuantized) {
+      final bytes =
+          memory?.outputBytes(index) ?? instance.batchOutputBytes![index]!;
+      quant.dequantize(bytes, buffer!);
+      return buffer;
+    }
+    return memory?.outputFloats(index) ?? buffer!;
   }
 
+  /// Padding and scale of [letterbox] for coordinate transformation.
+  /// resize_scale = resized_dim / original_dim (how much we scaled down)
+  static _CropMapping _cropMapping(cv.Mat roi, LetterboxInfo letterbox) => (
+        halfPadW: math.max(0, letterbox.padLeft).toDouble(),
+        halfPadH: math.max(0, letterbox.padTop).toDouble(),
+        resizeScaleW: letterbox.resizedWidth / roi.cols,
+        resizeScaleH: letterbox.resizedHeight / roi.rows,
+        cropWidth: roi.cols,
+        cropHeight: roi.rows,
+      );
+
+  static double _sigmoid(double x) => 1.0 / (1.0 + math.exp(-x));
+
   /// Parses model outputs into HandLandmarks.
   ///
-  /// The model outputs:
-  /// - landmarks: [1, 63] - 21 points × 3 (x, y, z) in 224x224 space
-  /// - score: [1, 1] - hand confidence (0-1 after sigmoid)
-  /// - handedness: [1, 1] - 0=left, 1=right
+  /// Takes one hand's model outputs:
+  /// - [raw]: from [rawOffset], 63 values - 21 points × 3 (x, y, z) in
+  ///   224x224 space
+  /// - [rawScore]: hand confidence (0-1 after sigmoid)
+  /// - [rawHandedness]: 0=left, 1=right
   ///
-  /// Transforms landmarks from 224x224 padded space to original crop pixel space
-  /// using the exact formula from Python hand_landmark.py:
-  /// rrn_lms = rrn_lms / input_h
-  /// rescaled_xy[:, 0] = (rescaled_xy[:, 0] * input_w - half_pad_size[0]) / resize_scale[0]
-  /// rescaled_xy[:, 1] = (rescaled_xy[:, 1] * input_h - half_pad_size[1]) / resize_scale[1]
+  /// Landmarks are transformed to crop pixel space by [_writeLandmarks].
   HandLandmarks _parseLandmarks(
-    List<List<double>> landmarksData,
-    List<List<double>> scoreData,
-    List<List<double>> handednessData, {
-    required double halfPadW,
-    required double halfPadH,
-    required double resizeScaleW,
-    required double resizeScaleH,
-    required int cropWidth,
-    required int cropHeight,
-  }) {
+    int index,
+    Float32List raw,
+    int rawOffset,
+    double rawScore,
+    double rawHandedness,
+    _CropMapping crop,
+  ) {
     // Apply sigmoid to score
-    final rawScore = scoreData[0][0];
-    final score = 1.0 / (1.0 + math.exp(-rawScore));
+    final score = _sigmoid(rawScore);
 
     // Determine handedness (>0.5 = right hand)
-    final rawHandedness = handednessData[0][0];
     final handedness = rawHandedness > 0.5 ? Handedness.right : Handedness.left;
 
-    // Parse 21 landmarks and transform to original crop pixel space
-    // Match Python exactly: first normalize by input_h, then multiply by input_w/input_h
-    final raw = landmarksData[0];
-    final landmarks = <HandLandmark>[];
+    final xyz = Float64List(_landmarkFloats);
+    _writeLandmarks(raw, rawOffset, crop, xyz, 0);
+    final landmarks = <HandLandmark>[
+      for (int i = 0; i < numHandLandmarks; i++)
+        HandLandmark(
+          type: HandLandmarkType.values[i],
+          x: xyz[i * 3],
+          y: xyz[i * 3 + 1],
+          z: xyz[i * 3 + 2],
+          visibility: score, // Use overall score as visibility
+        ),
+    ];
+
+    return HandLandmarks(
+      landmarks: landmarks,
+      score: score,
+      handedness: handedness,
+    );
+  }
 
+  /// Writes the 21 landmarks of [raw] from [rawOffset] into [out] from
+  /// [offset] as x, y, z in crop pixel space, clamped to the crop.
+  ///
+  /// Transforms landmarks from 224x224 padded space to original crop pixel space
+  /// using the exact formula from Python hand_landmark.py:
+  /// rrn_lms = rrn_lms / input_h
+  /// rescaled_xy[:, 0] = (rescaled_xy[:, 0] * input_w - half_pad_size[0]) / resize_scale[0]
+  /// rescaled_xy[:, 1] = (rescaled_xy[:, 1] * input_h - half_pad_size[1]) / resize_scale[1]
+  static void _writeLandmarks(
+    Float32List raw,
+    int rawOffset,
+    _CropMapping crop,
+    List<double> out,
+    int offset,
+  ) {
+    final cropWidth = crop.cropWidth.toDouble();
+    final cropHeight = crop.cropHeight.toDouble();
     for (int i = 0; i < numHandLandmarks; i++) {
       final base = i * 3;
 
@@ -410,26 +775,15 @@ class HandLandmarkModelRunner {
       // Python: rrn_lms = rrn_lms / input_h (normalize all coords by 224)
       // Python: rescaled_xy[:, 0] = (rescaled_xy[:, 0] * input_w - half_pad[0]) / resize_scale[0]
       // Python: rescaled_xy[:, 1] = (rescaled_xy[:, 1] * input_h - half_pad[1]) / resize_scale[1]
-      final normalizedX = raw[base] / inputSize;
-      final normalizedY = raw[base + 1] / inputSize;
-      final x = (normalizedX * inputSize - halfPadW) / resizeScaleW;
-      final y = (normalizedY * inputSize - halfPadH) / resizeScaleH;
-      final z = raw[base + 2]; // Z is relative depth, keep as-is
-
-      // Clamp to crop bounds
-      landmarks.add(HandLandmark(
-        type: HandLandmarkType.values[i],
-        x: x.clamp(0.0, cropWidth.toDouble()),
-        y: y.clamp(0.0, cropHeight.toDouble()),
-        z: z,
-        visibility: score, // Use overall score as visibility
-      ));
+      final normalizedX = raw[rawOffset + base] / inputSize;
+      final normalizedY = raw[rawOffset + base + 1] / inputSize;
+      final x = (normalizedX * inputSize - crop.halfPadW) / crop.resizeScaleW;
+      final y = (normalizedY * inputSize - crop.halfPadH) / crop.resizeScaleH;
+
+      // Clamp to crop bounds; Z is relative depth, keep as-is
+      out[offset + base] = x.clamp(0.0, cropWidth);
+      out[offset + base + 1] = y.clamp(0.0, cropHeight);
+      out[offset + base + 2] = raw[rawOffset + base + 2];
     }
-
-    return HandLandmarks(
-      landmarks: landmarks,
-      score: score,
-      handedness: handedness,
-    );
   }
 }
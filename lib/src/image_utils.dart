@@ -1,7 +1,10 @@
 import 'dart:math' as math;
 import 'dart:typed_data';
 import 'package:opencv_dart/opencv_dart.dart' as cv;
+import 'mat_arena.dart';
+import 'native_kernels.dart';
 import 'palm_detector.dart';
+import 'types.dart';
 
 /// Utility functions for image preprocessing and transformations using OpenCV.
 ///
@@ -9,15 +12,92 @@ import 'palm_detector.dart';
 /// conversion utilities, and rotation-aware cropping for hand detection.
 /// Uses native OpenCV operations for 10-50x better performance than pure Dart.
 class ImageUtils {
+  /// Converts a YUV 4:2:0 frame to a BGR Mat.
+  ///
+  /// Fallback for `HandDetector.detectOnYuv` when the native pipeline is not
+  /// available. Repacks the planes as contiguous I420 and converts with
+  /// OpenCV; an odd trailing row or column is dropped because I420
+  /// conversion needs even dimensions.
+  static cv.Mat yuvToBgr(YuvFrame frame) {
+    frame.validate();
+    final w = frame.width & ~1;
+    final h = frame.height & ~1;
+    if (w == 0 || h == 0) {
+      throw ArgumentError('YUV frame is too small to convert.');
+    }
+    final cw = w ~/ 2;
+    final ch = h ~/ 2;
+    final packed = Uint8List(w * h + 2 * cw * ch);
+    for (int y = 0; y < h; y++) {
+      packed.setRange(y * w, y * w + w, frame.y, y * frame.yRowStride);
+    }
+    int o = w * h;
+    for (final plane in [frame.u, frame.v]) {
+      for (int r = 0; r < ch; r++) {
+        final row = r * frame.uvRowStride;
+        for (int c = 0; c < cw; c++) {
+          packed[o++] = plane[row + c * frame.uvPixelStride];
+        }
+      }
+    }
+    final yuv = cv.Mat.fromList(h + ch, w, cv.MatType.CV_8UC1, packed);
+    try {
+      return cv.cvtColor(yuv, cv.COLOR_YUV2BGR_I420);
+    } finally {
+      yuv.dispose();
+    }
+  }
+
+  /// Width and height from the frame header of a JPEG, or null when [bytes]
+  /// is not a JPEG or has no frame header before the first scan.
+  ///
+  /// Only the marker segments are walked, so this costs nothing next to a
+  /// decode. The size is as stored: EXIF orientation is not applied.
+  static (int width, int height)? jpegSize(Uint8List bytes) {
+    if (bytes.length < 4 || bytes[0] != 0xFF || bytes[1] != 0xD8) return null;
+    int i = 2;
+    while (i + 8 < bytes.length) {
+      if (bytes[i] != 0xFF) return null;
+      final marker = bytes[i + 1];
+      if (marker == 0xFF) {
+        // Fill byte before a marker.
+        i++;
+        continue;
+      }
+      if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+        // Markers without a length field.
+        i += 2;
+        continue;
+      }
+      // SOF0-SOF15, except DHT (C4), JPG (C8) and DAC (CC).
+      if (marker >= 0xC0 &&
+          marker <= 0xCF &&
+          marker != 0xC4 &&
+          marker != 0xC8 &&
+          marker != 0xCC) {
+        final height = (bytes[i + 5] << 8) | bytes[i + 6];
+        final width = (bytes[i + 7] << 8) | bytes[i + 8];
+        return width > 0 && height > 0 ? (width, height) : null;
+      }
+      if (marker == 0xDA) return null;
+      i += 2 + ((bytes[i + 2] << 8) | bytes[i + 3]);
+    }
+    return null;
+  }
+
   /// Keeps aspect ratio while resizing and centers with padding.
   ///
   /// This matches the Python keep_aspect_resize_and_pad function.
   /// Uses OpenCV's native resize for significantly better performance.
+  ///
+  /// With [scratch], the results are written into and returned as its Mats,
+  /// which the caller must not dispose.
   static (cv.Mat padded, cv.Mat resized) keepAspectResizeAndPad(
     cv.Mat image,
     int resizeWidth,
-    int resizeHeight,
-  ) {
+    int resizeHeight, {
+    LetterboxScratch? scratch,
+  }) {
     final imageHeight = image.rows;
     final imageWidth = image.cols;
 
@@ -34,8 +114,8 @@ class ImageUtils {
     }
 
     // Resize with bilinear interpolation (INTER_LINEAR)
-    final resizedImage =
-        cv.resize(image, (newWidth, newHeight), interpolation: cv.INTER_LINEAR);
+    final resizedImage = cv.resize(image, (newWidth, newHeight),
+        dst: scratch?.resized, interpolation: cv.INTER_LINEAR);
 
     // Calculate padding for each side
     final padTop = (resizeHeight - newHeight) ~/ 2;
@@ -51,12 +131,156 @@ class ImageUtils {
       padLeft,
       padRight,
       cv.BORDER_CONSTANT,
+      dst: scratch?.padded,
       value: cv.Scalar.black,
     );
 
     return (paddedImage, resizedImage);
   }
 
+  /// Letterboxes [image] straight into [buffer] as a normalized RGB tensor.
+  ///
+  /// Equivalent to [keepAspectResizeAndPad] followed by [matToFloat32Tensor].
+  /// On Linux this runs the fused native kernel (resize, pad, BGR to RGB and
+  /// 1/255 scaling in one pass) without creating intermediate Mats; elsewhere
+  /// it falls back to the OpenCV + Dart path, using [scratch] for the
+  /// intermediate Mats when given. Crops in a [MatArena] slot are read in
+  /// place by the native kernel.
+  ///
+  /// With [region], only that rectangle of [image] is letterboxed; the
+  /// native kernel reads it in place at its offset in [image] with
+  /// [image]'s row stride, so no region view or copy is made.
+  ///
+  /// Returns the resized content size and padding needed to map model
+  /// coordinates back to [image] (or [region]).
+  static LetterboxInfo letterboxToTensor(
+    cv.Mat image,
+    int width,
+    int height,
+    Float32List buffer, {
+    LetterboxScratch? scratch,
+    cv.Rect? region,
+  }) {
+    final native = NativeKernels.instance;
+    final source = native != null ? _nativeSource(image, region) : null;
+    if (source != null) {
+      return native!.letterboxBgrToRgbF32(
+        source.data,
+        region?.width ?? image.cols,
+        region?.height ?? image.rows,
+        buffer,
+        width,
+        height,
+        srcStride: source.stride,
+      );
+    }
+
+    final view = region == null ? image : image.region(region);
+    try {
+      final (padded, resized) =
+          keepAspectResizeAndPad(view, width, height, scratch: scratch);
+      matToFloat32Tensor(padded, buffer: buffer);
+      final LetterboxInfo info = (
+        resizedWidth: resized.cols,
+        resizedHeight: resized.rows,
+        padLeft: (width - resized.cols) ~/ 2,
+        padTop: (height - resized.rows) ~/ 2,
+      );
+      if (scratch == null) {
+        resized.dispose();
+        padded.dispose();
+      }
+      return info;
+    } finally {
+      if (!identical(view, image)) view.dispose();
+    }
+  }
+
+  /// Letterboxes [image] into [buffer] as an 8-bit RGB tensor for a
+  /// uint8/int8 quantized model input.
+  ///
+  /// Same geometry as [letterboxToTensor]. Each pixel value `p` is stored as
+  /// `lut[p]` (see `TensorQuantization.pixelLut`), or copied unchanged when
+  /// [lut] is null, so no float tensor is built. On Linux this runs the
+  /// fused native kernel, reading [region] of [image] in place as
+  /// [letterboxToTensor] does.
+  static LetterboxInfo letterboxToUint8Tensor(
+    cv.Mat image,
+    int width,
+    int height,
+    Uint8List buffer, {
+    Uint8List? lut,
+    LetterboxScratch? scratch,
+    cv.Rect? region,
+  }) {
+    final native = NativeKernels.instance;
+    final source = native != null ? _nativeSource(image, region) : null;
+    if (source != null) {
+      return native!.letterboxBgrToRgbU8(
+        source.data,
+        region?.width ?? image.cols,
+        region?.height ?? image.rows,
+        buffer,
+        width,
+        height,
+        lut: lut,
+        srcStride: source.stride,
+      );
+    }
+
+    final view = region == null ? image : image.region(region);
+    try {
+      final (padded, resized) =
+          keepAspectResizeAndPad(view, width, height, scratch: scratch);
+      final data = padded.data;
+      final size = width * height * 3;
+      for (int i = 0; i < size; i += 3) {
+        if (lut == null) {
+          buffer[i] = data[i + 2];
+          buffer[i + 1] = data[i + 1];
+          buffer[i + 2] = data[i];
+        } else {
+          buffer[i] = lut[data[i + 2]];
+          buffer[i + 1] = lut[data[i + 1]];
+          buffer[i + 2] = lut[data[i]];
+        }
+      }
+      final LetterboxInfo info = (
+        resizedWidth: resized.cols,
+        resizedHeight: resized.rows,
+        padLeft: (width - resized.cols) ~/ 2,
+        padTop: (height - resized.rows) ~/ 2,
+      );
+      if (scratch == null) {
+        resized.dispose();
+        padded.dispose();
+      }
+      return info;
+    } finally {
+      if (!identical(view, image)) view.dispose();
+    }
+  }
+
+  /// The BGR888 pixels of [image], or of its [region], as the native
+  /// kernels read them: the bytes from the first pixel on, and the row
+  /// stride of [image]. Null when [image] is neither continuous nor a
+  /// [MatArena] crop.
+  static ({Uint8List data, int stride})? _nativeSource(
+    cv.Mat image,
+    cv.Rect? region,
+  ) {
+    if (image.channels != 3) return null;
+    final slot = MatArena.slotOf(image);
+    if (slot == null && !image.isContinuous) return null;
+    final data = slot?.data ?? image.data;
+    final stride = slot?.stride ?? image.cols * 3;
+    if (region == null) return (data: data, stride: stride);
+    return (
+      data: Uint8List.sublistView(data, region.y * stride + region.x * 3),
+      stride: stride,
+    );
+  }
+
   /// Crops a rotated rectangle from an image using OpenCV's warpAffine.
   ///
   /// This is used to extract hand regions with proper rotation alignment
@@ -67,12 +291,24 @@ class ImageUtils {
   /// - [image]: Source image
   /// - [palm]: Palm detection containing rotation rectangle parameters
   /// - [padding]: Whether to handle edge cases (always handled via border mode)
+  /// - [arena]: Arena providing the rotation matrix and a crop buffer. The
+  ///   returned crop is then owned by the arena: release it with
+  ///   `arena.releaseCrop(MatArena.slotOf(crop)!)` instead of disposing it.
+  /// - [outputSize]: Side of the returned crop. The square is then warped
+  ///   straight to this size, sampling as an INTER_LINEAR resize of the
+  ///   full-size crop would, instead of being cut out at source resolution.
+  /// - [pyramid]: With [outputSize], levels of [image] to sample from when
+  ///   the square is at least twice [outputSize] and inside the pyramid's
+  ///   region (see [cropBounds]), so the warp never skips source pixels.
   ///
   /// Returns the cropped and rotated hand image, or null if the crop is invalid.
   static cv.Mat? rotateAndCropRectangle(
     cv.Mat image,
     PalmDetection palm, {
     bool padding = true,
+    MatArena? arena,
+    int? outputSize,
+    ImagePyramid? pyramid,
   }) {
     final imageWidth = image.cols;
     final imageHeight = image.rows;
@@ -85,17 +321,47 @@ class ImageUtils {
     final size = (palm.sqnRrSize * math.max(imageWidth, imageHeight)).round();
     if (size <= 0) return null;
 
+    if (outputSize != null) {
+      return _warpCrop(image, palm, cx, cy, size, outputSize, arena, pyramid);
+    }
+
     // Rotation angle (positive direction to match Python, converted to degrees)
     final angleDegrees = palm.rotation * 180.0 / math.pi;
 
-    // Get rotation matrix centered at the palm center
-    final rotMat =
-        cv.getRotationMatrix2D(cv.Point2f(cx, cy), angleDegrees, 1.0);
-
     // Adjust translation to crop around the output center
     final outCx = size / 2.0;
     final outCy = size / 2.0;
 
+    if (arena != null) {
+      // getRotationMatrix2D written into the arena's matrix:
+      // [a, b, (1 - a) * cx - b * cy; -b, a, b * cx + (1 - a) * cy]
+      // with a = cos, b = sin, and the same translation adjustment as below.
+      final angle = angleDegrees * math.pi / 180.0;
+      final a = math.cos(angle);
+      final b = math.sin(angle);
+      final rotMat = arena.rotation
+        ..set<double>(0, 0, a)
+        ..set<double>(0, 1, b)
+        ..set<double>(0, 2, (1 - a) * cx - b * cy + outCx - cx)
+        ..set<double>(1, 0, -b)
+        ..set<double>(1, 1, a)
+        ..set<double>(1, 2, b * cx + (1 - a) * cy + outCy - cy);
+      final slot = arena.acquireCrop(size);
+      cv.warpAffine(
+        image,
+        rotMat,
+        (size, size),
+        dst: slot.mat,
+        borderMode: cv.BORDER_CONSTANT,
+        borderValue: cv.Scalar.black,
+      );
+      return slot.mat;
+    }
+
+    // Get rotation matrix centered at the palm center
+    final rotMat =
+        cv.getRotationMatrix2D(cv.Point2f(cx, cy), angleDegrees, 1.0);
+
     // Modify the translation in the rotation matrix:
     // M[0,2] += outCx - cx
     // M[1,2] += outCy - cy
@@ -117,6 +383,129 @@ class ImageUtils {
     return output;
   }
 
+  /// [rotateAndCropRectangle] of the [size] square at ([cx], [cy]) straight
+  /// to an [outputSize] crop.
+  ///
+  /// Output pixel d samples crop pixel u = (d + 0.5) * k - 0.5 with
+  /// k = size / outputSize, like `hand_detection_tflite_warp_crop_*` in the
+  /// native pipeline, and crop pixel u maps to the source through the same
+  /// rotation as the full-size crop. From pyramid level n, source pixel p is
+  /// level pixel (p - region origin) / 2^n.
+  static cv.Mat _warpCrop(
+    cv.Mat image,
+    PalmDetection palm,
+    double cx,
+    double cy,
+    int size,
+    int outputSize,
+    MatArena? arena,
+    ImagePyramid? pyramid,
+  ) {
+    var level = 0;
+    final bounds = pyramid != null && size >> 1 >= outputSize
+        ? cropBounds(image, palm)
+        : null;
+    if (bounds != null && pyramid!.covers(image, bounds)) {
+      while (level < ImagePyramid.maxLevels &&
+          size >> (level + 1) >= outputSize) {
+        level++;
+      }
+    }
+    final source = level == 0 ? image : pyramid!.level(level);
+    final originX = level == 0 ? 0.0 : pyramid!.region!.x.toDouble();
+    final originY = level == 0 ? 0.0 : pyramid!.region!.y.toDouble();
+
+    final k = size / outputSize;
+    final step = (1 << level) / k;
+    final a = math.cos(palm.rotation);
+    final b = math.sin(palm.rotation);
+    final dx = originX - cx;
+    final dy = originY - cy;
+    final shift = (size / 2.0 + 0.5) / k - 0.5;
+    final matrix = (arena?.rotation ?? cv.Mat.zeros(2, 3, cv.MatType.CV_64FC1))
+      ..set<double>(0, 0, a * step)
+      ..set<double>(0, 1, b * step)
+      ..set<double>(0, 2, (a * dx + b * dy) / k + shift)
+      ..set<double>(1, 0, -b * step)
+      ..set<double>(1, 1, a * step)
+      ..set<double>(1, 2, (a * dy - b * dx) / k + shift);
+
+    final output = cv.warpAffine(
+      source,
+      matrix,
+      (outputSize, outputSize),
+      dst: arena?.acquireCrop(outputSize).mat,
+      borderMode: cv.BORDER_CONSTANT,
+      borderValue: cv.Scalar.black,
+    );
+    if (arena == null) matrix.dispose();
+    return output;
+  }
+
+  /// [rotateAndCropRectangle] with [arena] and [outputSize] for a YUV 4:2:0
+  /// [frame] staged in native memory.
+  ///
+  /// [native] samples the rotated square straight out of the Y and UV
+  /// planes, converting only the [outputSize] x [outputSize] output pixels,
+  /// which are then stored as BGR in an [arena] crop slot. Release the crop
+  /// like those of [rotateAndCropRectangle].
+  ///
+  /// Returns null if the crop is invalid.
+  static cv.Mat? rotateAndCropYuv(
+    NativeKernels native,
+    NativeYuvFrame frame,
+    PalmDetection palm, {
+    required MatArena arena,
+    required int outputSize,
+  }) {
+    final longSide = math.max(frame.width, frame.height);
+    final size = (palm.sqnRrSize * longSide).round();
+    if (size <= 0) return null;
+
+    final rgb = arena.cropFloats(outputSize);
+    native.warpCropYuv420ToRgbF32(
+      frame,
+      palm.sqnRrCenterX * frame.width,
+      palm.sqnRrCenterY * frame.height,
+      palm.rotation,
+      size,
+      rgb,
+      outputSize,
+    );
+
+    final slot = arena.acquireCrop(outputSize);
+    final data = slot.data;
+    final stride = slot.stride;
+    int i = 0;
+    for (int y = 0; y < outputSize; y++) {
+      int o = y * stride;
+      for (int x = 0; x < outputSize; x++, i += 3, o += 3) {
+        // Kernel output is clamped to [0, 1].
+        data[o] = (rgb[i + 2] * 255.0 + 0.5).toInt();
+        data[o + 1] = (rgb[i + 1] * 255.0 + 0.5).toInt();
+        data[o + 2] = (rgb[i] * 255.0 + 0.5).toInt();
+      }
+    }
+    return slot.mat;
+  }
+
+  /// Source pixels covered by the rotated crop square of [palm] in [image],
+  /// clipped to the image, or null when the square lies outside it.
+  static cv.Rect? cropBounds(cv.Mat image, PalmDetection palm) {
+    final cx = palm.sqnRrCenterX * image.cols;
+    final cy = palm.sqnRrCenterY * image.rows;
+    final size = palm.sqnRrSize * math.max(image.cols, image.rows);
+    final half = size /
+        2 *
+        (math.cos(palm.rotation).abs() + math.sin(palm.rotation).abs());
+    final left = math.max(0, (cx - half).floor());
+    final top = math.max(0, (cy - half).floor());
+    final right = math.min(image.cols, (cx + half).ceil() + 1);
+    final bottom = math.min(image.rows, (cy + half).ceil() + 1);
+    if (right <= left || bottom <= top) return null;
+    return cv.Rect(left, top, right - left, bottom - top);
+  }
+
   /// Creates a rotated rectangle crop info from palm detection.
   ///
   /// Returns the crop parameters needed for landmark extraction:
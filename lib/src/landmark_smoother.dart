@@ -0,0 +1,235 @@
+import 'dart:math' as math;
+import 'dart:typed_data';
+import 'native_kernels.dart';
+import 'types.dart';
+
+/// Smoothing state of one hand followed from frame to frame.
+class _SmoothedTrack {
+  /// Filtered landmark coordinates, then their filtered derivatives.
+  final Float32List state = Float32List(2 * PackedHands.landmarkFloats);
+
+  /// Crop square of the hand in the last frame, for matching.
+  double centerX = 0;
+  double centerY = 0;
+  double size = 0;
+}
+
+/// Applies [LandmarkSmoothing] to the hands of consecutive frames.
+///
+/// Each frame's hands are matched to the previous frame's by their crop
+/// squares. The 63 landmark coordinates of all hands then go through a
+/// single One Euro pass (`hand_detection_tflite_one_euro_filter`, or the
+/// same loop in Dart where the native kernels are unavailable): the track
+/// states are gathered into one flat buffer for the pass and scattered back
+/// after it. Speeds are scaled by 1 / crop size per hand.
+class LandmarkSmoother {
+  static const int _floats = PackedHands.landmarkFloats;
+
+  /// Filter settings.
+  final LandmarkSmoothing config;
+
+  List<_SmoothedTrack> _tracks = [];
+  final Stopwatch _clock = Stopwatch();
+
+  /// Per-frame scratch, grown on demand: gathered track states (all
+  /// filtered values, then all derivatives), per-hand speed scales, and the
+  /// landmarks and crop squares of [smoothHands].
+  Float32List _state = Float32List(0);
+  Float32List _scales = Float32List(0);
+  Float32List _landmarks = Float32List(0);
+  Float32List _rotations = Float32List(0);
+
+  /// Creates a smoother with the given settings.
+  LandmarkSmoother(this.config);
+
+  /// Number of hands followed from the last frame.
+  int get trackCount => _tracks.length;
+
+  /// Forgets all hands, so the next frame passes through unsmoothed.
+  void reset() {
+    _tracks = [];
+    _clock
+      ..stop()
+      ..reset();
+  }
+
+  /// Smooths the landmarks of a packed frame in place. Frames without
+  /// landmarks are left unchanged.
+  void smoothPacked(PackedHands hands) {
+    if (!hands.hasLandmarks) return;
+    smooth(hands.landmarks, hands.data, hands.rotationsOffset, hands.length);
+  }
+
+  /// Returns [hands] with smoothed landmarks.
+  ///
+  /// Hands without landmarks or crop square ([HandMode.boxes]) are returned
+  /// unchanged.
+  List<Hand> smoothHands(List<Hand> hands) {
+    if (hands.any((h) => !h.hasLandmarks || h.rotatedSize == null)) {
+      return hands;
+    }
+    final count = hands.length;
+    if (_landmarks.length < count * _floats) {
+      _landmarks = Float32List(count * _floats);
+      _rotations = Float32List(count * 4);
+    }
+    for (int i = 0; i < count; i++) {
+      final hand = hands[i];
+      for (final lm in hand.landmarks) {
+        final k = i * _floats + lm.type.index * 3;
+        _landmarks
+          ..[k] = lm.x
+          ..[k + 1] = lm.y
+          ..[k + 2] = lm.z;
+      }
+      _rotations
+        ..[i * 4 + 1] = hand.rotatedCenterX!
+        ..[i * 4 + 2] = hand.rotatedCenterY!
+        ..[i * 4 + 3] = hand.rotatedSize!;
+    }
+    smooth(_landmarks, _rotations, 0, count);
+
+    return [
+      for (int i = 0; i < count; i++)
+        Hand(
+          boundingBox: hands[i].boundingBox,
+          score: hands[i].score,
+          landmarks: [
+            for (final lm in hands[i].landmarks)
+              HandLandmark(
+                type: lm.type,
+                x: _landmarks[i * _floats + lm.type.index * 3],
+                y: _landmarks[i * _floats + lm.type.index * 3 + 1],
+                z: _landmarks[i * _floats + lm.type.index * 3 + 2],
+                visibility: lm.visibility,
+              ),
+          ],
+          imageWidth: hands[i].imageWidth,
+          imageHeight: hands[i].imageHeight,
+          handedness: hands[i].handedness,
+          rotation: hands[i].rotation,
+          rotatedCenterX: hands[i].rotatedCenterX,
+          rotatedCenterY: hands[i].rotatedCenterY,
+          rotatedSize: hands[i].rotatedSize,
+        ),
+    ];
+  }
+
+  /// Smooths [count] hands in place: [landmarks] holds 63 floats per hand
+  /// and [rotations], from [rotationsOffset], 4 per hand (rotation, crop
+  /// center x and y, crop size) as in [PackedHands].
+  void smooth(
+    Float32List landmarks,
+    Float32List rotations,
+    int rotationsOffset,
+    int count,
+  ) {
+    final dt = _frameInterval();
+    final n = count * _floats;
+    if (_state.length < 2 * n) {
+      _state = Float32List(2 * n);
+      _scales = Float32List(count);
+    }
+
+    final previous = _tracks;
+    final tracks = <_SmoothedTrack>[];
+    for (int i = 0; i < count; i++) {
+      final r = rotationsOffset + i * 4;
+      final centerX = rotations[r + 1];
+      final centerY = rotations[r + 2];
+      final size = rotations[r + 3];
+      var track = _match(previous, centerX, centerY, size);
+      if (track == null) {
+        // A (value, 0) state passes the first sample through.
+        track = _SmoothedTrack();
+        track.state.setRange(0, _floats, landmarks, i * _floats);
+      }
+      track
+        ..centerX = centerX
+        ..centerY = centerY
+        ..size = size;
+      tracks.add(track);
+      _state.setRange(i * _floats, (i + 1) * _floats, track.state);
+      _state.setRange(
+          n + i * _floats, n + (i + 1) * _floats, track.state, _floats);
+      _scales[i] = size > 0 ? 1 / size : 0;
+    }
+
+    if (n > 0) {
+      final kernels = NativeKernels.instance;
+      if (kernels != null) {
+        kernels.oneEuroFilter(landmarks, _state, n, _floats, _scales, dt,
+            config.minCutoff, config.beta, config.derivativeCutoff);
+      } else {
+        _filter(landmarks, n, dt);
+      }
+    }
+
+    for (int i = 0; i < count; i++) {
+      final state = tracks[i].state;
+      state.setRange(0, _floats, _state, i * _floats);
+      state.setRange(_floats, 2 * _floats, _state, n + i * _floats);
+    }
+    _tracks = tracks;
+  }
+
+  /// Seconds since the previous frame: 1 / [LandmarkSmoothing.frameRate]
+  /// when set, wall time otherwise.
+  double _frameInterval() {
+    final frameRate = config.frameRate;
+    if (frameRate != null) return 1 / frameRate;
+    if (!_clock.isRunning) {
+      // First frame: every hand is new and passes through.
+      _clock.start();
+      return 1 / 30;
+    }
+    final seconds = _clock.elapsedMicroseconds / 1e6;
+    _clock.reset();
+    return math.max(seconds, 1e-3);
+  }
+
+  /// Removes and returns the track of [previous] nearest to a crop square
+  /// at ([centerX], [centerY]), if within half a hand size of it.
+  static _SmoothedTrack? _match(
+    List<_SmoothedTrack> previous,
+    double centerX,
+    double centerY,
+    double size,
+  ) {
+    int best = -1;
+    double bestDistance = double.infinity;
+    for (int j = 0; j < previous.length; j++) {
+      final track = previous[j];
+      final dx = centerX - track.centerX;
+      final dy = centerY - track.centerY;
+      final distance = math.sqrt(dx * dx + dy * dy);
+      if (distance < 0.5 * math.max(size, track.size) &&
+          distance < bestDistance) {
+        best = j;
+        bestDistance = distance;
+      }
+    }
+    return best < 0 ? null : previous.removeAt(best);
+  }
+
+  /// Dart version of `hand_detection_tflite_one_euro_filter` over the
+  /// gathered state.
+  void _filter(Float32List values, int n, double dt) {
+    final step = 2 * math.pi * dt;
+    final derivativeAlpha = step *
+        config.derivativeCutoff /
+        (step * config.derivativeCutoff + 1);
+    for (int i = 0; i < n; i++) {
+      final filtered = _state[i];
+      final derivative = _state[n + i];
+      final delta = values[i] - filtered;
+      final dx = derivative + derivativeAlpha * (delta / dt - derivative);
+      final r = step *
+          (config.minCutoff + config.beta * _scales[i ~/ _floats] * dx.abs());
+      final x = filtered + r / (r + 1) * delta;
+      _state[n + i] = dx;
+      _state[i] = x;
+      values[i] = x;
+    }
+  }
+}
@@ -0,0 +1,235 @@
+import 'dart:typed_data';
+import 'package:opencv_dart/opencv_dart.dart' as cv;
+
+/// A reusable square BGR crop buffer leased from a [MatArena].
+///
+/// The pixels live in a [capacity] x [capacity] backing Mat that only grows;
+/// [mat] is a view of its top-left [size] x [size] corner. The view is
+/// rebuilt only when the crop size changes, and the backing buffer only
+/// when a crop exceeds the capacity.
+class CropSlot {
+  cv.Mat? _backing;
+  cv.Mat? _view;
+  int _capacity = 0;
+  int _size = 0;
+
+  /// Side of the current crop in pixels.
+  int get size => _size;
+
+  /// Side of the backing buffer in pixels.
+  int get capacity => _capacity;
+
+  /// The current crop: a view into the backing buffer, continuous only when
+  /// [size] equals [capacity].
+  cv.Mat get mat => _view!;
+
+  /// Backing buffer bytes, starting at the crop's first pixel, with rows
+  /// [stride] bytes apart.
+  Uint8List get data => _backing!.data;
+
+  /// Bytes between crop rows.
+  int get stride => _capacity * 3;
+
+  /// Makes [mat] a [size] x [size] view, growing the backing buffer to a
+  /// multiple of [MatArena.cropGranularity] when it is too small.
+  void _resize(int size) {
+    if (size > _capacity) {
+      _view?.dispose();
+      _backing?.dispose();
+      _view = null;
+      _capacity = (size + MatArena.cropGranularity - 1) ~/
+          MatArena.cropGranularity *
+          MatArena.cropGranularity;
+      _backing = cv.Mat.zeros(_capacity, _capacity, cv.MatType.CV_8UC3);
+    }
+    if (_view == null || size != _size) {
+      _view?.dispose();
+      final view = _backing!.region(cv.Rect(0, 0, size, size));
+      MatArena._slots[view] = this;
+      _view = view;
+      _size = size;
+    }
+  }
+
+  void _dispose() {
+    _view?.dispose();
+    _backing?.dispose();
+    _view = null;
+    _backing = null;
+    _capacity = 0;
+    _size = 0;
+  }
+}
+
+/// Reusable intermediate Mats for the OpenCV letterbox fallback
+/// (`ImageUtils.keepAspectResizeAndPad`).
+///
+/// OpenCV reallocates an output Mat only when its size changes, so a stage
+/// with a fixed input size reuses both buffers on every frame.
+class LetterboxScratch {
+  cv.Mat? _resized;
+  cv.Mat? _padded;
+
+  /// Output of the aspect-preserving resize.
+  cv.Mat get resized => _resized ??= cv.Mat.empty();
+
+  /// Output of the padding step.
+  cv.Mat get padded => _padded ??= cv.Mat.empty();
+
+  void _dispose() {
+    _resized?.dispose();
+    _padded?.dispose();
+    _resized = null;
+    _padded = null;
+  }
+}
+
+/// Halvings of one region of a frame, for crops much larger than their
+/// output size.
+///
+/// Level n is the region after n `pyrDown` steps, so its pixel q samples
+/// the low-pass filtered region pixel `q * 2^n`. Levels are built on
+/// demand, at most once per [reset], and shared by every crop inside
+/// [region]. Their buffers are kept for the next frame.
+class ImagePyramid {
+  /// Maximum number of halvings.
+  static const int maxLevels = 4;
+
+  final List<cv.Mat> _levels = [];
+  cv.Mat? _source;
+  cv.Mat? _view;
+  cv.Rect? _region;
+  int _built = 0;
+
+  /// Region of the current source the levels cover, in source pixels.
+  cv.Rect? get region => _region;
+
+  /// Starts a pyramid over [region] of [source].
+  void reset(cv.Mat source, cv.Rect region) {
+    clear();
+    _source = source;
+    _region = region;
+    _view = source.region(region);
+  }
+
+  /// Whether the levels cover [rect] of [source].
+  bool covers(cv.Mat source, cv.Rect rect) {
+    final region = _region;
+    return region != null &&
+        identical(source, _source) &&
+        rect.x >= region.x &&
+        rect.y >= region.y &&
+        rect.x + rect.width <= region.x + region.width &&
+        rect.y + rect.height <= region.y + region.height;
+  }
+
+  /// Level [index], 1 to [maxLevels], building it and the levels below on
+  /// first use.
+  cv.Mat level(int index) {
+    while (_built < index) {
+      if (_levels.length == _built) _levels.add(cv.Mat.empty());
+      final below = _built == 0 ? _view! : _levels[_built - 1];
+      cv.pyrDown(below, dst: _levels[_built]);
+      _built++;
+    }
+    return _levels[index - 1];
+  }
+
+  /// Detaches the pyramid from its source, keeping the level buffers.
+  void clear() {
+    _view?.dispose();
+    _view = null;
+    _source = null;
+    _region = null;
+    _built = 0;
+  }
+
+  void _dispose() {
+    clear();
+    for (final level in _levels) {
+      level.dispose();
+    }
+    _levels.clear();
+  }
+}
+
+/// Preallocated OpenCV buffers reused from frame to frame by one detector.
+///
+/// Holds the rotation matrix, crop buffers and crop pyramid of
+/// `rotateAndCropRectangle` and the letterbox scratch Mats of the palm and
+/// landmark stages. Once the
+/// crop buffers have grown to the largest hand seen, steady-state detection
+/// allocates no pixel buffers: only small view headers are created when a
+/// crop changes size. This avoids the allocator churn and heap
+/// fragmentation of per-frame Mats in long-running processes.
+///
+/// Crop slots are leased with [acquireCrop] and returned with
+/// [releaseCrop], so overlapping detection calls never share a slot. The
+/// arena allocates lazily and can be reused after [dispose].
+class MatArena {
+  /// Crop buffers grow in steps of this many pixels per side, so a hand
+  /// that slowly gets bigger does not reallocate on every frame.
+  static const int cropGranularity = 64;
+
+  static final Expando<CropSlot> _slots = Expando<CropSlot>('CropSlot');
+
+  /// The slot whose buffer [mat] is a view of, or null for other Mats.
+  static CropSlot? slotOf(cv.Mat mat) => _slots[mat];
+
+  final List<CropSlot> _free = [];
+  final List<CropSlot> _leased = [];
+  cv.Mat? _rotation;
+  Float32List _cropFloats = Float32List(0);
+
+  /// Scratch Mats of the palm stage letterbox.
+  final LetterboxScratch palmLetterbox = LetterboxScratch();
+
+  /// Scratch Mats of the landmark stage letterbox.
+  final LetterboxScratch landmarkLetterbox = LetterboxScratch();
+
+  /// Downscaled levels of the frame being cropped.
+  final ImagePyramid cropPyramid = ImagePyramid();
+
+  /// 2x3 CV_64F matrix for affine crops.
+  cv.Mat get rotation =>
+      _rotation ??= cv.Mat.zeros(2, 3, cv.MatType.CV_64FC1);
+
+  /// RGB float crop of [size] x [size] pixels, sampled natively from a YUV
+  /// frame before it is stored in a crop slot. Grown on demand.
+  Float32List cropFloats(int size) {
+    final length = size * size * 3;
+    if (_cropFloats.length < length) _cropFloats = Float32List(length);
+    return Float32List.sublistView(_cropFloats, 0, length);
+  }
+
+  /// Number of crop slots allocated so far.
+  int get cropSlots => _free.length + _leased.length;
+
+  /// Leases a slot whose [CropSlot.mat] is a [size] x [size] crop buffer.
+  CropSlot acquireCrop(int size) {
+    final slot = _free.isEmpty ? CropSlot() : _free.removeLast();
+    slot._resize(size);
+    _leased.add(slot);
+    return slot;
+  }
+
+  /// Returns [slot] to the arena for reuse by a later crop.
+  void releaseCrop(CropSlot slot) {
+    if (_leased.remove(slot)) _free.add(slot);
+  }
+
+  /// Frees all native buffers. Leased slots become invalid.
+  void dispose() {
+    for (final slot in [..._free, ..._leased]) {
+      slot._dispose();
+    }
+    _free.clear();
+    _leased.clear();
+    _rotation?.dispose();
+    _rotation = null;
+    _cropFloats = Float32List(0);
+    cropPyramid._dispose();
+    palmLetterbox._dispose();
+    landmarkLetterbox._dispose();
+  }
+}
@@ -0,0 +1,591 @@
+import 'dart:ffi' as ffi;
+import 'dart:io';
+import 'dart:math' as math;
+import 'dart:typed_data';
+import 'package:ffi/ffi.dart';
+import 'package:meta/meta.dart';
+import 'package:path/path.dart' as p;
+import 'types.dart';
+
+typedef _LetterboxNative = ffi.Int32 Function(
+  ffi.Pointer<ffi.Uint8> src,
+  ffi.Int32 srcWidth,
+  ffi.Int32 srcHeight,
+  ffi.Int32 srcStride,
+  ffi.Pointer<ffi.Float> dst,
+  ffi.Int32 dstWidth,
+  ffi.Int32 dstHeight,
+  ffi.Pointer<ffi.Int32> info,
+);
+typedef _LetterboxDart = int Function(
+  ffi.Pointer<ffi.Uint8> src,
+  int srcWidth,
+  int srcHeight,
+  int srcStride,
+  ffi.Pointer<ffi.Float> dst,
+  int dstWidth,
+  int dstHeight,
+  ffi.Pointer<ffi.Int32> info,
+);
+
+typedef _LetterboxU8Native = ffi.Int32 Function(
+  ffi.Pointer<ffi.Uint8> src,
+  ffi.Int32 srcWidth,
+  ffi.Int32 srcHeight,
+  ffi.Int32 srcStride,
+  ffi.Pointer<ffi.Uint8> dst,
+  ffi.Int32 dstWidth,
+  ffi.Int32 dstHeight,
+  ffi.Pointer<ffi.Uint8> lut,
+  ffi.Pointer<ffi.Int32> info,
+);
+typedef _LetterboxU8Dart = int Function(
+  ffi.Pointer<ffi.Uint8> src,
+  int srcWidth,
+  int srcHeight,
+  int srcStride,
+  ffi.Pointer<ffi.Uint8> dst,
+  int dstWidth,
+  int dstHeight,
+  ffi.Pointer<ffi.Uint8> lut,
+  ffi.Pointer<ffi.Int32> info,
+);
+
+typedef _LetterboxYuvNative = ffi.Int32 Function(
+  ffi.Pointer<NativeYuv420Image> src,
+  ffi.Int32 srcWidth,
+  ffi.Int32 srcHeight,
+  ffi.Pointer<ffi.Float> dst,
+  ffi.Int32 dstWidth,
+  ffi.Int32 dstHeight,
+  ffi.Pointer<ffi.Int32> info,
+);
+typedef _LetterboxYuvDart = int Function(
+  ffi.Pointer<NativeYuv420Image> src,
+  int srcWidth,
+  int srcHeight,
+  ffi.Pointer<ffi.Float> dst,
+  int dstWidth,
+  int dstHeight,
+  ffi.Pointer<ffi.Int32> info,
+);
+
+typedef _WarpCropYuvNative = ffi.Int32 Function(
+  ffi.Pointer<NativeYuv420Image> src,
+  ffi.Int32 srcWidth,
+  ffi.Int32 srcHeight,
+  ffi.Float centerX,
+  ffi.Float centerY,
+  ffi.Float rotation,
+  ffi.Int32 cropSize,
+  ffi.Pointer<ffi.Float> dst,
+  ffi.Int32 dstSize,
+);
+typedef _WarpCropYuvDart = int Function(
+  ffi.Pointer<NativeYuv420Image> src,
+  int srcWidth,
+  int srcHeight,
+  double centerX,
+  double centerY,
+  double rotation,
+  int cropSize,
+  ffi.Pointer<ffi.Float> dst,
+  int dstSize,
+);
+
+typedef _DequantizeNative = ffi.Int32 Function(
+  ffi.Pointer<ffi.Uint8> src,
+  ffi.Int32 tensorType,
+  ffi.Int32 count,
+  ffi.Float scale,
+  ffi.Int32 zeroPoint,
+  ffi.Pointer<ffi.Float> dst,
+);
+typedef _DequantizeDart = int Function(
+  ffi.Pointer<ffi.Uint8> src,
+  int tensorType,
+  int count,
+  double scale,
+  int zeroPoint,
+  ffi.Pointer<ffi.Float> dst,
+);
+
+typedef _DecodePalmsNative = ffi.Int32 Function(
+  ffi.Pointer<ffi.Float> rawBoxes,
+  ffi.Pointer<ffi.Float> rawScores,
+  ffi.Int32 numAnchors,
+  ffi.Pointer<ffi.Float> anchors,
+  ffi.Float scoreThreshold,
+  ffi.Float inputSize,
+  ffi.Int32 imageWidth,
+  ffi.Int32 imageHeight,
+  ffi.Pointer<ffi.Float> out,
+  ffi.Int32 maxOut,
+);
+typedef _DecodePalmsDart = int Function(
+  ffi.Pointer<ffi.Float> rawBoxes,
+  ffi.Pointer<ffi.Float> rawScores,
+  int numAnchors,
+  ffi.Pointer<ffi.Float> anchors,
+  double scoreThreshold,
+  double inputSize,
+  int imageWidth,
+  int imageHeight,
+  ffi.Pointer<ffi.Float> out,
+  int maxOut,
+);
+
+typedef _OneEuroNative = ffi.Int32 Function(
+  ffi.Pointer<ffi.Float> values,
+  ffi.Pointer<ffi.Float> state,
+  ffi.Int32 count,
+  ffi.Int32 groupSize,
+  ffi.Pointer<ffi.Float> scales,
+  ffi.Float dt,
+  ffi.Float minCutoff,
+  ffi.Float beta,
+  ffi.Float derivativeCutoff,
+);
+typedef _OneEuroDart = int Function(
+  ffi.Pointer<ffi.Float> values,
+  ffi.Pointer<ffi.Float> state,
+  int count,
+  int groupSize,
+  ffi.Pointer<ffi.Float> scales,
+  double dt,
+  double minCutoff,
+  double beta,
+  double derivativeCutoff,
+);
+
+/// Mirrors `HandYuv420Image` in `linux/include/hand_detection_tflite/hand_detection_tflite_kernels.h`.
+final class NativeYuv420Image extends ffi.Struct {
+  external ffi.Pointer<ffi.Uint8> y;
+
+  external ffi.Pointer<ffi.Uint8> u;
+
+  external ffi.Pointer<ffi.Uint8> v;
+
+  @ffi.Int32()
+  external int yStride;
+
+  @ffi.Int32()
+  external int uvStride;
+
+  @ffi.Int32()
+  external int uvPixelStride;
+}
+
+/// A [YuvFrame] copied into native memory, where the YUV kernels and
+/// `hand_pipeline_detect_yuv420` can read it.
+///
+/// The planes are copied as-is; planes that are views of one buffer
+/// (packed NV12/NV21/I420) are copied as a single span. The native buffer
+/// only grows, so staging frames of one size allocates once.
+class NativeYuvFrame {
+  /// The staged frame, valid until the next [stage] or [dispose].
+  final ffi.Pointer<NativeYuv420Image> image = calloc<NativeYuv420Image>();
+
+  ffi.Pointer<ffi.Uint8> _data = ffi.nullptr;
+  int _capacity = 0;
+
+  /// Size of the staged frame in pixels.
+  int width = 0;
+  int height = 0;
+
+  /// Copies [frame]'s planes into native memory and points [image] at them.
+  void stage(YuvFrame frame) {
+    frame.validate();
+    final planes = [frame.y, frame.u, frame.v];
+    final spans = <({ByteBuffer buffer, int start, int end})>[];
+    final spanIndex = <int>[];
+    for (final plane in planes) {
+      final start = plane.offsetInBytes;
+      final end = start + plane.lengthInBytes;
+      final i = spans.indexWhere((s) => s.buffer == plane.buffer);
+      if (i < 0) {
+        spanIndex.add(spans.length);
+        spans.add((buffer: plane.buffer, start: start, end: end));
+      } else {
+        spanIndex.add(i);
+        final s = spans[i];
+        spans[i] = (
+          buffer: s.buffer,
+          start: math.min(s.start, start),
+          end: math.max(s.end, end),
+        );
+      }
+    }
+
+    final offsets = <int>[];
+    int total = 0;
+    for (final s in spans) {
+      offsets.add(total);
+      total += s.end - s.start;
+    }
+    if (total > _capacity) {
+      if (_data != ffi.nullptr) malloc.free(_data);
+      _data = malloc<ffi.Uint8>(total);
+      _capacity = total;
+    }
+    final staging = _data.asTypedList(total);
+    for (int i = 0; i < spans.length; i++) {
+      final s = spans[i];
+      staging.setAll(
+          offsets[i], s.buffer.asUint8List(s.start, s.end - s.start));
+    }
+
+    ffi.Pointer<ffi.Uint8> planeAddress(int i) {
+      final span = spans[spanIndex[i]];
+      return _data +
+          offsets[spanIndex[i]] +
+          (planes[i].offsetInBytes - span.start);
+    }
+
+    image.ref
+      ..y = planeAddress(0)
+      ..u = planeAddress(1)
+      ..v = planeAddress(2)
+      ..yStride = frame.yRowStride
+      ..uvStride = frame.uvRowStride
+      ..uvPixelStride = frame.uvPixelStride;
+    width = frame.width;
+    height = frame.height;
+  }
+
+  /// Frees the native memory.
+  void dispose() {
+    calloc.free(image);
+    if (_data != ffi.nullptr) malloc.free(_data);
+    _data = ffi.nullptr;
+    _capacity = 0;
+  }
+}
+
+/// Geometry of a letterboxed model input.
+///
+/// Mirrors the values implied by `ImageUtils.keepAspectResizeAndPad`: the size
+/// of the resized content and the left/top padding around it.
+typedef LetterboxInfo = ({
+  int resizedWidth,
+  int resizedHeight,
+  int padLeft,
+  int padTop,
+});
+
+/// FFI bindings to the native kernels compiled into the plugin library.
+///
+/// The kernels live in `linux/hand_detection_tflite_kernels.cc` and are only
+/// built for Linux. On other platforms (or when the library cannot be found,
+/// e.g. under `flutter test`) [instance] is null and callers fall back to the
+/// Dart/OpenCV implementation.
+class NativeKernels {
+  final _LetterboxDart _letterbox;
+  final _LetterboxU8Dart _letterboxU8;
+  final _LetterboxYuvDart _letterboxYuv;
+  final _WarpCropYuvDart _warpCropYuv;
+  final _DequantizeDart _dequantize;
+  final _DecodePalmsDart _decodePalms;
+  final _OneEuroDart _oneEuro;
+
+  /// Native code of a uint8 tensor (`TfLiteType`).
+  static const int tensorUint8 = 3;
+
+  /// Native code of an int8 tensor (`TfLiteType`).
+  static const int tensorInt8 = 9;
+
+  /// Number of floats per packed palm in [decodePalms] output:
+  /// `[score, sqnRrSize, rotation, sqnRrCenterX, sqnRrCenterY]`.
+  static const int palmStride = 5;
+
+  /// Reusable output for letterbox geometry.
+  final Int32List _info = Int32List(4);
+
+  NativeKernels._(ffi.DynamicLibrary lib)
+      : _letterbox = lib.lookupFunction<_LetterboxNative, _LetterboxDart>(
+          'hand_detection_tflite_letterbox_bgr_to_rgb_f32',
+          isLeaf: true,
+        ),
+        _letterboxU8 = lib.lookupFunction<_LetterboxU8Native, _LetterboxU8Dart>(
+          'hand_detection_tflite_letterbox_bgr_to_rgb_u8',
+          isLeaf: true,
+        ),
+        _letterboxYuv = lib.lookupFunction<_LetterboxYuvNative,
+            _LetterboxYuvDart>(
+          'hand_detection_tflite_letterbox_yuv420_to_rgb_f32',
+          isLeaf: true,
+        ),
+        _warpCropYuv = lib.lookupFunction<_WarpCropYuvNative, _WarpCropYuvDart>(
+          'hand_detection_tflite_warp_crop_yuv420_to_rgb_f32',
+          isLeaf: true,
+        ),
+        _dequantize = lib.lookupFunction<_DequantizeNative, _DequantizeDart>(
+          'hand_detection_tflite_dequantize',
+          isLeaf: true,
+        ),
+        _decodePalms = lib.lookupFunction<_DecodePalmsNative, _DecodePalmsDart>(
+          'hand_detection_tflite_decode_palms',
+          isLeaf: true,
+        ),
+        _oneEuro = lib.lookupFunction<_OneEuroNative, _OneEuroDart>(
+          'hand_detection_tflite_one_euro_filter',
+          isLeaf: true,
+        );
+
+  static NativeKernels? _instance;
+  static bool _loadAttempted = false;
+
+  /// Returns the loaded kernels, or null when unavailable on this platform.
+  static NativeKernels? get instance {
+    if (!_loadAttempted) {
+      _loadAttempted = true;
+      _instance = _load(Platform.environment, _platformString());
+    }
+    return _instance;
+  }
+
+  /// Whether native kernels are available in this process.
+  static bool get isAvailable => instance != null;
+
+  static NativeKernels? _load(Map<String, String> env, String platform) {
+    // Optional override for local testing: set HAND_NATIVE_LIB to an absolute path.
+    final envLibPath = env['HAND_NATIVE_LIB'];
+    final candidates = <String>[
+      if (envLibPath != null && envLibPath.isNotEmpty) envLibPath,
+    ];
+
+    if (platform == 'linux') {
+      final exeDir = File(Platform.resolvedExecutable).parent;
+      candidates.addAll([
+        // Already mapped into the process by the Flutter runner.
+        'libhand_detection_tflite_plugin.so',
+        p.join(exeDir.path, 'lib', 'libhand_detection_tflite_plugin.so'),
+      ]);
+    }
+
+    for (final String c in candidates) {
+      try {
+        if (c.contains(p.separator) && !File(c).existsSync()) continue;
+        return NativeKernels._(ffi.DynamicLibrary.open(c));
+      } catch (_) {}
+    }
+    return null;
+  }
+
+  static String _platformString() {
+    if (Platform.isLinux) return 'linux';
+    return 'other';
+  }
+
+  /// Resets the cached library so the next [instance] access reloads it.
+  @visibleForTesting
+  static void resetForTest() {
+    _instance = null;
+    _loadAttempted = false;
+  }
+
+  /// Letterboxes a BGR888 image into a normalized RGB float tensor.
+  ///
+  /// Performs resize, padding, BGR to RGB swap and 1/255 scaling in one pass,
+  /// writing straight into [dst] (`dstWidth * dstHeight * 3` floats).
+  ///
+  /// [src] is a BGR buffer with rows of [srcStride] bytes, by default
+  /// `srcWidth * 3` (continuous).
+  LetterboxInfo letterboxBgrToRgbF32(
+    Uint8List src,
+    int srcWidth,
+    int srcHeight,
+    Float32List dst,
+    int dstWidth,
+    int dstHeight, {
+    int? srcStride,
+  }) {
+    final status = _letterbox(
+      src.address,
+      srcWidth,
+      srcHeight,
+      srcStride ?? srcWidth * 3,
+      dst.address,
+      dstWidth,
+      dstHeight,
+      _info.address,
+    );
+    if (status != 0) {
+      throw ArgumentError('Native letterbox failed with status $status.');
+    }
+    return (
+      resizedWidth: _info[0],
+      resizedHeight: _info[1],
+      padLeft: _info[2],
+      padTop: _info[3],
+    );
+  }
+
+  /// Letterboxes a BGR888 image into an 8-bit RGB tensor for a uint8/int8
+  /// quantized model input.
+  ///
+  /// Same geometry as [letterboxBgrToRgbF32], but each interpolated pixel
+  /// value `p` is written to [dst] as `lut[p]`, or unchanged when [lut] is
+  /// null, so no float tensor is produced. See
+  /// `TensorQuantization.pixelLut`.
+  LetterboxInfo letterboxBgrToRgbU8(
+    Uint8List src,
+    int srcWidth,
+    int srcHeight,
+    Uint8List dst,
+    int dstWidth,
+    int dstHeight, {
+    Uint8List? lut,
+    int? srcStride,
+  }) {
+    final stride = srcStride ?? srcWidth * 3;
+    final status = lut == null
+        ? _letterboxU8(src.address, srcWidth, srcHeight, stride, dst.address,
+            dstWidth, dstHeight, ffi.nullptr, _info.address)
+        : _letterboxU8(src.address, srcWidth, srcHeight, stride, dst.address,
+            dstWidth, dstHeight, lut.address, _info.address);
+    if (status != 0) {
+      throw ArgumentError('Native letterbox failed with status $status.');
+    }
+    return (
+      resizedWidth: _info[0],
+      resizedHeight: _info[1],
+      padLeft: _info[2],
+      padTop: _info[3],
+    );
+  }
+
+  /// Letterboxes the YUV 4:2:0 frame staged in [src] into a normalized RGB
+  /// float tensor, like [letterboxBgrToRgbF32] on its BGR conversion.
+  ///
+  /// Only the sampled pixels are converted (BT.601 limited range, as
+  /// OpenCV's `COLOR_YUV2BGR_*`), so no full-resolution BGR image is made.
+  LetterboxInfo letterboxYuv420ToRgbF32(
+    NativeYuvFrame src,
+    Float32List dst,
+    int dstWidth,
+    int dstHeight,
+  ) {
+    final status = _letterboxYuv(src.image, src.width, src.height,
+        dst.address, dstWidth, dstHeight, _info.address);
+    if (status != 0) {
+      throw ArgumentError('Native letterbox failed with status $status.');
+    }
+    return (
+      resizedWidth: _info[0],
+      resizedHeight: _info[1],
+      padLeft: _info[2],
+      padTop: _info[3],
+    );
+  }
+
+  /// Samples the [cropSize] square centered at ([centerX], [centerY]) and
+  /// rotated by [rotation] radians out of the YUV 4:2:0 frame staged in
+  /// [src], straight into [dst] as a [dstSize] x [dstSize] normalized RGB
+  /// float tensor with a black border.
+  void warpCropYuv420ToRgbF32(
+    NativeYuvFrame src,
+    double centerX,
+    double centerY,
+    double rotation,
+    int cropSize,
+    Float32List dst,
+    int dstSize,
+  ) {
+    final status = _warpCropYuv(src.image, src.width, src.height, centerX,
+        centerY, rotation, cropSize, dst.address, dstSize);
+    if (status != 0) {
+      throw ArgumentError('Native warp crop failed with status $status.');
+    }
+  }
+
+  /// Dequantizes the uint8 or int8 ([tensorType], [tensorUint8] or
+  /// [tensorInt8]) tensor bytes in [raw] into [out]:
+  /// `out[i] = (raw[i] - zeroPoint) * scale`.
+  void dequantize(
+    Uint8List raw,
+    int tensorType,
+    double scale,
+    int zeroPoint,
+    Float32List out,
+  ) {
+    final status = _dequantize(
+      raw.address,
+      tensorType,
+      raw.length,
+      scale,
+      zeroPoint,
+      out.address,
+    );
+    if (status != 0) {
+      throw ArgumentError('Native dequantize failed with status $status.');
+    }
+  }
+
+  /// Decodes raw palm detector outputs into packed palm rectangles.
+  ///
+  /// Reads the flat `[numAnchors * 18]` box regressors and `[numAnchors]`
+  /// score logits against the struct-of-arrays `[4, numAnchors]` [anchors]
+  /// table (see `PalmDetector.anchorTable`), applies the score threshold,
+  /// computes each palm's rotation rectangle, maps it back from the
+  /// letterbox of an [imageWidth] x [imageHeight] source and runs the 200 px
+  /// distance NMS.
+  ///
+  /// Writes [palmStride] floats per palm into [out], sorted by descending
+  /// score, and returns the number of palms written.
+  int decodePalms(
+    Float32List rawBoxes,
+    Float32List rawScores,
+    Float32List anchors,
+    double scoreThreshold,
+    double inputSize,
+    int imageWidth,
+    int imageHeight,
+    Float32List out,
+  ) {
+    final count = _decodePalms(
+      rawBoxes.address,
+      rawScores.address,
+      rawScores.length,
+      anchors.address,
+      scoreThreshold,
+      inputSize,
+      imageWidth,
+      imageHeight,
+      out.address,
+      out.length ~/ palmStride,
+    );
+    if (count < 0) {
+      throw ArgumentError('Native palm decoding failed with status $count.');
+    }
+    return count;
+  }
+
+  /// Smooths the first [count] floats of [values] in place with the One
+  /// Euro filter, updating [state] (`2 * count` floats: filtered values,
+  /// then filtered derivatives).
+  ///
+  /// Values come in groups of [groupSize]; speeds in group g are multiplied
+  /// by `scales[g]` (1 when [scales] is null). [dt] is the time since the
+  /// previous sample in seconds.
+  void oneEuroFilter(
+    Float32List values,
+    Float32List state,
+    int count,
+    int groupSize,
+    Float32List? scales,
+    double dt,
+    double minCutoff,
+    double beta,
+    double derivativeCutoff,
+  ) {
+    final status = scales == null
+        ? _oneEuro(values.address, state.address, count, groupSize,
+            ffi.nullptr, dt, minCutoff, beta, derivativeCutoff)
+        : _oneEuro(values.address, state.address, count, groupSize,
+            scales.address, dt, minCutoff, beta, derivativeCutoff);
+    if (status != 0) {
+      throw ArgumentError('Native One Euro filter failed with status $status.');
+    }
+  }
+}
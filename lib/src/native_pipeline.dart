@@ -0,0 +1,566 @@
+import 'dart:ffi' as ffi;
+import 'dart:io';
+import 'dart:typed_data';
+import 'package:ffi/ffi.dart';
+import 'package:meta/meta.dart';
+import 'package:path/path.dart' as p;
+import 'package:tflite_flutter_custom/tflite_flutter.dart';
+import 'native_kernels.dart';
+import 'types.dart';
+
+/// Mirrors `HandPipelineOptions` in `linux/include/hand_detection_tflite/hand_pipeline.h`.
+final class _HandPipelineOptions extends ffi.Struct {
+  @ffi.Uint32()
+  external int structSize;
+
+  external ffi.Pointer<Utf8> palmModelPath;
+
+  external ffi.Pointer<Utf8> landmarkModelPath;
+
+  @ffi.Int32()
+  external int numThreads;
+
+  @ffi.Float()
+  external double detectorConfidence;
+
+  @ffi.Int32()
+  external int maxDetections;
+
+  @ffi.Float()
+  external double minLandmarkScore;
+
+  @ffi.Int32()
+  external int mode;
+
+  @ffi.Int32()
+  external int numWorkers;
+
+  @ffi.Int32()
+  external int palmTileColumns;
+
+  @ffi.Int32()
+  external int palmTileRows;
+
+  @ffi.Float()
+  external double palmTileOverlap;
+
+  @ffi.Int32()
+  external int palmTileFullFrame;
+}
+
+/// Mirrors `HandPipelineHand` in `linux/include/hand_detection_tflite/hand_pipeline.h`.
+final class _HandPipelineHand extends ffi.Struct {
+  @ffi.Float()
+  external double score;
+
+  @ffi.Float()
+  external double left;
+
+  @ffi.Float()
+  external double top;
+
+  @ffi.Float()
+  external double right;
+
+  @ffi.Float()
+  external double bottom;
+
+  @ffi.Float()
+  external double rotation;
+
+  @ffi.Float()
+  external double centerX;
+
+  @ffi.Float()
+  external double centerY;
+
+  @ffi.Float()
+  external double size;
+
+  @ffi.Int32()
+  external int handedness;
+
+  @ffi.Float()
+  external double landmarkScore;
+
+  @ffi.Array(NativeHandPipeline.numLandmarks * 3)
+  external ffi.Array<ffi.Float> landmarks;
+}
+
+typedef _AbiVersionNative = ffi.Int32 Function();
+typedef _AbiVersionDart = int Function();
+
+typedef _OptionsInitNative = ffi.Void Function(
+    ffi.Pointer<_HandPipelineOptions>);
+typedef _OptionsInitDart = void Function(ffi.Pointer<_HandPipelineOptions>);
+
+typedef _CreateNative = ffi.Pointer<ffi.Void> Function(
+    ffi.Pointer<_HandPipelineOptions>);
+typedef _CreateDart = ffi.Pointer<ffi.Void> Function(
+    ffi.Pointer<_HandPipelineOptions>);
+
+typedef _DetectNative = ffi.Int32 Function(
+  ffi.Pointer<ffi.Void> pipeline,
+  ffi.Pointer<ffi.Uint8> bgr,
+  ffi.Int32 width,
+  ffi.Int32 height,
+  ffi.Int32 srcStride,
+  ffi.Pointer<_HandPipelineHand> out,
+  ffi.Int32 maxOut,
+);
+typedef _DetectDart = int Function(
+  ffi.Pointer<ffi.Void> pipeline,
+  ffi.Pointer<ffi.Uint8> bgr,
+  int width,
+  int height,
+  int srcStride,
+  ffi.Pointer<_HandPipelineHand> out,
+  int maxOut,
+);
+
+typedef _DetectYuv420Native = ffi.Int32 Function(
+  ffi.Pointer<ffi.Void> pipeline,
+  ffi.Pointer<NativeYuv420Image> image,
+  ffi.Int32 width,
+  ffi.Int32 height,
+  ffi.Pointer<_HandPipelineHand> out,
+  ffi.Int32 maxOut,
+);
+typedef _DetectYuv420Dart = int Function(
+  ffi.Pointer<ffi.Void> pipeline,
+  ffi.Pointer<NativeYuv420Image> image,
+  int width,
+  int height,
+  ffi.Pointer<_HandPipelineHand> out,
+  int maxOut,
+);
+
+typedef _DestroyNative = ffi.Void Function(ffi.Pointer<ffi.Void>);
+typedef _DestroyDart = void Function(ffi.Pointer<ffi.Void>);
+
+typedef _ModelAcquireNative = ffi.Pointer<ffi.Void> Function(
+    ffi.Pointer<Utf8> path);
+typedef _ModelAcquireDart = ffi.Pointer<ffi.Void> Function(
+    ffi.Pointer<Utf8> path);
+
+typedef _ModelCreateInterpreterNative = ffi.Pointer<ffi.Void> Function(
+    ffi.Pointer<ffi.Void> model, ffi.Pointer<ffi.Void> options);
+typedef _ModelCreateInterpreterDart = ffi.Pointer<ffi.Void> Function(
+    ffi.Pointer<ffi.Void> model, ffi.Pointer<ffi.Void> options);
+
+typedef _ModelLiveCountNative = ffi.Int32 Function();
+typedef _ModelLiveCountDart = int Function();
+
+typedef _LastErrorNative = ffi.Pointer<Utf8> Function();
+typedef _LastErrorDart = ffi.Pointer<Utf8> Function();
+
+/// Function table for `libhand_pipeline.so`.
+class _PipelineBindings {
+  final _OptionsInitDart optionsInit;
+  final _CreateDart create;
+  final _DetectDart detect;
+  final _DetectYuv420Dart detectYuv420;
+  final _DestroyDart destroy;
+  final _ModelAcquireDart modelAcquire;
+  final _DestroyDart modelRelease;
+  final _ModelCreateInterpreterDart modelCreateInterpreter;
+  final _ModelLiveCountDart modelLiveCount;
+  final _LastErrorDart lastError;
+
+  _PipelineBindings(ffi.DynamicLibrary lib)
+      : optionsInit = lib.lookupFunction<_OptionsInitNative, _OptionsInitDart>(
+            'hand_pipeline_options_init'),
+        create = lib.lookupFunction<_CreateNative, _CreateDart>(
+            'hand_pipeline_create'),
+        detect = lib.lookupFunction<_DetectNative, _DetectDart>(
+            'hand_pipeline_detect'),
+        detectYuv420 = lib.lookupFunction<_DetectYuv420Native,
+            _DetectYuv420Dart>('hand_pipeline_detect_yuv420'),
+        destroy = lib.lookupFunction<_DestroyNative, _DestroyDart>(
+            'hand_pipeline_destroy'),
+        modelAcquire = lib.lookupFunction<_ModelAcquireNative,
+            _ModelAcquireDart>('hand_model_acquire'),
+        modelRelease = lib.lookupFunction<_DestroyNative, _DestroyDart>(
+            'hand_model_release'),
+        modelCreateInterpreter = lib.lookupFunction<
+            _ModelCreateInterpreterNative,
+            _ModelCreateInterpreterDart>('hand_model_create_interpreter'),
+        modelLiveCount = lib.lookupFunction<_ModelLiveCountNative,
+            _ModelLiveCountDart>('hand_model_live_count'),
+        lastError = lib.lookupFunction<_LastErrorNative, _LastErrorDart>(
+            'hand_pipeline_last_error');
+}
+
+/// FFI binding to the standalone native hand pipeline (`libhand_pipeline.so`).
+///
+/// Runs palm detection, rotated cropping, landmark inference and
+/// back-projection in one native call with no isolate hops. Only built for
+/// Linux; [isAvailable] is false elsewhere and [HandDetector] falls back to
+/// the Dart pipeline.
+///
+/// [detect] is synchronous and blocks the calling isolate for the duration of
+/// inference.
+class NativeHandPipeline {
+  /// Must match `HAND_PIPELINE_ABI_VERSION`.
+  static const int abiVersion = 1;
+
+  /// Number of landmarks per hand (`HAND_PIPELINE_NUM_LANDMARKS`).
+  static const int numLandmarks = 21;
+
+  static _PipelineBindings? _bindings;
+  static bool _loadAttempted = false;
+
+  final _PipelineBindings _lib;
+  ffi.Pointer<ffi.Void> _handle;
+  final int _maxDetections;
+  final bool _withLandmarks;
+  final ffi.Pointer<_HandPipelineHand> _out;
+  final NativeYuvFrame _yuv = NativeYuvFrame();
+
+  /// Reusable native copy of the input image, grown on demand.
+  ffi.Pointer<ffi.Uint8> _image = ffi.nullptr;
+  int _imageCapacity = 0;
+
+  NativeHandPipeline._(
+      this._lib, this._handle, this._maxDetections, this._withLandmarks)
+      : _out = calloc<_HandPipelineHand>(_maxDetections);
+
+  /// Whether `libhand_pipeline.so` can be loaded in this process.
+  static bool get isAvailable => _loadBindings() != null;
+
+  static _PipelineBindings? _loadBindings() {
+    if (!_loadAttempted) {
+      _loadAttempted = true;
+      _bindings = _load(Platform.environment);
+    }
+    return _bindings;
+  }
+
+  static _PipelineBindings? _load(Map<String, String> env) {
+    if (!Platform.isLinux) return null;
+
+    // Optional override for local testing: set HAND_PIPELINE_LIB to an absolute path.
+    final envLibPath = env['HAND_PIPELINE_LIB'];
+    final exeDir = File(Platform.resolvedExecutable).parent;
+    final candidates = <String>[
+      if (envLibPath != null && envLibPath.isNotEmpty) envLibPath,
+      p.join(exeDir.path, 'lib', 'libhand_pipeline.so'),
+      'libhand_pipeline.so',
+    ];
+
+    for (final String c in candidates) {
+      try {
+        if (c.contains(p.separator) && !File(c).existsSync()) continue;
+        final lib = ffi.DynamicLibrary.open(c);
+        final version =
+            lib.lookupFunction<_AbiVersionNative, _AbiVersionDart>(
+                'hand_pipeline_abi_version')();
+        if (version != abiVersion) continue;
+        return _PipelineBindings(lib);
+      } catch (_) {}
+    }
+    return null;
+  }
+
+  /// Resets the cached library so the next load retries.
+  @visibleForTesting
+  static void resetForTest() {
+    _bindings = null;
+    _loadAttempted = false;
+  }
+
+  /// Directory holding the plugin's bundled assets in a Linux Flutter build.
+  static String bundledAssetsDir() {
+    final exeDir = File(Platform.resolvedExecutable).parent;
+    return p.join(exeDir.path, 'data', 'flutter_assets', 'packages',
+        'hand_detection_tflite', 'assets');
+  }
+
+  /// Loads both models and returns a pipeline, or null when the native
+  /// library is unavailable.
+  ///
+  /// With [numWorkers] > 1, hands are processed in parallel on a native
+  /// work-stealing pool with one landmark interpreter per worker; otherwise
+  /// all hands of a frame run as one batched inference.
+  ///
+  /// [palmModelPath] and [landmarkModelPath] replace the bundled models, e.g.
+  /// with uint8/int8 quantized variants; the input and output encodings are
+  /// read from the models.
+  ///
+  /// [palmTiling] also detects palms on overlapping tiles of each frame; with
+  /// [numWorkers] > 1 the tiles run in parallel on the same pool.
+  ///
+  /// Throws [StateError] when the library loads but pipeline creation fails.
+  static NativeHandPipeline? create({
+    required HandMode mode,
+    required double detectorConf,
+    required int maxDetections,
+    required double minLandmarkScore,
+    int? numThreads,
+    int numWorkers = 0,
+    String? modelsDir,
+    String? palmModelPath,
+    String? landmarkModelPath,
+    PalmTiling? palmTiling,
+  }) {
+    final lib = _loadBindings();
+    if (lib == null) return null;
+
+    final dir = modelsDir ?? p.join(bundledAssetsDir(), 'models');
+    final options = calloc<_HandPipelineOptions>();
+    final palmPath =
+        (palmModelPath ?? p.join(dir, 'hand_detection.tflite')).toNativeUtf8();
+    final landmarkPath =
+        (landmarkModelPath ?? p.join(dir, 'hand_landmark_full.tflite'))
+            .toNativeUtf8();
+    try {
+      lib.optionsInit(options);
+      options.ref
+        ..palmModelPath = palmPath
+        ..landmarkModelPath = landmarkPath
+        ..numThreads = numThreads ?? 0
+        ..detectorConfidence = detectorConf
+        ..maxDetections = maxDetections
+        ..minLandmarkScore = minLandmarkScore
+        ..mode = mode == HandMode.boxes ? 0 : 1
+        ..numWorkers = numWorkers;
+      if (palmTiling != null) {
+        options.ref
+          ..palmTileColumns = palmTiling.columns
+          ..palmTileRows = palmTiling.rows
+          ..palmTileOverlap = palmTiling.overlap
+          ..palmTileFullFrame = palmTiling.includeFullFrame ? 1 : 0;
+      }
+      final handle = lib.create(options);
+      if (handle == ffi.nullptr) {
+        throw StateError(
+            'Native hand pipeline creation failed: ${lib.lastError().toDartString()}');
+      }
+      return NativeHandPipeline._(
+          lib, handle, maxDetections, mode == HandMode.boxesAndLandmarks);
+    } finally {
+      malloc.free(palmPath);
+      malloc.free(landmarkPath);
+      calloc.free(options);
+    }
+  }
+
+  /// Detects hands in a continuous BGR888 image of [width] x [height].
+  ///
+  /// Throws [StateError] when called after [dispose] or when native detection
+  /// fails.
+  List<Hand> detect(Uint8List bgr, int width, int height) {
+    return _readHands(_detectBgr(bgr, width, height), width, height);
+  }
+
+  /// [detect] returning a [PackedHands] frame, copied straight from the
+  /// native results without building [Hand] objects.
+  PackedHands detectPacked(Uint8List bgr, int width, int height) {
+    return _readPacked(_detectBgr(bgr, width, height), width, height);
+  }
+
+  int _detectBgr(Uint8List bgr, int width, int height) {
+    _checkNotDisposed();
+    _reserveImage(bgr.length);
+    _image.asTypedList(bgr.length).setAll(0, bgr);
+
+    final count = _lib.detect(
+        _handle, _image, width, height, width * 3, _out, _maxDetections);
+    _checkCount(count);
+    return count;
+  }
+
+  /// Detects hands in a YUV 4:2:0 [frame].
+  ///
+  /// The planes are copied as-is and sampled natively while building the
+  /// model inputs, so no BGR image is created. Planes that are views of one
+  /// buffer (packed NV12/NV21/I420) are copied as a single span.
+  ///
+  /// Throws [ArgumentError] for inconsistent planes and [StateError] when
+  /// called after [dispose] or when native detection fails.
+  List<Hand> detectYuv(YuvFrame frame) {
+    _checkNotDisposed();
+    _yuv.stage(frame);
+    final count = _lib.detectYuv420(
+        _handle, _yuv.image, frame.width, frame.height, _out, _maxDetections);
+    _checkCount(count);
+    return _readHands(count, frame.width, frame.height);
+  }
+
+  void _checkNotDisposed() {
+    if (_handle == ffi.nullptr) {
+      throw StateError('NativeHandPipeline has been disposed.');
+    }
+  }
+
+  void _reserveImage(int bytes) {
+    if (bytes <= _imageCapacity) return;
+    if (_image != ffi.nullptr) malloc.free(_image);
+    _image = malloc<ffi.Uint8>(bytes);
+    _imageCapacity = bytes;
+  }
+
+  void _checkCount(int count) {
+    if (count < 0) {
+      throw StateError(
+          'Native hand detection failed: ${_lib.lastError().toDartString()}');
+    }
+  }
+
+  List<Hand> _readHands(int count, int width, int height) {
+    final hands = <Hand>[];
+    for (int i = 0; i < count; i++) {
+      final h = _out[i];
+      final landmarks = <HandLandmark>[];
+      if (h.handedness >= 0) {
+        for (int j = 0; j < numLandmarks; j++) {
+          landmarks.add(HandLandmark(
+            type: HandLandmarkType.values[j],
+            x: h.landmarks[j * 3],
+            y: h.landmarks[j * 3 + 1],
+            z: h.landmarks[j * 3 + 2],
+            visibility: h.landmarkScore,
+          ));
+        }
+      }
+      hands.add(Hand(
+        boundingBox: BoundingBox(
+          left: h.left,
+          top: h.top,
+          right: h.right,
+          bottom: h.bottom,
+        ),
+        score: h.score,
+        landmarks: landmarks,
+        imageWidth: width,
+        imageHeight: height,
+        handedness: switch (h.handedness) {
+          0 => Handedness.left,
+          1 => Handedness.right,
+          _ => null,
+        },
+        rotation: h.rotation,
+        rotatedCenterX: h.centerX,
+        rotatedCenterY: h.centerY,
+        rotatedSize: h.size,
+      ));
+    }
+    return hands;
+  }
+
+  PackedHands _readPacked(int count, int width, int height) {
+    final packed = PackedHands.allocate(
+      count,
+      imageWidth: width,
+      imageHeight: height,
+      hasLandmarks: _withLandmarks,
+    );
+    final data = packed.data;
+    for (int i = 0; i < count; i++) {
+      final h = _out[i];
+      data
+        ..[packed.boxesOffset + 4 * i] = h.left
+        ..[packed.boxesOffset + 4 * i + 1] = h.top
+        ..[packed.boxesOffset + 4 * i + 2] = h.right
+        ..[packed.boxesOffset + 4 * i + 3] = h.bottom
+        ..[packed.scoresOffset + i] = h.score
+        ..[packed.landmarkScoresOffset + i] = h.landmarkScore
+        ..[packed.handednessOffset + i] =
+            h.handedness >= 0 ? h.handedness.toDouble() : double.nan
+        ..[packed.rotationsOffset + 4 * i] = h.rotation
+        ..[packed.rotationsOffset + 4 * i + 1] = h.centerX
+        ..[packed.rotationsOffset + 4 * i + 2] = h.centerY
+        ..[packed.rotationsOffset + 4 * i + 3] = h.size;
+      if (!_withLandmarks) continue;
+      final base = packed.landmarksOffset + PackedHands.landmarkFloats * i;
+      for (int k = 0; k < PackedHands.landmarkFloats; k++) {
+        data[base + k] = h.landmarks[k];
+      }
+    }
+    return packed;
+  }
+
+  /// Destroys the native pipeline and frees its buffers.
+  void dispose() {
+    if (_handle == ffi.nullptr) return;
+    _lib.destroy(_handle);
+    _handle = ffi.nullptr;
+    calloc.free(_out);
+    _yuv.dispose();
+    if (_image != ffi.nullptr) malloc.free(_image);
+    _image = ffi.nullptr;
+    _imageCapacity = 0;
+  }
+}
+
+/// A `.tflite` model shared process-wide through `libhand_pipeline.so`.
+///
+/// The native registry maps each model file read-only once and every
+/// interpreter created from it, across all [HandDetector] instances and
+/// native pipelines, references that mapping. Unlike `Interpreter.fromAsset`
+/// the weights are never read into the Dart heap or copied per interpreter.
+///
+/// Interpreters from [createInterpreter] must be closed before [release].
+class NativeModel {
+  final _PipelineBindings _lib;
+  ffi.Pointer<ffi.Void> _handle;
+
+  /// File path of the model.
+  final String path;
+
+  NativeModel._(this._lib, this._handle, this.path);
+
+  /// Acquires a reference to the model at [path], or returns null when
+  /// `libhand_pipeline.so` is unavailable or the file does not exist.
+  ///
+  /// Throws [StateError] when the file exists but cannot be loaded.
+  static NativeModel? acquire(String path) {
+    final lib = NativeHandPipeline._loadBindings();
+    if (lib == null || !File(path).existsSync()) return null;
+
+    final nativePath = path.toNativeUtf8();
+    try {
+      final handle = lib.modelAcquire(nativePath);
+      if (handle == ffi.nullptr) {
+        throw StateError(
+            'Native model load failed: ${lib.lastError().toDartString()}');
+      }
+      return NativeModel._(lib, handle, path);
+    } finally {
+      malloc.free(nativePath);
+    }
+  }
+
+  /// Acquires a model bundled with the plugin, e.g.
+  /// `models/hand_detection.tflite`. See [acquire].
+  static NativeModel? acquireBundled(String relativePath) =>
+      acquire(p.join(NativeHandPipeline.bundledAssetsDir(), relativePath));
+
+  /// Number of model files currently mapped in this process, or 0 when the
+  /// native library is unavailable.
+  static int get liveCount =>
+      NativeHandPipeline._loadBindings()?.modelLiveCount() ?? 0;
+
+  /// Creates an interpreter over the shared model with [options].
+  ///
+  /// Throws [StateError] after [release] or when creation fails.
+  Interpreter createInterpreter(InterpreterOptions options) {
+    if (_handle == ffi.nullptr) {
+      throw StateError('NativeModel has been released.');
+    }
+    final interpreter =
+        _lib.modelCreateInterpreter(_handle, options.base.cast<ffi.Void>());
+    if (interpreter == ffi.nullptr) {
+      throw StateError(
+          'Interpreter creation failed: ${_lib.lastError().toDartString()}');
+    }
+    return Interpreter.fromAddress(interpreter.address);
+  }
+
+  /// Drops this reference; the file is unmapped with the last one.
+  void release() {
+    if (_handle == ffi.nullptr) return;
+    _lib.modelRelease(_handle);
+    _handle = ffi.nullptr;
+  }
+}
@@ -0,0 +1,1008 @@
+// GENERATED CODE - DO NOT MODIFY BY HAND.
+// Generated by tool/generate_palm_anchors.dart.
+
+/// Input size the precomputed palm anchors were generated for.
+const int palmAnchorInputSize = 192;
+
+/// Number of SSD anchors of the bundled palm model.
+const int palmAnchorCount = 2016;
+
+/// Anchor centers stored struct-of-arrays: all [palmAnchorCount]
+/// x centers followed by all y centers. Anchor sizes are fixed at
+/// 1 x 1.
+const List<double> palmAnchorCenters = <double>[
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.020833333333333332, 0.020833333333333332, 0.0625, 0.0625,
+  0.10416666666666667, 0.10416666666666667, 0.14583333333333334,
+  0.14583333333333334, 0.1875, 0.1875, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125, 0.3541666666666667,
+  0.3541666666666667, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4791666666666667, 0.4791666666666667, 0.5208333333333334,
+  0.5208333333333334, 0.5625, 0.5625, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875, 0.7291666666666666,
+  0.7291666666666666, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8541666666666666, 0.8541666666666666, 0.8958333333333334,
+  0.8958333333333334, 0.9375, 0.9375, 0.9791666666666666, 0.9791666666666666,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332,
+  0.020833333333333332, 0.020833333333333332, 0.020833333333333332, 0.0625,
+  0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625,
+  0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625,
+  0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625,
+  0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625,
+  0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625, 0.0625,
+  0.0625, 0.0625, 0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.10416666666666667, 0.10416666666666667, 0.10416666666666667,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334,
+  0.14583333333333334, 0.14583333333333334, 0.14583333333333334, 0.1875, 0.1875,
+  0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875,
+  0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875,
+  0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875,
+  0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875,
+  0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875, 0.1875,
+  0.1875, 0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.22916666666666666, 0.22916666666666666, 0.22916666666666666,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333,
+  0.2708333333333333, 0.2708333333333333, 0.2708333333333333, 0.3125, 0.3125,
+  0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125,
+  0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125,
+  0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125,
+  0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125,
+  0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125, 0.3125,
+  0.3125, 0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3541666666666667, 0.3541666666666667, 0.3541666666666667,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333,
+  0.3958333333333333, 0.3958333333333333, 0.3958333333333333, 0.4375, 0.4375,
+  0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375,
+  0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375,
+  0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375,
+  0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375,
+  0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375, 0.4375,
+  0.4375, 0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.4791666666666667, 0.4791666666666667, 0.4791666666666667,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334,
+  0.5208333333333334, 0.5208333333333334, 0.5208333333333334, 0.5625, 0.5625,
+  0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625,
+  0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625,
+  0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625,
+  0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625,
+  0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625, 0.5625,
+  0.5625, 0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6041666666666666, 0.6041666666666666, 0.6041666666666666,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334,
+  0.6458333333333334, 0.6458333333333334, 0.6458333333333334, 0.6875, 0.6875,
+  0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875,
+  0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875,
+  0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875,
+  0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875,
+  0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875, 0.6875,
+  0.6875, 0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7291666666666666, 0.7291666666666666, 0.7291666666666666,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334,
+  0.7708333333333334, 0.7708333333333334, 0.7708333333333334, 0.8125, 0.8125,
+  0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125,
+  0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125,
+  0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125,
+  0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125,
+  0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125, 0.8125,
+  0.8125, 0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8541666666666666, 0.8541666666666666, 0.8541666666666666,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334,
+  0.8958333333333334, 0.8958333333333334, 0.8958333333333334, 0.9375, 0.9375,
+  0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375,
+  0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375,
+  0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375,
+  0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375,
+  0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375, 0.9375,
+  0.9375, 0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.9791666666666666, 0.9791666666666666, 0.9791666666666666,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664,
+  0.041666666666666664, 0.041666666666666664, 0.041666666666666664, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125, 0.125,
+  0.125, 0.125, 0.125, 0.125, 0.125, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.20833333333333334, 0.20833333333333334,
+  0.20833333333333334, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.2916666666666667, 0.2916666666666667,
+  0.2916666666666667, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.4583333333333333, 0.4583333333333333, 0.4583333333333333,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666,
+  0.5416666666666666, 0.5416666666666666, 0.5416666666666666, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625,
+  0.625, 0.625, 0.625, 0.625, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7083333333333334, 0.7083333333333334,
+  0.7083333333333334, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.7916666666666666, 0.7916666666666666,
+  0.7916666666666666, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875, 0.875,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+  0.9583333333333334, 0.9583333333333334, 0.9583333333333334,
+];
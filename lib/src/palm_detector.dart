@@ -5,7 +5,14 @@ import 'dart:typed_data';
 import 'package:opencv_dart/opencv_dart.dart' as cv;
 import 'package:meta/meta.dart';
 import 'package:tflite_flutter_custom/tflite_flutter.dart';
+import 'hand_landmark_model.dart';
 import 'image_utils.dart';
+import 'mat_arena.dart';
+import 'native_kernels.dart';
+import 'native_pipeline.dart';
+import 'palm_anchors.g.dart';
+import 'tensor_memory.dart';
+import 'tensor_quantization.dart';
 import 'types.dart';
 
 /// SSD Anchor configuration options for palm detection.
@@ -95,6 +102,67 @@ class PalmDetection {
   });
 }
 
+/// One palm interpreter of a [PalmDetector] pool, with the input and output
+/// buffers of the call holding it.
+class _PalmInstance {
+  final Interpreter interpreter;
+
+  /// Isolate the interpreter runs on, or null for inline inference or
+  /// with [memory].
+  final IsolateInterpreter? isolateInterpreter;
+
+  /// Direct access to the interpreter's tensors, or null where the
+  /// TensorFlow Lite C API is not reachable from Dart. With it the input is
+  /// letterboxed straight into the input tensor and outputs are read in
+  /// place, and the buffers below hold only dequantized outputs.
+  final TensorMemory? memory;
+
+  /// Input tensor: float, or 8-bit for quantized models.
+  Float32List? inputBuffer;
+  Uint8List? inputBytes;
+
+  /// Flat outputs, the raw bytes of quantized outputs, and the packed
+  /// decoded palms of the native decode path.
+  Float32List? rawBoxes; // [2016 * 18]
+  Float32List? rawScores; // [2016]
+  Uint8List? rawBoxesBytes;
+  Uint8List? rawScoresBytes;
+  Float32List? decodedPalms; // [2016 * NativeKernels.palmStride]
+
+  /// Completes when the call holding this instance is done.
+  Future<void> lock = Future.value();
+
+  _PalmInstance(this.interpreter, this.isolateInterpreter, this.memory);
+
+  /// Runs the interpreter on its isolate, or on the calling isolate for
+  /// inline inference, copying [inputs] and [outputs] through it.
+  Future<void> run(List<Object> inputs, Map<int, Object> outputs) async {
+    final iso = isolateInterpreter;
+    if (iso != null) {
+      await iso.runForMultipleInputs(inputs, outputs);
+    } else {
+      interpreter.runForMultipleInputs(inputs, outputs);
+    }
+  }
+
+  Future<void> dispose() async {
+    await memory?.close();
+    isolateInterpreter?.close();
+    interpreter.close();
+  }
+}
+
+/// Size of the image one palm call runs on, with the square letterbox
+/// padding its detections are mapped back through: `squareSize` and
+/// `paddingHalfSize` are Python's square_standard_size and
+/// square_padding_half_size (palm_detection.py lines 299-300).
+typedef _PalmFrame = ({
+  int width,
+  int height,
+  int squareSize,
+  int paddingHalfSize,
+});
+
 /// SSD-based palm detector for Stage 1 of the hand detection pipeline.
 ///
 /// Detects palm locations in images using a Single Shot Detector (SSD) architecture
@@ -102,40 +170,71 @@ class PalmDetection {
 /// hand regions for landmark extraction.
 ///
 /// This is a direct port of the Python PalmDetection class.
+///
+/// Calls are re-entrant: the image geometry of each call travels with it,
+/// and each call runs on one interpreter of a pool of [poolSize], picked
+/// round-robin, with that interpreter's own buffers. Overlapping calls
+/// (several camera streams on one detector, or the tiles of one image) run
+/// in parallel up to the pool size and queue beyond it.
 class PalmDetector {
-  IsolateInterpreter? _iso;
-  Interpreter? _interpreter;
+  /// Pool of interpreter instances.
+  final List<_PalmInstance> _pool = [];
+
+  /// Maximum number of concurrent inferences.
+  final int poolSize;
+
+  /// Round-robin counter for interpreter selection.
+  int _poolCounter = 0;
+
+  /// Shared memory-mapped model (Linux), null when loaded from the asset.
+  NativeModel? _model;
   bool _isInitialized = false;
-  Delegate? _delegate;
+
+  /// Delegate instances - one per interpreter.
+  final List<Delegate> _delegates = [];
+
+  /// Input size of the bundled palm detection model.
+  static const int inputSize = 192;
 
   /// Input dimensions (192x192 for palm detection model).
   late int _inH;
   late int _inW;
 
-  /// Pre-generated SSD anchors.
-  late List<List<double>> _anchors;
-
-  /// Preprocessing state - matches Python's calculation.
-  /// These use original image dimensions like Python does.
-  int _imageHeight = 0;
-  int _imageWidth = 0;
-
-  /// square_standard_size = max(image_height, image_width) - Python palm_detection.py line 299
-  int _squareStandardSize = 0;
-
-  /// square_padding_half_size = abs(image_height - image_width) // 2 - Python palm_detection.py line 300
-  int _squarePaddingHalfSize = 0;
+  /// SSD anchors as a struct-of-arrays [4, numAnchors] table, see
+  /// [anchorTable].
+  late Float32List _anchors;
 
   /// Score threshold for detection filtering.
   final double scoreThreshold;
 
-  /// Pre-allocated buffers.
-  Float32List? _inputBuffer;
-  List<List<List<double>>>? _outputBoxes; // [1, 2016, 18]
-  List<List<List<double>>>? _outputScores; // [1, 2016, 1]
-
-  /// Creates a palm detector with the specified score threshold.
-  PalmDetector({this.scoreThreshold = 0.60});
+  /// Tiled detection for high-resolution images, null to detect on the whole
+  /// image only.
+  final PalmTiling? tiling;
+
+  /// Buffers reused for the letterbox fallback, shared with the owning
+  /// detector. Null allocates intermediate Mats per call.
+  final MatArena? arena;
+
+  /// Input and output encodings read from the model at [initialize]. With a
+  /// uint8/int8 input the letterbox is written as bytes into the instance's
+  /// input; quantized outputs are read into byte buffers and dequantized
+  /// into the flat raw outputs.
+  TensorQuantization _inputQuant = TensorQuantization.float32;
+  TensorQuantization _boxesQuant = TensorQuantization.float32;
+  TensorQuantization _scoresQuant = TensorQuantization.float32;
+  Uint8List? _inputLut;
+
+  /// Native decode path (Linux), decoding from the flat raw outputs.
+  NativeKernels? _native;
+
+  /// Creates a palm detector with the specified score threshold, optional
+  /// [tiling] and [poolSize] interpreters (1-10).
+  PalmDetector({
+    this.scoreThreshold = 0.60,
+    this.tiling,
+    this.arena,
+    int poolSize = 1,
+  }) : poolSize = poolSize.clamp(1, 10);
 
   /// Calculates scale for anchor generation.
   static double _calculateScale(
@@ -228,29 +327,105 @@ class PalmDetector {
     return anchors;
   }
 
+  /// Returns the anchors for [options] as a struct-of-arrays [4, numAnchors]
+  /// table: every x center, then every y center, width and height.
+  ///
+  /// The bundled palm model's layout comes from the precomputed
+  /// `palm_anchors.g.dart` (see tool/generate_palm_anchors.dart); any other
+  /// options are generated with [generateAnchors].
+  static Float32List anchorTable(SSDAnchorOptions options) {
+    if (_isBundledPalmLayout(options)) {
+      return _bundledAnchors ??= _buildBundledAnchors();
+    }
+    final anchors = generateAnchors(options);
+    final n = anchors.length;
+    final table = Float32List(n * 4);
+    for (int i = 0; i < n; i++) {
+      final anchor = anchors[i];
+      table[i] = anchor[0];
+      table[n + i] = anchor[1];
+      table[2 * n + i] = anchor[2];
+      table[3 * n + i] = anchor[3];
+    }
+    return table;
+  }
+
+  static Float32List? _bundledAnchors;
+
+  static Float32List _buildBundledAnchors() {
+    const n = palmAnchorCount;
+    return Float32List(n * 4)
+      ..setRange(0, 2 * n, palmAnchorCenters)
+      ..fillRange(2 * n, 4 * n, 1.0);
+  }
+
+  static bool _isBundledPalmLayout(SSDAnchorOptions o) {
+    const strides = [8, 16, 16, 16];
+    if (o.numLayers != strides.length || o.strides.length != strides.length) {
+      return false;
+    }
+    for (int i = 0; i < strides.length; i++) {
+      if (o.strides[i] != strides[i]) return false;
+    }
+    return o.inputSizeWidth == palmAnchorInputSize &&
+        o.inputSizeHeight == palmAnchorInputSize &&
+        o.anchorOffsetX == 0.5 &&
+        o.anchorOffsetY == 0.5 &&
+        o.aspectRatios.length == 1 &&
+        o.aspectRatios[0] == 1.0 &&
+        !o.reduceBoxesInLowestLayer &&
+        o.interpolatedScaleAspectRatio == 1.0 &&
+        o.fixedAnchorSize;
+  }
+
   /// Normalizes angle to range [-pi, pi].
   static double normalizeRadians(double angle) {
     return angle - 2 * math.pi * ((angle + math.pi) / (2 * math.pi)).floor();
   }
 
   /// Initializes the palm detector by loading the TFLite model.
-  Future<void> initialize({PerformanceConfig? performanceConfig}) async {
+  ///
+  /// [modelPath] loads a palm model file instead of the bundled asset. Float
+  /// and uint8/int8 quantized models are supported; the input and output
+  /// encodings are read from the model's tensors.
+  ///
+  /// With [inlineInference], the interpreters run on the calling isolate
+  /// instead of each on an `IsolateInterpreter`. Use it when the caller is
+  /// itself a worker isolate, where the extra hop only adds copies.
+  Future<void> initialize({
+    PerformanceConfig? performanceConfig,
+    String? modelPath,
+    bool inlineInference = false,
+  }) async {
     const String assetPath =
         'packages/hand_detection_tflite/assets/models/hand_detection.tflite';
 
     if (_isInitialized) await dispose();
 
-    final options = _createInterpreterOptions(performanceConfig);
-    final interpreter =
-        await Interpreter.fromAsset(assetPath, options: options);
-    _interpreter = interpreter;
-    interpreter.allocateTensors();
+    _model = modelPath != null
+        ? NativeModel.acquire(modelPath)
+        : NativeModel.acquireBundled('models/hand_detection.tflite');
+    final interpreters = <Interpreter>[];
+    for (int i = 0; i < poolSize; i++) {
+      final options = _createInterpreterOptions(performanceConfig);
+      final interpreter = _model?.createInterpreter(options) ??
+          (modelPath != null
+              ? Interpreter.fromFile(File(modelPath), options: options)
+              : await Interpreter.fromAsset(assetPath, options: options));
+      interpreter.allocateTensors();
+      interpreters.add(interpreter);
+    }
+    final interpreter = interpreters.first;
 
     // Get input shape
     final inTensor = interpreter.getInputTensor(0);
     final inShape = inTensor.shape;
     _inH = inShape[1]; // Should be 192
     _inW = inShape[2]; // Should be 192
+    _inputQuant = TensorQuantization.of(inTensor);
+    _inputLut = _inputQuant.isQuantized ? _inputQuant.pixelLut() : null;
+    _boxesQuant = TensorQuantization.of(interpreter.getOutputTensor(0));
+    _scoresQuant = TensorQuantization.of(interpreter.getOutputTensor(1));
 
     // Generate anchors for palm detection
     final anchorOptions = SSDAnchorOptions(
@@ -267,41 +442,64 @@ class PalmDetector {
       interpolatedScaleAspectRatio: 1.0,
       fixedAnchorSize: true,
     );
-    _anchors = generateAnchors(anchorOptions);
+    _anchors = anchorTable(anchorOptions);
+
+    _native = NativeKernels.instance;
+    await HandLandmarkModelRunner.ensureTFLiteLoaded();
+
+    for (final interpreter in interpreters) {
+      final memory =
+          await TensorMemory.create(interpreter, inline: inlineInference);
+      final instance = _PalmInstance(
+        interpreter,
+        memory != null || inlineInference
+            ? null
+            : await IsolateInterpreter.create(address: interpreter.address),
+        memory,
+      );
+      _allocateBuffers(instance);
+      _pool.add(instance);
+    }
+    _isInitialized = true;
+  }
+
+  /// Pre-allocates [instance]'s input and output buffers. With tensor
+  /// memory only quantized outputs need one, to be dequantized into.
+  void _allocateBuffers(_PalmInstance instance) {
+    final copied = instance.memory == null;
+    final inputSize = _inH * _inW * 3;
+    if (copied && _inputQuant.isQuantized) {
+      instance.inputBytes = Uint8List(inputSize);
+    } else if (copied) {
+      instance.inputBuffer = Float32List(inputSize);
+    }
 
-    // Pre-allocate output buffers
     // Output 0: [1, 2016, 18] - box regressors
     // Output 1: [1, 2016, 1] - classification scores
-    final numAnchors = _anchors.length;
-    _outputBoxes = List.generate(
-      1,
-      (_) => List.generate(
-        numAnchors,
-        (_) => List<double>.filled(18, 0.0, growable: false),
-        growable: false,
-      ),
-      growable: false,
-    );
-    _outputScores = List.generate(
-      1,
-      (_) => List.generate(
-        numAnchors,
-        (_) => List<double>.filled(1, 0.0, growable: false),
-        growable: false,
-      ),
-      growable: false,
-    );
-
-    _iso = await IsolateInterpreter.create(address: interpreter.address);
-    _isInitialized = true;
+    final numAnchors = _anchors.length ~/ 4;
+    if (copied || _boxesQuant.isQuantized) {
+      instance.rawBoxes = Float32List(numAnchors * 18);
+    }
+    if (copied || _scoresQuant.isQuantized) {
+      instance.rawScores = Float32List(numAnchors);
+    }
+    if (copied && _boxesQuant.isQuantized) {
+      instance.rawBoxesBytes = Uint8List(numAnchors * 18);
+    }
+    if (copied && _scoresQuant.isQuantized) {
+      instance.rawScoresBytes = Uint8List(numAnchors);
+    }
+    if (_native != null) {
+      instance.decodedPalms =
+          Float32List(numAnchors * NativeKernels.palmStride);
+    }
   }
 
+  /// Creates interpreter options, with an XNNPACK delegate of its own for
+  /// each interpreter (delegates are not shared between interpreters).
   InterpreterOptions _createInterpreterOptions(PerformanceConfig? config) {
     final options = InterpreterOptions();
 
-    _delegate?.delete();
-    _delegate = null;
-
     if (config == null || config.mode == PerformanceMode.disabled) {
       return options;
     }
@@ -318,7 +516,7 @@ class PalmDetector {
           options: XNNPackDelegateOptions(numThreads: threadCount),
         );
         options.addDelegate(xnnpackDelegate);
-        _delegate = xnnpackDelegate;
+        _delegates.add(xnnpackDelegate);
       } catch (e) {
         // Fallback to CPU
       }
@@ -332,121 +530,396 @@ class PalmDetector {
 
   /// Disposes the detector and releases resources.
   Future<void> dispose() async {
-    _iso?.close();
-    _iso = null;
-    _interpreter?.close();
-    _interpreter = null;
-    _delegate?.delete();
-    _delegate = null;
-    _inputBuffer = null;
-    _outputBoxes = null;
-    _outputScores = null;
+    for (final instance in _pool) {
+      await instance.dispose();
+    }
+    _pool.clear();
+    _poolCounter = 0;
+    _model?.release();
+    _model = null;
+    for (final delegate in _delegates) {
+      delegate.delete();
+    }
+    _delegates.clear();
+    _inputLut = null;
+    _native = null;
     _isInitialized = false;
   }
 
+  /// Runs [fn] on the next interpreter of the pool once the call holding it
+  /// is done.
+  ///
+  /// The time spent waiting for the interpreter is added to [stats].
+  Future<T> _withInterpreter<T>(
+    Future<T> Function(_PalmInstance) fn,
+    DetectionStats? stats,
+  ) async {
+    // Round-robin selection
+    final instance = _pool[_poolCounter];
+    _poolCounter = (_poolCounter + 1) % _pool.length;
+
+    final previous = instance.lock;
+    final completer = Completer<void>();
+    instance.lock = completer.future;
+
+    try {
+      final wait = Stopwatch()..start();
+      await previous;
+      stats?.interpreterLockWait += wait.elapsed;
+      return await fn(instance);
+    } finally {
+      completer.complete();
+    }
+  }
+
   /// Detects palms in the given image.
   ///
   /// Returns a list of [PalmDetection] objects containing rotation rectangle
-  /// parameters for each detected palm.
-  Future<List<PalmDetection>> detectOnMat(cv.Mat image) async {
-    if (!_isInitialized || _interpreter == null) {
+  /// parameters for each detected palm. With [tiling], palms found on the
+  /// tiles are merged with those of the whole image.
+  ///
+  /// When [stats] is given, the preprocess, inference and postprocess times
+  /// are added to it.
+  Future<List<PalmDetection>> detectOnMat(
+    cv.Mat image, {
+    DetectionStats? stats,
+  }) async {
+    if (!_isInitialized || _pool.isEmpty) {
+      throw StateError('PalmDetector not initialized.');
+    }
+    final tiling = this.tiling;
+    if (tiling != null && tiling.isEnabled) {
+      return _detectTiled(image, tiling, stats);
+    }
+    return _detectWhole(image, stats);
+  }
+
+  /// Whether [detectOnYuv] can run: the native kernels are loaded, [tiling]
+  /// is off and the model takes a float input.
+  bool get canDetectOnYuv {
+    final tiling = this.tiling;
+    return _native != null &&
+        (tiling == null || !tiling.isEnabled) &&
+        !_inputQuant.isQuantized;
+  }
+
+  /// [detectOnMat] on a YUV 4:2:0 [frame] staged in native memory.
+  ///
+  /// The frame is letterboxed natively straight into the model input,
+  /// converting only the sampled pixels, so no BGR image is created.
+  ///
+  /// Throws [StateError] if called before [initialize] or when
+  /// [canDetectOnYuv] is false.
+  Future<List<PalmDetection>> detectOnYuv(
+    NativeYuvFrame frame, {
+    DetectionStats? stats,
+  }) async {
+    if (!_isInitialized || _pool.isEmpty) {
       throw StateError('PalmDetector not initialized.');
     }
+    if (!canDetectOnYuv) {
+      throw StateError('YUV palm detection needs the native kernels, '
+          'no tiling and a float model input.');
+    }
+    final native = _native!;
+    final palmFrame = _palmFrame(frame.width, frame.height);
+
+    return _withInterpreter((instance) async {
+      final watch = Stopwatch()..start();
+      final memory = instance.memory;
+      final floats = memory?.inputFloats(0) ?? instance.inputBuffer!;
+      native.letterboxYuv420ToRgbF32(frame, floats, _inW, _inH);
+      stats?.palmPreprocess += watch.elapsed;
+      final input = memory != null ? null : floats.buffer;
+      return _detectFlat(instance, input, palmFrame, stats);
+    }, stats);
+  }
+
+  /// Detects palms on each tile of [tiling], maps them back to [image]
+  /// coordinates and merges them with the distance NMS.
+  ///
+  /// The bundled model reshapes its outputs to a batch of 1, so it cannot
+  /// take the tiles as one batch; instead the tiles are spread over the
+  /// interpreter pool and run in parallel up to its size.
+  Future<List<PalmDetection>> _detectTiled(
+    cv.Mat image,
+    PalmTiling tiling,
+    DetectionStats? stats,
+  ) async {
+    final width = image.cols;
+    final height = image.rows;
+    final tilePalms = await Future.wait([
+      for (final tile in tiling.tiles(width, height, minTileSize: _inW))
+        _detectTile(image, tile, stats),
+    ]);
+    final watch = Stopwatch()..start();
+    final merged =
+        _nms([for (final palms in tilePalms) ...palms], width, height);
+    stats?.palmPostprocess += watch.elapsed;
+    return merged;
+  }
+
+  /// Detects palms on [tile] of [image], in [image] coordinates.
+  Future<List<PalmDetection>> _detectTile(
+    cv.Mat image,
+    PalmTile tile,
+    DetectionStats? stats,
+  ) async {
+    final width = image.cols;
+    final height = image.rows;
+    // The tile is letterboxed in place from [image], not from a region view.
+    final region = tile.width == width && tile.height == height
+        ? null
+        : cv.Rect(tile.x, tile.y, tile.width, tile.height);
+    final palms = await _detectWhole(image, stats, region: region);
+    return mapTilePalms(palms, tile, width, height);
+  }
+
+  /// Maps [palms] detected on [tile] to the coordinates of the [width] x
+  /// [height] image it was taken from, dropping palms the tile did not see
+  /// whole.
+  ///
+  /// A palm is kept when its center lies inside the tile and its square does
+  /// not cross a tile edge inside the image, where the overlapping neighbour
+  /// (or the whole image) covers the hand. A whole-image tile keeps every
+  /// palm. Mirrors `hand_detection_tflite_map_tile_palms`.
+  @visibleForTesting
+  static List<PalmDetection> mapTilePalms(
+    List<PalmDetection> palms,
+    PalmTile tile,
+    int width,
+    int height,
+  ) {
+    final wholeFrame = tile.width == width && tile.height == height;
+    final left = tile.x > 0 ? 0.0 : double.negativeInfinity;
+    final top = tile.y > 0 ? 0.0 : double.negativeInfinity;
+    final right =
+        tile.x + tile.width < width ? tile.width.toDouble() : double.infinity;
+    final bottom = tile.y + tile.height < height
+        ? tile.height.toDouble()
+        : double.infinity;
+    final tileSide = math.max(tile.width, tile.height);
+    final sizeScale = tileSide / math.max(width, height);
+
+    final mapped = <PalmDetection>[];
+    for (final palm in palms) {
+      final cx = palm.sqnRrCenterX * tile.width;
+      final cy = palm.sqnRrCenterY * tile.height;
+      if (!wholeFrame) {
+        final half = palm.sqnRrSize * tileSide / 2;
+        final inside =
+            cx >= 0 && cx < tile.width && cy >= 0 && cy < tile.height;
+        if (!inside ||
+            cx - half < left ||
+            cy - half < top ||
+            cx + half > right ||
+            cy + half > bottom) {
+          continue;
+        }
+      }
+      mapped.add(PalmDetection(
+        sqnRrSize: palm.sqnRrSize * sizeScale,
+        rotation: palm.rotation,
+        sqnRrCenterX: (tile.x + cx) / width,
+        sqnRrCenterY: (tile.y + cy) / height,
+        score: palm.score,
+      ));
+    }
+    return mapped;
+  }
 
-    _imageHeight = image.rows;
-    _imageWidth = image.cols;
+  /// Detects palms on the whole of [image], or on its [region] in
+  /// [region] coordinates.
+  Future<List<PalmDetection>> _detectWhole(
+    cv.Mat image,
+    DetectionStats? stats, {
+    cv.Rect? region,
+  }) async {
+    final frame = _palmFrame(
+        region?.width ?? image.cols, region?.height ?? image.rows);
+
+    return _withInterpreter((instance) async {
+      // keep_aspect_resize_and_pad + BGR -> RGB float normalization (or 8-bit
+      // encoding for quantized models), fused natively where available to
+      // avoid intermediate Mats
+      final watch = Stopwatch()..start();
+      final input = _writeInput(instance, image, region);
+      stats?.palmPreprocess += watch.elapsed;
+      return _detectFlat(instance, input, frame, stats);
+    }, stats);
+  }
 
+  /// The [_PalmFrame] of a palm call on a [cols] x [rows] image.
+  static _PalmFrame _palmFrame(int cols, int rows) {
     // Calculate square padding info from original image dimensions (matches Python exactly)
     // Python palm_detection.py lines 299-300:
     // self.square_standard_size = max(image_height, image_width)
     // self.square_padding_half_size = abs(image_height - image_width) // 2
-    _squareStandardSize = math.max(_imageHeight, _imageWidth);
-    _squarePaddingHalfSize = (_imageHeight - _imageWidth).abs() ~/ 2;
-
-    // Use keep_aspect_resize_and_pad to match Python implementation
-    final (paddedImage, resizedImage) = ImageUtils.keepAspectResizeAndPad(
-      image,
-      _inW,
-      _inH,
+    return (
+      width: cols,
+      height: rows,
+      squareSize: math.max(rows, cols),
+      paddingHalfSize: (rows - cols).abs() ~/ 2,
     );
+  }
 
-    // Convert to float32 tensor and normalize (BGR -> RGB)
-    final inputSize = _inH * _inW * 3;
-    _inputBuffer ??= Float32List(inputSize);
-    ImageUtils.matToFloat32Tensor(paddedImage, buffer: _inputBuffer);
-
-    // Clean up OpenCV Mats
-    resizedImage.dispose();
-    paddedImage.dispose();
-
-    // Run inference
-    final inputs = [_inputBuffer!.buffer];
-    final outputs = <int, Object>{
-      0: _outputBoxes!,
-      1: _outputScores!,
-    };
-
-    if (_iso != null) {
-      await _iso!.runForMultipleInputs(inputs, outputs);
+  /// Letterboxes [image], or its [region], into [instance]'s input tensor
+  /// encoding and returns the buffer to feed the interpreter, or null when
+  /// it was written into the input tensor itself.
+  ByteBuffer? _writeInput(
+    _PalmInstance instance,
+    cv.Mat image,
+    cv.Rect? region,
+  ) {
+    final memory = instance.memory;
+    final bytes = memory != null && _inputQuant.isQuantized
+        ? memory.inputBytes(0)
+        : instance.inputBytes;
+    if (bytes != null) {
+      ImageUtils.letterboxToUint8Tensor(image, _inW, _inH, bytes,
+          lut: _inputLut, scratch: arena?.palmLetterbox, region: region);
+      return memory != null ? null : bytes.buffer;
+    }
+    if (memory != null) {
+      ImageUtils.letterboxToTensor(image, _inW, _inH, memory.inputFloats(0),
+          scratch: arena?.palmLetterbox, region: region);
+      return null;
+    }
+    final floats = instance.inputBuffer!;
+    ImageUtils.letterboxToTensor(image, _inW, _inH, floats,
+        scratch: arena?.palmLetterbox, region: region);
+    return floats.buffer;
+  }
+
+  /// Runs inference into [instance]'s flat output buffers, or in place on
+  /// its tensor memory when [input] is null, dequantizing quantized outputs,
+  /// and decodes natively where available.
+  ///
+  /// Decode, threshold, rotation and NMS run in one native call over the raw
+  /// tensors, so only the surviving palms are materialized as Dart objects.
+  Future<List<PalmDetection>> _detectFlat(
+    _PalmInstance instance,
+    ByteBuffer? input,
+    _PalmFrame frame,
+    DetectionStats? stats,
+  ) async {
+    final watch = Stopwatch()..start();
+    if (input == null) {
+      await instance.memory!.invoke();
     } else {
-      _interpreter!.runForMultipleInputs(inputs, outputs);
+      final outputs = <int, Object>{
+        0: (instance.rawBoxesBytes ?? instance.rawBoxes!).buffer,
+        1: (instance.rawScoresBytes ?? instance.rawScores!).buffer,
+      };
+      await instance.run([input], outputs);
+    }
+    stats?.palmInference += watch.elapsed;
+    watch.reset();
+    final palms = _decodeFlat(instance, frame);
+    stats?.palmPostprocess += watch.elapsed;
+    return palms;
+  }
+
+  /// Dequantizes and decodes [instance]'s flat palm outputs into detections
+  /// on [frame].
+  List<PalmDetection> _decodeFlat(_PalmInstance instance, _PalmFrame frame) {
+    final rawBoxes = _flatOutput(instance, 0, _boxesQuant, instance.rawBoxes,
+        instance.rawBoxesBytes);
+    final rawScores = _flatOutput(instance, 1, _scoresQuant,
+        instance.rawScores, instance.rawScoresBytes);
+
+    final native = _native;
+    if (native == null) {
+      return _postprocess(_decodeBoxes(rawBoxes, rawScores), frame);
     }
 
-    // Decode boxes
-    final decodedBoxes = _decodeBoxes(
-      _outputBoxes![0],
-      _outputScores![0],
+    final packed = instance.decodedPalms!;
+    final count = native.decodePalms(
+      rawBoxes,
+      rawScores,
+      _anchors,
+      scoreThreshold,
+      _inW.toDouble(),
+      frame.width,
+      frame.height,
+      packed,
     );
 
-    // Postprocess
-    return _postprocess(decodedBoxes);
+    const stride = NativeKernels.palmStride;
+    return List<PalmDetection>.generate(count, (i) {
+      final base = i * stride;
+      return PalmDetection(
+        score: packed[base],
+        sqnRrSize: packed[base + 1],
+        rotation: packed[base + 2],
+        sqnRrCenterX: packed[base + 3],
+        sqnRrCenterY: packed[base + 4],
+      );
+    }, growable: false);
+  }
+
+  /// Float output [index] of [instance] after inference: the output tensor
+  /// itself with tensor memory, otherwise [raw] as copied by the
+  /// interpreter. Quantized outputs are dequantized into [raw] from the
+  /// tensor or from [rawBytes].
+  static Float32List _flatOutput(
+    _PalmInstance instance,
+    int index,
+    TensorQuantization quant,
+    Float32List? raw,
+    Uint8List? rawBytes,
+  ) {
+    final memory = instance.memory;
+    if (quant.isQuantized) {
+      quant.dequantize(rawBytes ?? memory!.outputBytes(index), raw!);
+      return raw;
+    }
+    return memory?.outputFloats(index) ?? raw!;
   }
 
   /// Decodes raw box predictions using anchors.
   ///
+  /// [rawBoxes] holds 18 values per anchor and [rawScores] one, flat as the
+  /// model outputs them; only the values decoding needs are read.
+  ///
   /// Returns decoded boxes as [score, cx, cy, boxSize, kp0X, kp0Y, kp2X, kp2Y].
   List<List<double>> _decodeBoxes(
-    List<List<double>> rawBoxes,
-    List<List<double>> rawScores, {
+    Float32List rawBoxes,
+    Float32List rawScores, {
     double scale = 192.0,
   }) {
     final results = <List<double>>[];
+    final anchors = _anchors;
+    final n = anchors.length ~/ 4;
 
-    for (int i = 0; i < rawBoxes.length; i++) {
+    for (int i = 0; i < rawScores.length; i++) {
       // Apply sigmoid to score
-      final rawScore = rawScores[i][0];
+      final rawScore = rawScores[i];
       final score = 1.0 / (1.0 + math.exp(-rawScore));
 
       if (score <= scoreThreshold) continue;
 
-      final rawBox = rawBoxes[i];
-      final anchor = _anchors[i];
+      final b = i * 18;
+      final anchorX = anchors[i];
+      final anchorY = anchors[n + i];
+      final anchorW = anchors[2 * n + i];
+      final anchorH = anchors[3 * n + i];
 
       // Decode coordinates relative to anchor
       // rawBox: [cx, cy, w, h, kp0_x, kp0_y, kp1_x, kp1_y, ..., kp6_x, kp6_y]
-      // Each value is offset relative to anchor, scaled by 192
-
-      // Tile anchor[2:4] (width, height) 9 times for 18 values
-      // Then divide by scale and add anchor[0:2] (cx, cy) tiled 9 times
-      final decoded = <double>[];
-      for (int j = 0; j < 18; j += 2) {
-        final x = rawBox[j] * anchor[2] / scale + anchor[0];
-        final y = rawBox[j + 1] * anchor[3] / scale + anchor[1];
-        decoded.add(x);
-        decoded.add(y);
-      }
-
-      final cx = decoded[0];
-      final cy = decoded[1];
-      final w = decoded[2] - anchor[0];
-      final h = decoded[3] - anchor[1];
+      // Each value is offset relative to anchor, scaled by 192:
+      // x * anchor_w / scale + anchor_x, y * anchor_h / scale + anchor_y
+      final cx = rawBoxes[b] * anchorW / scale + anchorX;
+      final cy = rawBoxes[b + 1] * anchorH / scale + anchorY;
+      final w = rawBoxes[b + 2] * anchorW / scale;
+      final h = rawBoxes[b + 3] * anchorH / scale;
       final boxSize = math.max(w, h);
 
       // Extract keypoint 0 and keypoint 2 (used for rotation)
-      final kp0X = decoded[4];
-      final kp0Y = decoded[5];
-      final kp2X = decoded[8];
-      final kp2Y = decoded[9];
+      final kp0X = rawBoxes[b + 4] * anchorW / scale + anchorX;
+      final kp0Y = rawBoxes[b + 5] * anchorH / scale + anchorY;
+      final kp2X = rawBoxes[b + 8] * anchorW / scale + anchorX;
+      final kp2Y = rawBoxes[b + 9] * anchorH / scale + anchorY;
 
       results.add([score, cx, cy, boxSize, kp0X, kp0Y, kp2X, kp2Y]);
     }
@@ -459,7 +932,10 @@ class PalmDetector {
   /// Transforms coordinates from model space back to original image space,
   /// accounting for the padding applied during preprocessing.
   /// Matches Python's __postprocess implementation.
-  List<PalmDetection> _postprocess(List<List<double>> boxes) {
+  List<PalmDetection> _postprocess(
+    List<List<double>> boxes,
+    _PalmFrame frame,
+  ) {
     if (boxes.isEmpty) return [];
 
     final palms = <PalmDetection>[];
@@ -489,16 +965,16 @@ class PalmDetector {
         //     sqn_rr_center_x = (sqn_rr_center_x * square_standard_size - square_padding_half_size) / image_width
         // else:
         //     sqn_rr_center_y = (sqn_rr_center_y * square_standard_size - square_padding_half_size) / image_height
-        if (_imageHeight > _imageWidth) {
+        if (frame.height > frame.width) {
           // Portrait: padding was added to width, adjust X
           sqnRrCenterX =
-              (sqnRrCenterX * _squareStandardSize - _squarePaddingHalfSize) /
-                  _imageWidth;
+              (sqnRrCenterX * frame.squareSize - frame.paddingHalfSize) /
+                  frame.width;
         } else {
           // Landscape: padding was added to height, adjust Y
           sqnRrCenterY =
-              (sqnRrCenterY * _squareStandardSize - _squarePaddingHalfSize) /
-                  _imageHeight;
+              (sqnRrCenterY * frame.squareSize - frame.paddingHalfSize) /
+                  frame.height;
         }
 
         palms.add(PalmDetection(
@@ -512,12 +988,13 @@ class PalmDetector {
     }
 
     // Apply NMS to remove overlapping detections
-    return _nms(palms);
+    return _nms(palms, frame.width, frame.height);
   }
 
-  /// Non-maximum suppression for palm detections.
+  /// Non-maximum suppression for palm detections on a [width] x [height]
+  /// image.
   /// Matches Python's 200px Euclidean distance threshold in pixel space.
-  List<PalmDetection> _nms(List<PalmDetection> palms) {
+  List<PalmDetection> _nms(List<PalmDetection> palms, int width, int height) {
     if (palms.isEmpty) return palms;
 
     // Sort by score descending
@@ -535,10 +1012,8 @@ class PalmDetector {
         if (suppressed[j]) continue;
 
         // Convert normalized coordinates to pixel space (matching Python's approach)
-        final dx =
-            (sorted[i].sqnRrCenterX - sorted[j].sqnRrCenterX) * _imageWidth;
-        final dy =
-            (sorted[i].sqnRrCenterY - sorted[j].sqnRrCenterY) * _imageHeight;
+        final dx = (sorted[i].sqnRrCenterX - sorted[j].sqnRrCenterX) * width;
+        final dy = (sorted[i].sqnRrCenterY - sorted[j].sqnRrCenterY) * height;
         final distance = math.sqrt(dx * dx + dy * dy);
 
         // Use 200px threshold like Python (not normalized)
@@ -551,9 +1026,9 @@ class PalmDetector {
     return keep;
   }
 
-  /// Exposes anchor generation for testing.
+  /// Exposes the struct-of-arrays anchor table for testing.
   @visibleForTesting
-  List<List<double>> get anchorsForTest => _anchors;
+  Float32List get anchorsForTest => _anchors;
 
   /// Exposes input width for testing.
   @visibleForTesting
@@ -0,0 +1,247 @@
+import 'dart:async';
+import 'dart:ffi' as ffi;
+import 'dart:isolate';
+import 'dart:typed_data';
+import 'package:tflite_flutter_custom/tflite_flutter.dart';
+import 'hand_landmark_model.dart';
+
+typedef _GetTensorNative = ffi.Pointer<ffi.Void> Function(
+  ffi.Pointer<ffi.Void> interpreter,
+  ffi.Int32 index,
+);
+typedef _GetTensorDart = ffi.Pointer<ffi.Void> Function(
+  ffi.Pointer<ffi.Void> interpreter,
+  int index,
+);
+typedef _TensorDataNative = ffi.Pointer<ffi.Void> Function(
+  ffi.Pointer<ffi.Void> tensor,
+);
+typedef _TensorByteSizeNative = ffi.Size Function(
+  ffi.Pointer<ffi.Void> tensor,
+);
+typedef _TensorByteSizeDart = int Function(ffi.Pointer<ffi.Void> tensor);
+typedef _InvokeNative = ffi.Int32 Function(ffi.Pointer<ffi.Void> interpreter);
+typedef _InvokeDart = int Function(ffi.Pointer<ffi.Void> interpreter);
+
+/// The TensorFlow Lite C API functions [TensorMemory] needs.
+class _TensorBindings {
+  final _GetTensorDart inputTensor;
+  final _GetTensorDart outputTensor;
+  final _TensorDataNative tensorData;
+  final _TensorByteSizeDart tensorByteSize;
+  final _InvokeDart invoke;
+
+  /// Address of `TfLiteInterpreterInvoke`, for invoker isolates.
+  final int invokeAddress;
+
+  _TensorBindings(ffi.DynamicLibrary lib)
+      : inputTensor = lib.lookupFunction<_GetTensorNative, _GetTensorDart>(
+          'TfLiteInterpreterGetInputTensor',
+          isLeaf: true,
+        ),
+        outputTensor = lib.lookupFunction<_GetTensorNative, _GetTensorDart>(
+          'TfLiteInterpreterGetOutputTensor',
+          isLeaf: true,
+        ),
+        tensorData = lib.lookupFunction<_TensorDataNative, _TensorDataNative>(
+          'TfLiteTensorData',
+          isLeaf: true,
+        ),
+        tensorByteSize =
+            lib.lookupFunction<_TensorByteSizeNative, _TensorByteSizeDart>(
+          'TfLiteTensorByteSize',
+          isLeaf: true,
+        ),
+        invoke = lib.lookupFunction<_InvokeNative, _InvokeDart>(
+          'TfLiteInterpreterInvoke',
+        ),
+        invokeAddress = lib
+            .lookup<ffi.NativeFunction<_InvokeNative>>(
+                'TfLiteInterpreterInvoke')
+            .address;
+}
+
+/// Typed-data views over an interpreter's tensors, straight on the memory
+/// TensorFlow Lite allocated for them.
+///
+/// `Interpreter.runForMultipleInputs` copies every input from a Dart buffer
+/// into its tensor and every output tensor back out. Here preprocessing
+/// writes into [inputFloats] / [inputBytes], [invoke] runs the model and
+/// results are read from [outputFloats] / [outputBytes], so no tensor data
+/// is copied. The views are only valid until the tensors are reallocated
+/// (`resizeInputTensor` + `allocateTensors`), so take them per inference.
+///
+/// [invoke] runs `TfLiteInterpreterInvoke` on a dedicated isolate, like
+/// `IsolateInterpreter` but with only the interpreter address crossing
+/// isolates, or on the calling isolate for inline inference.
+class TensorMemory {
+  final _TensorBindings _api;
+  final ffi.Pointer<ffi.Void> _interpreter;
+  final _Invoker? _invoker;
+
+  TensorMemory._(this._api, this._interpreter, this._invoker);
+
+  static _TensorBindings? _bindings;
+  static ffi.DynamicLibrary? _boundLibrary;
+
+  /// Whether the TensorFlow Lite C API can be reached from Dart in this
+  /// isolate. Requires `HandLandmarkModelRunner.ensureTFLiteLoaded`.
+  static bool get isAvailable => _load() != null;
+
+  static _TensorBindings? _load() {
+    final lib = HandLandmarkModelRunner.tfliteLibrary;
+    if (lib != _boundLibrary) {
+      _boundLibrary = lib;
+      _bindings = null;
+      if (lib == null) return null;
+      try {
+        _bindings = _TensorBindings(lib);
+      } on ArgumentError {
+        // Symbols not visible, e.g. a library loaded privately by the
+        // TensorFlow Lite plugin; callers copy through the interpreter.
+        _bindings = null;
+      }
+    }
+    return _bindings;
+  }
+
+  /// Binds [interpreter]'s tensors, or returns null when the C API is not
+  /// [isAvailable]. [interpreter] must have allocated its tensors.
+  ///
+  /// With [inline], [invoke] runs on the calling isolate; otherwise an
+  /// invoker isolate is spawned for it.
+  static Future<TensorMemory?> create(
+    Interpreter interpreter, {
+    bool inline = false,
+  }) async {
+    final api = _load();
+    if (api == null) return null;
+    final address = interpreter.address;
+    final invoker =
+        inline ? null : await _Invoker.spawn(api.invokeAddress, address);
+    return TensorMemory._(
+        api, ffi.Pointer<ffi.Void>.fromAddress(address), invoker);
+  }
+
+  /// Input tensor [index] as bytes (uint8/int8 models).
+  Uint8List inputBytes(int index) =>
+      _bytes(_api.inputTensor(_interpreter, index));
+
+  /// Input tensor [index] as floats.
+  Float32List inputFloats(int index) =>
+      _floats(_api.inputTensor(_interpreter, index));
+
+  /// Output tensor [index] as bytes (uint8/int8 models).
+  Uint8List outputBytes(int index) =>
+      _bytes(_api.outputTensor(_interpreter, index));
+
+  /// Output tensor [index] as floats.
+  Float32List outputFloats(int index) =>
+      _floats(_api.outputTensor(_interpreter, index));
+
+  Uint8List _bytes(ffi.Pointer<ffi.Void> tensor) => _api
+      .tensorData(tensor)
+      .cast<ffi.Uint8>()
+      .asTypedList(_api.tensorByteSize(tensor));
+
+  Float32List _floats(ffi.Pointer<ffi.Void> tensor) => _api
+      .tensorData(tensor)
+      .cast<ffi.Float>()
+      .asTypedList(_api.tensorByteSize(tensor) ~/ 4);
+
+  /// Runs the model on the current contents of the input tensors.
+  ///
+  /// Throws [StateError] when the invocation fails.
+  Future<void> invoke() async {
+    final invoker = _invoker;
+    final status = invoker != null
+        ? await invoker.invoke()
+        : _api.invoke(_interpreter);
+    if (status != 0) {
+      throw StateError('TfLiteInterpreterInvoke failed with status $status.');
+    }
+  }
+
+  /// Shuts the invoker isolate down and waits for it to exit, so that no
+  /// invocation is still running. Await it before closing the interpreter.
+  Future<void> close() async {
+    await _invoker?.close();
+  }
+}
+
+/// An isolate calling `TfLiteInterpreterInvoke` on one interpreter per
+/// request; replies carry the status and arrive in request order.
+class _Invoker {
+  final SendPort _requests;
+  final ReceivePort _replies;
+  final List<Completer<int>> _pending = [];
+
+  /// Completes when the isolate has exited.
+  final Future<void> _exited;
+
+  _Invoker._(this._requests, this._replies, this._exited);
+
+  static Future<_Invoker> spawn(int invokeAddress, int interpreter) async {
+    final replies = ReceivePort();
+    // Registered at spawn, as an exit listener added later gets no message
+    // if the isolate is already gone.
+    final exit = ReceivePort();
+    final ready = Completer<SendPort>();
+    _Invoker? invoker;
+    replies.listen((message) {
+      if (invoker != null) {
+        invoker!._pending.removeAt(0).complete(message as int);
+      } else {
+        ready.complete(message as SendPort);
+      }
+    });
+    try {
+      await Isolate.spawn(
+        _main,
+        (replies.sendPort, invokeAddress, interpreter),
+        onExit: exit.sendPort,
+        debugName: 'TensorMemoryInvoker',
+      );
+    } catch (_) {
+      replies.close();
+      exit.close();
+      rethrow;
+    }
+    return invoker = _Invoker._(await ready.future, replies, exit.first);
+  }
+
+  Future<int> invoke() {
+    final completer = Completer<int>();
+    _pending.add(completer);
+    _requests.send(true);
+    return completer.future;
+  }
+
+  /// Stops the isolate after any invocation in progress and waits for it
+  /// to exit.
+  Future<void> close() async {
+    _requests.send(null);
+    _replies.close();
+    for (final call in _pending) {
+      call.completeError(StateError('TensorMemory closed.'));
+    }
+    _pending.clear();
+    await _exited;
+  }
+
+  /// Invokes the interpreter once per message until it receives null.
+  static Future<void> _main((SendPort, int, int) args) async {
+    final (replies, invokeAddress, address) = args;
+    final invoke = ffi.Pointer<ffi.NativeFunction<_InvokeNative>>.fromAddress(
+            invokeAddress)
+        .asFunction<_InvokeDart>();
+    final interpreter = ffi.Pointer<ffi.Void>.fromAddress(address);
+    final requests = ReceivePort();
+    replies.send(requests.sendPort);
+    await for (final message in requests) {
+      if (message == null) break;
+      replies.send(invoke(interpreter));
+    }
+    requests.close();
+  }
+}
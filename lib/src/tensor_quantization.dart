@@ -0,0 +1,92 @@
+import 'dart:typed_data';
+import 'package:tflite_flutter_custom/tflite_flutter.dart';
+import 'native_kernels.dart';
+
+/// Element encoding of a model input or output tensor.
+///
+/// Float32 tensors are read and written as-is. uint8/int8 quantized tensors
+/// store `q = real / scale + zeroPoint`: image inputs are written as bytes
+/// through [pixelLut] and outputs are converted back with [dequantize].
+class TensorQuantization {
+  /// Tensor element type.
+  final TensorType type;
+
+  /// Quantization scale (unused for float tensors).
+  final double scale;
+
+  /// Quantization zero point (unused for float tensors).
+  final int zeroPoint;
+
+  /// Encoding of a float32 tensor.
+  static const TensorQuantization float32 =
+      TensorQuantization(type: TensorType.float32);
+
+  /// Creates a tensor encoding.
+  const TensorQuantization({
+    required this.type,
+    this.scale = 0.0,
+    this.zeroPoint = 0,
+  });
+
+  /// Reads the encoding of [tensor].
+  ///
+  /// Throws [UnsupportedError] for types other than float32, uint8 and int8.
+  factory TensorQuantization.of(Tensor tensor) {
+    final type = tensor.type;
+    if (type == TensorType.float32) return float32;
+    if (type != TensorType.uint8 && type != TensorType.int8) {
+      throw UnsupportedError('Unsupported tensor type $type.');
+    }
+    final params = tensor.params;
+    return TensorQuantization(
+      type: type,
+      scale: params.scale,
+      zeroPoint: params.zeroPoint,
+    );
+  }
+
+  /// Whether elements are 8-bit quantized values.
+  bool get isQuantized => type == TensorType.uint8 || type == TensorType.int8;
+
+  /// For a quantized image input, the 256-entry table mapping an 8-bit pixel
+  /// value `p` to the byte stored for the normalized value `p / 255`.
+  ///
+  /// Returns null when that mapping is the identity (a uint8 input with scale
+  /// 1/255 and zero point 0), so pixels can be copied straight into the
+  /// tensor. Mirrors `hand_detection_tflite_input_quantization_lut`.
+  Uint8List? pixelLut() {
+    final signed = type == TensorType.int8;
+    final lo = signed ? -128 : 0;
+    final hi = signed ? 127 : 255;
+    final lut = Uint8List(256);
+    var identity = true;
+    for (int p = 0; p < 256; p++) {
+      final q = ((p / 255.0) / scale).round() + zeroPoint;
+      // Int8 values are stored as their two's complement byte.
+      lut[p] = q.clamp(lo, hi) & 0xff;
+      identity = identity && lut[p] == p;
+    }
+    return identity ? null : lut;
+  }
+
+  /// Dequantizes the tensor bytes in [raw] into [out]
+  /// (`(q - zeroPoint) * scale`), natively where available.
+  void dequantize(Uint8List raw, Float32List out) {
+    final signed = type == TensorType.int8;
+    final native = NativeKernels.instance;
+    if (native != null) {
+      native.dequantize(
+        raw,
+        signed ? NativeKernels.tensorInt8 : NativeKernels.tensorUint8,
+        scale,
+        zeroPoint,
+        out,
+      );
+      return;
+    }
+    final List<int> values = signed ? Int8List.sublistView(raw) : raw;
+    for (int i = 0; i < values.length; i++) {
+      out[i] = (values[i] - zeroPoint) * scale;
+    }
+  }
+}
@@ -1,3 +1,6 @@
+import 'dart:math' as math;
+import 'dart:typed_data';
+
 /// Hand landmark model variant for landmark extraction.
 ///
 /// Only the full model is available to match the Python implementation.
@@ -18,6 +21,21 @@ enum HandMode {
   boxesAndLandmarks,
 }
 
+/// How [HandDetector.detectStream] handles frames that arrive while an
+/// earlier frame is still being processed.
+enum FrameDropPolicy {
+  /// Keep only the newest pending frame; older pending frames are dropped.
+  latestOnly,
+
+  /// Queue up to `maxQueuedFrames` pending frames, dropping the oldest when
+  /// the queue is full.
+  boundedQueue,
+
+  /// Pause the input stream while `maxQueuedFrames` frames are pending, so
+  /// the producer is throttled and no frame is dropped.
+  blockProducer,
+}
+
 /// Performance optimization mode for TensorFlow Lite inference.
 ///
 /// Controls CPU/GPU acceleration via TensorFlow Lite delegates.
@@ -121,6 +139,151 @@ class PerformanceConfig {
   }
 }
 
+/// A rectangle of source pixels used as a palm detection tile.
+typedef PalmTile = ({int x, int y, int width, int height});
+
+/// Tiled palm detection for high-resolution images.
+///
+/// The palm model sees the whole image letterboxed to 192x192, so on 4K
+/// frames distant hands shrink to a few pixels and are missed. With tiling,
+/// palms are also detected on a [columns] x [rows] grid of overlapping tiles,
+/// each letterboxed to the model input on its own (a finer level of the
+/// image pyramid), then mapped back to image coordinates and merged with the
+/// whole-frame detections by the palm distance NMS.
+///
+/// Each tile costs one palm inference, so a 3x2 grid with [includeFullFrame]
+/// runs the palm model 7 times per image. Tiles are never upsampled: on
+/// images too small for the grid, fewer tiles are used.
+///
+/// Example:
+/// ```dart
+/// final detector = HandDetector(
+///   palmTiling: const PalmTiling(columns: 3, rows: 2),
+/// );
+/// ```
+class PalmTiling {
+  /// Tiles across the image width.
+  final int columns;
+
+  /// Tiles across the image height.
+  final int rows;
+
+  /// Fraction of a tile shared with each neighbour (0.0 to 0.5). Hands up to
+  /// this fraction of a tile are always seen whole by some tile.
+  final double overlap;
+
+  /// Whether to also detect on the whole image, for hands larger than a
+  /// tile.
+  final bool includeFullFrame;
+
+  /// Creates a tiling configuration.
+  const PalmTiling({
+    required this.columns,
+    required this.rows,
+    this.overlap = 0.25,
+    this.includeFullFrame = true,
+  })  : assert(columns > 0 && rows > 0),
+        assert(overlap >= 0.0 && overlap <= 0.5);
+
+  /// Whether the grid has more than one tile.
+  bool get isEnabled => columns * rows > 1;
+
+  /// Lays out the tiles for a [width] x [height] image: the whole image
+  /// first when [includeFullFrame], then the grid row by row.
+  ///
+  /// Tiles are spread evenly from edge to edge with even origins, and none
+  /// is smaller than [minTileSize] (the palm input size) unless the image
+  /// is. Mirrors `hand_detection_tflite_palm_tile_grid`.
+  List<PalmTile> tiles(int width, int height, {int minTileSize = 192}) {
+    final (cols, tileWidth) = _tileAxis(width, columns, minTileSize);
+    final (rowCount, tileHeight) = _tileAxis(height, rows, minTileSize);
+    final single = cols == 1 && rowCount == 1;
+    final out = <PalmTile>[
+      if (includeFullFrame || single)
+        (x: 0, y: 0, width: width, height: height),
+    ];
+    if (single) return out;
+
+    final stepX = cols > 1 ? (width - tileWidth) / (cols - 1) : 0.0;
+    final stepY = rowCount > 1 ? (height - tileHeight) / (rowCount - 1) : 0.0;
+    for (int r = 0; r < rowCount; r++) {
+      final y = (r * stepY).round() & ~1;
+      final bottom = r == rowCount - 1 ? height : y + tileHeight;
+      for (int c = 0; c < cols; c++) {
+        final x = (c * stepX).round() & ~1;
+        final right = c == cols - 1 ? width : x + tileWidth;
+        out.add((x: x, y: y, width: right - x, height: bottom - y));
+      }
+    }
+    return out;
+  }
+
+  (int, int) _tileAxis(int extent, int count, int minSize) {
+    final floorSize = math.min(extent, minSize);
+    for (; count > 1; count--) {
+      final size = extent / (count - (count - 1) * overlap);
+      if (size >= floorSize) return (count, math.min(extent, size.round()));
+    }
+    return (1, extent);
+  }
+}
+
+/// Temporal smoothing of hand landmarks across consecutive frames, for
+/// `HandDetector(landmarkSmoothing: ...)`.
+///
+/// Uses the One Euro filter: a low-pass filter whose cutoff frequency is
+/// [minCutoff] at rest and rises by [beta] per unit of speed, so jitter of a
+/// still hand is removed while fast motion keeps little lag. Speeds are
+/// measured in hand sizes per second (the side of the hand's crop square),
+/// so the same settings work at any resolution and hand distance.
+/// [LandmarkSmoothing.ema] disables the speed term for a plain exponential
+/// moving average. The defaults are MediaPipe's hand landmark smoothing
+/// settings.
+///
+/// Hands are matched to the previous frame's hands by the position of their
+/// crop square; a hand without a match starts unsmoothed.
+///
+/// Example:
+/// ```dart
+/// final detector = HandDetector(
+///   trackHands: true,
+///   landmarkSmoothing: const LandmarkSmoothing(),
+/// );
+/// ```
+class LandmarkSmoothing {
+  /// Cutoff frequency at rest in Hz. Lower removes more jitter.
+  final double minCutoff;
+
+  /// Cutoff increase in Hz per hand size per second of speed. Higher
+  /// reduces lag on fast motion.
+  final double beta;
+
+  /// Cutoff frequency in Hz of the speed estimate.
+  final double derivativeCutoff;
+
+  /// Fixed frame rate of the input, or null to time frames with a wall
+  /// clock. Set it when frames are not processed in real time, e.g. when
+  /// decoding a video file faster than it plays.
+  final double? frameRate;
+
+  /// Creates a One Euro smoothing configuration.
+  const LandmarkSmoothing({
+    this.minCutoff = 0.05,
+    this.beta = 80.0,
+    this.derivativeCutoff = 1.0,
+    this.frameRate,
+  })  : assert(minCutoff > 0 && derivativeCutoff > 0),
+        assert(beta >= 0),
+        assert(frameRate == null || frameRate > 0);
+
+  /// Creates an exponential moving average with a fixed [cutoff] in Hz.
+  const LandmarkSmoothing.ema({double cutoff = 3.0, this.frameRate})
+      : minCutoff = cutoff,
+        beta = 0,
+        derivativeCutoff = 1.0,
+        assert(cutoff > 0);
+}
+
 /// Collection of hand landmarks with confidence score (internal use).
 class HandLandmarks {
   /// List of 21 landmarks extracted from the hand landmark model.
@@ -468,3 +631,495 @@ class Hand {
         '  coords:\n$landmarksInfo\n)';
   }
 }
+
+/// Detection results of one frame packed into a single [Float32List], as
+/// returned by `HandDetector.detectPacked` and
+/// `HandDetector.detectOnMatPacked`.
+///
+/// Instead of a [Hand] object graph (a [BoundingBox] and 21 [HandLandmark]s
+/// per hand), [data] holds one section per field covering all hands in order
+/// (struct of arrays), so a frame costs one allocation whatever the hand
+/// count:
+///
+/// - boxes, 4 per hand: left, top, right, bottom
+/// - scores, 1 per hand: palm detection score
+/// - landmark scores, 1 per hand: landmark model score (visibility)
+/// - handedness, 1 per hand: 0 = left, 1 = right, NaN = unknown
+/// - rotations, 4 per hand: rotation, rotated center x and y, rotated size
+/// - landmarks, 63 per hand when [hasLandmarks]: x, y, z of 21 landmarks
+///
+/// Coordinates are in image pixels, as in [Hand]. Index hands with `[]` for
+/// a [PackedHand] view, or call [toHands] to materialize [Hand] objects.
+class PackedHands {
+  /// Floats per hand before the landmarks section.
+  static const int headerFloats = 11;
+
+  /// Landmark floats per hand when [hasLandmarks].
+  static const int landmarkFloats = numHandLandmarks * 3;
+
+  /// Packed sections, see the class documentation.
+  final Float32List data;
+
+  /// Number of hands.
+  final int length;
+
+  /// Width of the original image in pixels.
+  final int imageWidth;
+
+  /// Height of the original image in pixels.
+  final int imageHeight;
+
+  /// Whether the landmarks section is present ([HandMode.boxesAndLandmarks]).
+  final bool hasLandmarks;
+
+  /// Wraps packed sections of [length] hands in [data].
+  PackedHands(
+    this.data, {
+    required this.length,
+    required this.imageWidth,
+    required this.imageHeight,
+    required this.hasLandmarks,
+  }) {
+    if (data.length < length * floatsPerHand) {
+      throw ArgumentError.value(data.length, 'data',
+          'too short for $length hands of $floatsPerHand floats');
+    }
+  }
+
+  /// Allocates zeroed sections for [length] hands.
+  PackedHands.allocate(
+    this.length, {
+    required this.imageWidth,
+    required this.imageHeight,
+    required this.hasLandmarks,
+  }) : data = Float32List(
+            length * (headerFloats + (hasLandmarks ? landmarkFloats : 0)));
+
+  /// Packs [hands] of one [imageWidth] x [imageHeight] frame. Unless
+  /// [hasLandmarks] is given, the landmarks section is present when any hand
+  /// has landmarks.
+  factory PackedHands.fromHands(
+    List<Hand> hands, {
+    required int imageWidth,
+    required int imageHeight,
+    bool? hasLandmarks,
+  }) {
+    final packed = PackedHands.allocate(
+      hands.length,
+      imageWidth: imageWidth,
+      imageHeight: imageHeight,
+      hasLandmarks: hasLandmarks ?? hands.any((h) => h.hasLandmarks),
+    );
+    for (int i = 0; i < hands.length; i++) {
+      packed.setHand(i, hands[i]);
+    }
+    return packed;
+  }
+
+  /// Floats per hand over all sections.
+  int get floatsPerHand =>
+      headerFloats + (hasLandmarks ? landmarkFloats : 0);
+
+  /// Start of the boxes section in [data].
+  int get boxesOffset => 0;
+
+  /// Start of the palm scores section in [data].
+  int get scoresOffset => 4 * length;
+
+  /// Start of the landmark scores section in [data].
+  int get landmarkScoresOffset => 5 * length;
+
+  /// Start of the handedness section in [data].
+  int get handednessOffset => 6 * length;
+
+  /// Start of the rotations section in [data].
+  int get rotationsOffset => 7 * length;
+
+  /// Start of the landmarks section in [data].
+  int get landmarksOffset => headerFloats * length;
+
+  /// View of the landmarks section: 63 floats per hand.
+  Float32List get landmarks => Float32List.sublistView(data, landmarksOffset,
+      landmarksOffset + (hasLandmarks ? landmarkFloats * length : 0));
+
+  /// View of the landmark scores section: one float per hand.
+  Float32List get landmarkScores => Float32List.sublistView(
+      data, landmarkScoresOffset, landmarkScoresOffset + length);
+
+  /// View of the handedness section: one float per hand.
+  Float32List get handedness => Float32List.sublistView(
+      data, handednessOffset, handednessOffset + length);
+
+  /// Whether the frame has no hands.
+  bool get isEmpty => length == 0;
+
+  /// Whether the frame has at least one hand.
+  bool get isNotEmpty => length != 0;
+
+  /// View of hand [index].
+  PackedHand operator [](int index) {
+    RangeError.checkValidIndex(index, this, 'index', length);
+    return PackedHand._(this, index);
+  }
+
+  /// Writes [hand] into slot [index].
+  void setHand(int index, Hand hand) {
+    RangeError.checkValidIndex(index, this, 'index', length);
+    final box = hand.boundingBox;
+    data
+      ..[boxesOffset + 4 * index] = box.left
+      ..[boxesOffset + 4 * index + 1] = box.top
+      ..[boxesOffset + 4 * index + 2] = box.right
+      ..[boxesOffset + 4 * index + 3] = box.bottom
+      ..[scoresOffset + index] = hand.score
+      ..[landmarkScoresOffset + index] =
+          hand.hasLandmarks ? hand.landmarks.first.visibility : 0
+      ..[handednessOffset + index] = switch (hand.handedness) {
+        Handedness.left => 0,
+        Handedness.right => 1,
+        null => double.nan,
+      }
+      ..[rotationsOffset + 4 * index] = hand.rotation ?? 0
+      ..[rotationsOffset + 4 * index + 1] = hand.rotatedCenterX ?? 0
+      ..[rotationsOffset + 4 * index + 2] = hand.rotatedCenterY ?? 0
+      ..[rotationsOffset + 4 * index + 3] = hand.rotatedSize ?? 0;
+    if (!hasLandmarks) return;
+    final base = landmarksOffset + landmarkFloats * index;
+    for (final lm in hand.landmarks) {
+      final k = base + lm.type.index * 3;
+      data
+        ..[k] = lm.x
+        ..[k + 1] = lm.y
+        ..[k + 2] = lm.z;
+    }
+  }
+
+  /// Copies the hands at [indices] into new packed sections.
+  PackedHands select(List<int> indices) {
+    final out = PackedHands.allocate(
+      indices.length,
+      imageWidth: imageWidth,
+      imageHeight: imageHeight,
+      hasLandmarks: hasLandmarks,
+    );
+    void copy(int from, int to, int width) {
+      for (int j = 0; j < indices.length; j++) {
+        final src = from + indices[j] * width;
+        out.data.setRange(to + j * width, to + (j + 1) * width, data, src);
+      }
+    }
+
+    copy(boxesOffset, out.boxesOffset, 4);
+    copy(scoresOffset, out.scoresOffset, 1);
+    copy(landmarkScoresOffset, out.landmarkScoresOffset, 1);
+    copy(handednessOffset, out.handednessOffset, 1);
+    copy(rotationsOffset, out.rotationsOffset, 4);
+    if (hasLandmarks) {
+      copy(landmarksOffset, out.landmarksOffset, landmarkFloats);
+    }
+    return out;
+  }
+
+  /// Materializes every hand as a [Hand].
+  List<Hand> toHands() => [for (int i = 0; i < length; i++) this[i].toHand()];
+}
+
+/// One hand of a [PackedHands] frame, read straight from the packed data.
+///
+/// A view holds only the frame and an index: reading a field allocates
+/// nothing.
+class PackedHand {
+  /// The frame this hand belongs to.
+  final PackedHands hands;
+
+  /// Index of this hand in [hands].
+  final int index;
+
+  const PackedHand._(this.hands, this.index);
+
+  double _at(int offset) => hands.data[offset];
+
+  /// Left edge of the bounding box in pixels.
+  double get left => _at(hands.boxesOffset + 4 * index);
+
+  /// Top edge of the bounding box in pixels.
+  double get top => _at(hands.boxesOffset + 4 * index + 1);
+
+  /// Right edge of the bounding box in pixels.
+  double get right => _at(hands.boxesOffset + 4 * index + 2);
+
+  /// Bottom edge of the bounding box in pixels.
+  double get bottom => _at(hands.boxesOffset + 4 * index + 3);
+
+  /// Palm detection confidence (0.0 to 1.0), as [Hand.score].
+  double get score => _at(hands.scoresOffset + index);
+
+  /// Landmark model confidence, the visibility of every landmark.
+  double get landmarkScore => _at(hands.landmarkScoresOffset + index);
+
+  /// Left or right hand, or null if not determined.
+  Handedness? get handedness {
+    final value = _at(hands.handednessOffset + index);
+    if (value.isNaN) return null;
+    return value > 0.5 ? Handedness.right : Handedness.left;
+  }
+
+  /// Rotation of the hand square in radians.
+  double get rotation => _at(hands.rotationsOffset + 4 * index);
+
+  /// Center x of the rotated hand square in pixels.
+  double get rotatedCenterX => _at(hands.rotationsOffset + 4 * index + 1);
+
+  /// Center y of the rotated hand square in pixels.
+  double get rotatedCenterY => _at(hands.rotationsOffset + 4 * index + 2);
+
+  /// Side of the rotated hand square in pixels.
+  double get rotatedSize => _at(hands.rotationsOffset + 4 * index + 3);
+
+  /// Whether landmark fields can be read.
+  bool get hasLandmarks => hands.hasLandmarks;
+
+  int _landmark(HandLandmarkType type) {
+    if (!hands.hasLandmarks) {
+      throw StateError('Packed hands have no landmarks (HandMode.boxes).');
+    }
+    return hands.landmarksOffset +
+        PackedHands.landmarkFloats * index +
+        type.index * 3;
+  }
+
+  /// X coordinate of landmark [type] in pixels.
+  double x(HandLandmarkType type) => _at(_landmark(type));
+
+  /// Y coordinate of landmark [type] in pixels.
+  double y(HandLandmarkType type) => _at(_landmark(type) + 1);
+
+  /// Relative depth of landmark [type].
+  double z(HandLandmarkType type) => _at(_landmark(type) + 2);
+
+  /// Materializes this hand as a [Hand].
+  Hand toHand() {
+    final visibility = landmarkScore;
+    return Hand(
+      boundingBox:
+          BoundingBox(left: left, top: top, right: right, bottom: bottom),
+      score: score,
+      landmarks: hasLandmarks
+          ? [
+              for (final type in HandLandmarkType.values)
+                HandLandmark(
+                  type: type,
+                  x: x(type),
+                  y: y(type),
+                  z: z(type),
+                  visibility: visibility,
+                ),
+            ]
+          : const [],
+      imageWidth: hands.imageWidth,
+      imageHeight: hands.imageHeight,
+      handedness: handedness,
+      rotation: rotation,
+      rotatedCenterX: rotatedCenterX,
+      rotatedCenterY: rotatedCenterY,
+      rotatedSize: rotatedSize,
+    );
+  }
+}
+
+/// A YUV 4:2:0 camera frame for `HandDetector.detectOnYuv`.
+///
+/// Uses the plane layout of Android's `YUV_420_888` (and Flutter's
+/// `CameraImage`): a full-resolution Y plane plus 2x2-subsampled U and V
+/// planes, each with a row stride, and a pixel stride shared by U and V. This
+/// covers I420 (separate planes, pixel stride 1) as well as NV12 and NV21
+/// (one interleaved chroma plane, pixel stride 2).
+class YuvFrame {
+  /// Frame width in pixels.
+  final int width;
+
+  /// Frame height in pixels.
+  final int height;
+
+  /// Luma plane.
+  final Uint8List y;
+
+  /// Cb plane. For NV12/NV21 this is a view into the interleaved chroma.
+  final Uint8List u;
+
+  /// Cr plane. For NV12/NV21 this is a view into the interleaved chroma.
+  final Uint8List v;
+
+  /// Bytes between rows of [y].
+  final int yRowStride;
+
+  /// Bytes between rows of [u] and [v].
+  final int uvRowStride;
+
+  /// Bytes between horizontally adjacent samples of [u] and [v].
+  final int uvPixelStride;
+
+  /// Creates a frame from explicit planes and strides, e.g. the three
+  /// planes of a `CameraImage` in `ImageFormatGroup.yuv420`.
+  const YuvFrame({
+    required this.width,
+    required this.height,
+    required this.y,
+    required this.u,
+    required this.v,
+    required this.yRowStride,
+    required this.uvRowStride,
+    required this.uvPixelStride,
+  });
+
+  /// Wraps a packed NV12 buffer (Y plane followed by interleaved UV).
+  factory YuvFrame.nv12(Uint8List data, int width, int height) =>
+      _semiPlanar(data, width, height, uFirst: true);
+
+  /// Wraps a packed NV21 buffer (Y plane followed by interleaved VU).
+  factory YuvFrame.nv21(Uint8List data, int width, int height) =>
+      _semiPlanar(data, width, height, uFirst: false);
+
+  /// Wraps a packed I420 buffer (Y, then U, then V planes).
+  factory YuvFrame.i420(Uint8List data, int width, int height) {
+    final ySize = width * height;
+    final cw = (width + 1) ~/ 2;
+    final cSize = cw * ((height + 1) ~/ 2);
+    return YuvFrame(
+      width: width,
+      height: height,
+      y: Uint8List.sublistView(data, 0, ySize),
+      u: Uint8List.sublistView(data, ySize, ySize + cSize),
+      v: Uint8List.sublistView(data, ySize + cSize, ySize + 2 * cSize),
+      yRowStride: width,
+      uvRowStride: cw,
+      uvPixelStride: 1,
+    );
+  }
+
+  static YuvFrame _semiPlanar(Uint8List data, int width, int height,
+      {required bool uFirst}) {
+    final ySize = width * height;
+    final rowStride = 2 * ((width + 1) ~/ 2);
+    final cSize = rowStride * ((height + 1) ~/ 2);
+    final first = Uint8List.sublistView(data, ySize, ySize + cSize);
+    final second = Uint8List.sublistView(data, ySize + 1, ySize + cSize);
+    return YuvFrame(
+      width: width,
+      height: height,
+      y: Uint8List.sublistView(data, 0, ySize),
+      u: uFirst ? first : second,
+      v: uFirst ? second : first,
+      yRowStride: width,
+      uvRowStride: rowStride,
+      uvPixelStride: 2,
+    );
+  }
+
+  /// Throws [ArgumentError] when the dimensions, strides or plane sizes are
+  /// inconsistent.
+  void validate() {
+    if (width <= 0 || height <= 0) {
+      throw ArgumentError('Invalid YUV frame size ${width}x$height.');
+    }
+    final cw = (width + 1) ~/ 2;
+    final ch = (height + 1) ~/ 2;
+    if (yRowStride < width ||
+        uvPixelStride < 1 ||
+        uvRowStride < (cw - 1) * uvPixelStride + 1) {
+      throw ArgumentError('Invalid YUV frame strides.');
+    }
+    final chromaBytes = (ch - 1) * uvRowStride + (cw - 1) * uvPixelStride + 1;
+    if (y.length < (height - 1) * yRowStride + width ||
+        u.length < chromaBytes ||
+        v.length < chromaBytes) {
+      throw ArgumentError('YUV frame planes are too small.');
+    }
+  }
+}
+
+/// Wall-time breakdown of one detection call, recorded when the detector is
+/// created with `collectStats: true` and read from `HandDetector.lastStats`.
+///
+/// Each stage accumulates over the whole call: with [PalmTiling] the palm
+/// stages add up over all tiles, and with several landmark calls the
+/// landmark stages add up over all hands. Stages that did not run (image
+/// decode on `detectOnMat`, palm detection on tracked frames, landmarks in
+/// [HandMode.boxes]) stay at zero. Landmark calls on a pool of interpreters
+/// can overlap, so the stages may sum to more than [total].
+///
+/// The native pipeline runs all model stages in one native call: only
+/// [decode] and [total] are recorded for it.
+class DetectionStats {
+  /// Image decode (`cv.imdecode`) or YUV to BGR conversion.
+  Duration decode = Duration.zero;
+
+  /// Letterboxing the image into the palm input tensor.
+  Duration palmPreprocess = Duration.zero;
+
+  /// Palm model inference, including the hop to the interpreter isolate.
+  Duration palmInference = Duration.zero;
+
+  /// Output dequantization, anchor decoding and NMS of the palm stage.
+  Duration palmPostprocess = Duration.zero;
+
+  /// Rotated crops of the hand regions (`rotateAndCropRectangle`).
+  Duration crop = Duration.zero;
+
+  /// Letterboxing the hand crops into the landmark input tensor.
+  Duration landmarkPreprocess = Duration.zero;
+
+  /// Landmark model inference, one entry per invocation: one per hand, or a
+  /// single entry covering all hands of a batched call.
+  final List<Duration> landmarkInference = [];
+
+  /// Parsing landmark outputs and building the [Hand] results.
+  Duration resultBuilding = Duration.zero;
+
+  /// Time spent waiting for a palm or landmark interpreter held by another
+  /// call.
+  Duration interpreterLockWait = Duration.zero;
+
+  /// Wall time of the whole call.
+  Duration total = Duration.zero;
+
+  /// Adds the stage times of [other], e.g. those recorded on a worker
+  /// isolate, to this call's. [total] is left unchanged.
+  void add(DetectionStats other) {
+    decode += other.decode;
+    palmPreprocess += other.palmPreprocess;
+    palmInference += other.palmInference;
+    palmPostprocess += other.palmPostprocess;
+    crop += other.crop;
+    landmarkPreprocess += other.landmarkPreprocess;
+    landmarkInference.addAll(other.landmarkInference);
+    resultBuilding += other.resultBuilding;
+    interpreterLockWait += other.interpreterLockWait;
+  }
+
+  /// Sum of [landmarkInference].
+  Duration get landmarkInferenceTotal =>
+      landmarkInference.fold(Duration.zero, (sum, d) => sum + d);
+
+  /// Stage durations in microseconds, keyed by stage name.
+  Map<String, int> toMap() => {
+        'decode': decode.inMicroseconds,
+        'palmPreprocess': palmPreprocess.inMicroseconds,
+        'palmInference': palmInference.inMicroseconds,
+        'palmPostprocess': palmPostprocess.inMicroseconds,
+        'crop': crop.inMicroseconds,
+        'landmarkPreprocess': landmarkPreprocess.inMicroseconds,
+        'landmarkInference': landmarkInferenceTotal.inMicroseconds,
+        'resultBuilding': resultBuilding.inMicroseconds,
+        'interpreterLockWait': interpreterLockWait.inMicroseconds,
+        'total': total.inMicroseconds,
+      };
+
+  @override
+  String toString() {
+    final stages = toMap().entries.map(
+        (e) => '${e.key}=${(e.value / 1000).toStringAsFixed(2)}ms');
+    return 'DetectionStats(${stages.join(', ')}, '
+        'landmarkInvocations=${landmarkInference.length})';
+  }
+}
@@ -0,0 +1,263 @@
+// Per-stage micro-benchmarks for the native hand detection pipeline.
+//
+//   hand_detection_bench --benchmark_format=json --benchmark_out=bench.json
+//
+// Kernels run on synthetic inputs; the TFLite benchmarks load the bundled
+// models (HAND_TFLITE_LIB overrides the runtime library) and are skipped when
+// they cannot be loaded. Arguments are encoded in each benchmark name, e.g.
+// BM_Letterbox/1920/1080 or BM_LandmarkInvoke/4/2 (hands, threads).
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "hand_palm_anchors.h"
+#include "hand_tflite.h"
+#include "include/hand_detection_tflite/hand_detection_tflite_kernels.h"
+
+namespace hand_detection_tflite {
+namespace bench {
+
+namespace {
+
+constexpr int32_t kPalmInputSize = 192;
+constexpr int32_t kLandmarkInputSize = 224;
+constexpr int32_t kNumAnchors = 2016;
+constexpr int32_t kNumLandmarks = 21;
+
+std::string AssetPath(const char* relative) {
+  return std::string(HAND_PIPELINE_BENCH_ASSETS_DIR) + "/" + relative;
+}
+
+void UseBundledTfLite() {
+  setenv("HAND_TFLITE_LIB",
+         AssetPath("bin/libtensorflowlite_c-linux.so").c_str(), 0);
+}
+
+std::vector<uint8_t> RandomBytes(size_t size) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<uint8_t> bytes(size);
+  for (uint8_t& b : bytes) b = static_cast<uint8_t>(dist(rng));
+  return bytes;
+}
+
+// The palm model's compile-time anchor table.
+const float* BundledPalmAnchors() {
+  int32_t num_anchors = 0;
+  return hand_detection_tflite::PalmAnchors(kPalmInputSize, nullptr,
+                                            &num_anchors);
+}
+
+// Raw palm outputs with `hits` anchors above a 0.5 threshold. Spread hits sit
+// on distinct anchors across the image so most survive NMS; clustered hits
+// share one center so NMS rejects all but one.
+void SyntheticPalmOutputs(int32_t hits, bool clustered,
+                          std::vector<float>* boxes,
+                          std::vector<float>* scores) {
+  boxes->assign(static_cast<size_t>(kNumAnchors) *
+                    HAND_DETECTION_TFLITE_PALM_BOX_STRIDE,
+                0.0f);
+  scores->assign(kNumAnchors, -6.0f);
+  const int32_t stride = std::max(1, kNumAnchors / std::max(1, hits));
+  for (int32_t h = 0; h < hits; ++h) {
+    const int32_t i = clustered ? h : (h * stride) % kNumAnchors;
+    (*scores)[i] = 2.0f + 0.001f * h;
+    float* box = boxes->data() +
+                 static_cast<size_t>(i) * HAND_DETECTION_TFLITE_PALM_BOX_STRIDE;
+    box[2] = 20.0f;
+    box[3] = 20.0f;
+    box[9] = -10.0f;  // Keypoint 2 above keypoint 0: upright palm.
+  }
+}
+
+}  // namespace
+
+// Letterbox + normalize of a BGR frame into the 192x192 palm input.
+void BM_Letterbox(benchmark::State& state) {
+  const int32_t w = static_cast<int32_t>(state.range(0));
+  const int32_t h = static_cast<int32_t>(state.range(1));
+  const std::vector<uint8_t> src = RandomBytes(static_cast<size_t>(w) * h * 3);
+  std::vector<float> dst(kPalmInputSize * kPalmInputSize * 3);
+  for (auto _ : state) {
+    hand_detection_tflite_letterbox_bgr_to_rgb_f32(
+        src.data(), w, h, w * 3, dst.data(), kPalmInputSize, kPalmInputSize,
+        nullptr);
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kPalmInputSize *
+                          kPalmInputSize);
+}
+BENCHMARK(BM_Letterbox)
+    ->Args({640, 480})
+    ->Args({1280, 720})
+    ->Args({1920, 1080})
+    ->Args({3840, 2160})
+    ->ThreadRange(1, 4);
+
+// Same as BM_Letterbox for an NV12 frame.
+void BM_LetterboxYuv420(benchmark::State& state) {
+  const int32_t w = static_cast<int32_t>(state.range(0));
+  const int32_t h = static_cast<int32_t>(state.range(1));
+  const std::vector<uint8_t> src =
+      RandomBytes(static_cast<size_t>(w) * h * 3 / 2);
+  const HandYuv420Image image = {src.data(), src.data() + w * h,
+                                 src.data() + w * h + 1, w, w, 2};
+  std::vector<float> dst(kPalmInputSize * kPalmInputSize * 3);
+  for (auto _ : state) {
+    hand_detection_tflite_letterbox_yuv420_to_rgb_f32(
+        &image, w, h, dst.data(), kPalmInputSize, kPalmInputSize, nullptr);
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kPalmInputSize *
+                          kPalmInputSize);
+}
+BENCHMARK(BM_LetterboxYuv420)
+    ->Args({640, 480})
+    ->Args({1280, 720})
+    ->Args({1920, 1080})
+    ->Args({3840, 2160});
+
+// Rotated crops of a 1920x1080 frame into 224x224 landmark inputs, for
+// (crop size, hands).
+void BM_WarpCrop(benchmark::State& state) {
+  const int32_t w = 1920;
+  const int32_t h = 1080;
+  const int32_t crop = static_cast<int32_t>(state.range(0));
+  const int32_t hands = static_cast<int32_t>(state.range(1));
+  const std::vector<uint8_t> src = RandomBytes(static_cast<size_t>(w) * h * 3);
+  std::vector<float> dst(static_cast<size_t>(hands) * kLandmarkInputSize *
+                         kLandmarkInputSize * 3);
+  for (auto _ : state) {
+    for (int32_t i = 0; i < hands; ++i) {
+      hand_detection_tflite_warp_crop_bgr_to_rgb_f32(
+          src.data(), w, h, w * 3, 200.0f + 300.0f * i, 540.0f, 0.3f * i,
+          crop,
+          dst.data() + static_cast<size_t>(i) * kLandmarkInputSize *
+                           kLandmarkInputSize * 3,
+          kLandmarkInputSize);
+    }
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(state.iterations() * hands);
+}
+BENCHMARK(BM_WarpCrop)
+    ->ArgsProduct({{200, 600, 1200}, {1, 2, 4}})
+    ->ThreadRange(1, 4);
+
+// Anchor decode with `hits` spread candidates (few NMS rejections).
+void BM_DecodePalms(benchmark::State& state) {
+  const int32_t hits = static_cast<int32_t>(state.range(0));
+  std::vector<float> boxes;
+  std::vector<float> scores;
+  SyntheticPalmOutputs(hits, false, &boxes, &scores);
+  const float* anchors = BundledPalmAnchors();
+  std::vector<HandPalmDetection> out(10);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hand_detection_tflite_decode_palms(
+        boxes.data(), scores.data(), kNumAnchors, anchors, 0.5f,
+        static_cast<float>(kPalmInputSize), 1920, 1080, out.data(),
+        static_cast<int32_t>(out.size())));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumAnchors);
+}
+BENCHMARK(BM_DecodePalms)->Arg(0)->Arg(4)->Arg(32)->Arg(256);
+
+// Anchor decode where all `hits` candidates overlap, so NMS dominates.
+void BM_DecodePalmsNms(benchmark::State& state) {
+  const int32_t hits = static_cast<int32_t>(state.range(0));
+  std::vector<float> boxes;
+  std::vector<float> scores;
+  SyntheticPalmOutputs(hits, true, &boxes, &scores);
+  const float* anchors = BundledPalmAnchors();
+  std::vector<HandPalmDetection> out(10);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hand_detection_tflite_decode_palms(
+        boxes.data(), scores.data(), kNumAnchors, anchors, 0.5f,
+        static_cast<float>(kPalmInputSize), 1920, 1080, out.data(),
+        static_cast<int32_t>(out.size())));
+  }
+  state.SetItemsProcessed(state.iterations() * hits);
+}
+BENCHMARK(BM_DecodePalmsNms)->Arg(16)->Arg(128)->Arg(kNumAnchors);
+
+// Landmark back-projection for `hands` hands.
+void BM_ProjectLandmarks(benchmark::State& state) {
+  const int32_t hands = static_cast<int32_t>(state.range(0));
+  std::vector<float> raw(static_cast<size_t>(hands) * kNumLandmarks * 3);
+  for (size_t i = 0; i < raw.size(); ++i) raw[i] = static_cast<float>(i % 224);
+  std::vector<float> out(raw.size());
+  for (auto _ : state) {
+    for (int32_t i = 0; i < hands; ++i) {
+      hand_detection_tflite_project_landmarks(
+          raw.data() + i * kNumLandmarks * 3, kNumLandmarks,
+          static_cast<float>(kLandmarkInputSize), 400, 960.0f, 540.0f, 0.4f,
+          1920, 1080, out.data() + i * kNumLandmarks * 3);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * hands);
+}
+BENCHMARK(BM_ProjectLandmarks)->Arg(1)->Arg(2)->Arg(4)->Arg(10);
+
+// Palm model invoke, for interpreter threads.
+void BM_PalmInvoke(benchmark::State& state) {
+  UseBundledTfLite();
+  TfLiteModelRunner runner;
+  std::string error;
+  if (!runner.Load(AssetPath("models/hand_detection.tflite"),
+                   static_cast<int32_t>(state.range(0)), &error)) {
+    state.SkipWithError(error.c_str());
+    return;
+  }
+  for (auto _ : state) {
+    if (!runner.Invoke(&error)) {
+      state.SkipWithError(error.c_str());
+      break;
+    }
+  }
+}
+BENCHMARK(BM_PalmInvoke)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Landmark model invoke with one [hands, 224, 224, 3] batch, for
+// (hands, interpreter threads).
+void BM_LandmarkInvoke(benchmark::State& state) {
+  UseBundledTfLite();
+  const int32_t hands = static_cast<int32_t>(state.range(0));
+  TfLiteModelRunner runner;
+  std::string error;
+  const int dims[4] = {hands, kLandmarkInputSize, kLandmarkInputSize, 3};
+  if (!runner.Load(AssetPath("models/hand_landmark_full.tflite"),
+                   static_cast<int32_t>(state.range(1)), &error) ||
+      !runner.ResizeInput(dims, 4, &error)) {
+    state.SkipWithError(error.c_str());
+    return;
+  }
+  for (auto _ : state) {
+    if (!runner.Invoke(&error)) {
+      state.SkipWithError(error.c_str());
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * hands);
+}
+BENCHMARK(BM_LandmarkInvoke)
+    ->ArgsProduct({{1, 2, 4}, {1, 2, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace bench
+}  // namespace hand_detection_tflite
+
+BENCHMARK_MAIN();
@@ -0,0 +1,688 @@
+// hand_detect: headless batch hand detection over image files.
+//
+//   hand_detect [options] <image|directory>...
+//   hand_detect [options] --video-size WxH --video <file|->
+//
+// Directories are walked recursively for .jpg/.jpeg/.png files. Each worker
+// thread owns one HandPipeline and pulls the next image from a shared queue,
+// so throughput scales with --workers up to the number of cores (pin with
+// taskset). Results go to stdout or --output as JSON Lines or the binary
+// format below; throughput and latency statistics go to stderr.
+//
+// --video reads raw BGR24 frames, e.g. from
+//   ffmpeg -i in.mp4 -f rawvideo -pix_fmt bgr24 - | hand_detect ... --video -
+// and runs them through hand_pipeline_detect_video, so decoding, palm
+// detection and landmarks overlap on consecutive frames. One JSON line per
+// frame is written in frame order.
+//
+// Binary format (little-endian, records in completion order):
+//   header: "HDET" magic, uint32 version (1), uint32 sizeof(HandPipelineHand)
+//   record: uint32 path_length, path bytes (no terminator),
+//           int32 width, int32 height, int32 count (negative on failure),
+//           count HandPipelineHand structs
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hand_image_io.h"
+#include "include/hand_detection_tflite/hand_pipeline.h"
+
+namespace {
+
+using hand_detection_tflite::BgrImage;
+using hand_detection_tflite::DecodeImageFile;
+using hand_detection_tflite::IsSupportedImagePath;
+
+constexpr uint32_t kBinaryVersion = 1;
+
+enum class OutputFormat { kJsonl, kBinary };
+
+struct CliOptions {
+  std::string models_dir;
+  std::vector<std::string> inputs;
+  std::string list_file;
+  std::string output_path;
+  OutputFormat format = OutputFormat::kJsonl;
+  int32_t workers = 1;
+  int32_t threads = 1;
+  int32_t hand_workers = 0;
+  int32_t mode = HAND_PIPELINE_MODE_BOXES_AND_LANDMARKS;
+  float confidence = 0.6f;
+  int32_t max_hands = 10;
+  float min_landmark_score = 0.5f;
+  int32_t tile_columns = 0;
+  int32_t tile_rows = 0;
+  float tile_overlap = 0.25f;
+  std::string video_path;
+  int32_t video_width = 0;
+  int32_t video_height = 0;
+  double video_fps = 30.0;
+  int32_t queue_depth = 4;
+  bool quiet = false;
+};
+
+void PrintUsage() {
+  std::fprintf(
+      stderr,
+      "Usage: hand_detect [options] <image|directory>...\n"
+      "       hand_detect [options] --video-size WxH --video <file|->\n"
+      "\n"
+      "  --models DIR             model directory (default: $HAND_MODELS_DIR\n"
+      "                           or ./assets/models)\n"
+      "  --list FILE              read image paths from FILE, one per line\n"
+      "                           ('-' for stdin)\n"
+      "  --workers N              images processed in parallel (default: 1)\n"
+      "  --threads N              TFLite threads per interpreter (default: 1)\n"
+      "  --hand-workers N         per-hand landmark and palm tile pool per\n"
+      "                           worker (default: 0, batched)\n"
+      "  --mode boxes|landmarks   default: landmarks\n"
+      "  --confidence F           palm score threshold (default: 0.6)\n"
+      "  --max-hands N            default: 10\n"
+      "  --min-landmark-score F   default: 0.5\n"
+      "  --palm-tiles CxR         also detect palms on C x R overlapping tiles\n"
+      "                           (high-resolution input; default: off)\n"
+      "  --tile-overlap F         tile overlap fraction (default: 0.25)\n"
+      "  --video PATH             raw BGR24 video frames ('-' for stdin),\n"
+      "                           processed as a pipelined stream\n"
+      "  --video-size WxH         frame size of --video\n"
+      "  --video-fps F            frame rate for timestamps (default: 30)\n"
+      "  --queue-depth N          frames decoded ahead (default: 4)\n"
+      "  --format jsonl|binary    default: jsonl\n"
+      "  --output PATH            default: stdout\n"
+      "  --quiet                  do not print statistics\n");
+}
+
+bool ParseArgs(int argc, char** argv, CliOptions* options) {
+  const char* env_models = std::getenv("HAND_MODELS_DIR");
+  options->models_dir = env_models != nullptr ? env_models : "assets/models";
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    auto value = [&](const char** out) {
+      if (i + 1 >= argc) {
+        std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+        return false;
+      }
+      *out = argv[++i];
+      return true;
+    };
+    const char* v = nullptr;
+    if (arg == "-h" || arg == "--help") {
+      return false;
+    } else if (arg == "--quiet") {
+      options->quiet = true;
+    } else if (arg == "--models") {
+      if (!value(&v)) return false;
+      options->models_dir = v;
+    } else if (arg == "--list") {
+      if (!value(&v)) return false;
+      options->list_file = v;
+    } else if (arg == "--output") {
+      if (!value(&v)) return false;
+      options->output_path = v;
+    } else if (arg == "--workers") {
+      if (!value(&v)) return false;
+      options->workers = std::max(1, std::atoi(v));
+    } else if (arg == "--threads") {
+      if (!value(&v)) return false;
+      options->threads = std::atoi(v);
+    } else if (arg == "--hand-workers") {
+      if (!value(&v)) return false;
+      options->hand_workers = std::atoi(v);
+    } else if (arg == "--confidence") {
+      if (!value(&v)) return false;
+      options->confidence = static_cast<float>(std::atof(v));
+    } else if (arg == "--max-hands") {
+      if (!value(&v)) return false;
+      options->max_hands = std::max(1, std::atoi(v));
+    } else if (arg == "--min-landmark-score") {
+      if (!value(&v)) return false;
+      options->min_landmark_score = static_cast<float>(std::atof(v));
+    } else if (arg == "--palm-tiles") {
+      if (!value(&v)) return false;
+      if (std::sscanf(v, "%dx%d", &options->tile_columns,
+                      &options->tile_rows) != 2 ||
+          options->tile_columns <= 0 || options->tile_rows <= 0) {
+        std::fprintf(stderr, "Invalid tile grid: %s\n", v);
+        return false;
+      }
+    } else if (arg == "--tile-overlap") {
+      if (!value(&v)) return false;
+      options->tile_overlap = static_cast<float>(std::atof(v));
+    } else if (arg == "--video") {
+      if (!value(&v)) return false;
+      options->video_path = v;
+    } else if (arg == "--video-size") {
+      if (!value(&v)) return false;
+      if (std::sscanf(v, "%dx%d", &options->video_width,
+                      &options->video_height) != 2 ||
+          options->video_width <= 0 || options->video_height <= 0) {
+        std::fprintf(stderr, "Invalid video size: %s\n", v);
+        return false;
+      }
+    } else if (arg == "--video-fps") {
+      if (!value(&v)) return false;
+      options->video_fps = std::atof(v);
+      if (!(options->video_fps > 0)) {
+        std::fprintf(stderr, "Invalid frame rate: %s\n", v);
+        return false;
+      }
+    } else if (arg == "--queue-depth") {
+      if (!value(&v)) return false;
+      options->queue_depth = std::max(1, std::atoi(v));
+    } else if (arg == "--mode") {
+      if (!value(&v)) return false;
+      const std::string mode = v;
+      if (mode == "boxes") {
+        options->mode = HAND_PIPELINE_MODE_BOXES;
+      } else if (mode == "landmarks") {
+        options->mode = HAND_PIPELINE_MODE_BOXES_AND_LANDMARKS;
+      } else {
+        std::fprintf(stderr, "Unknown mode: %s\n", v);
+        return false;
+      }
+    } else if (arg == "--format") {
+      if (!value(&v)) return false;
+      const std::string format = v;
+      if (format == "jsonl") {
+        options->format = OutputFormat::kJsonl;
+      } else if (format == "binary") {
+        options->format = OutputFormat::kBinary;
+      } else {
+        std::fprintf(stderr, "Unknown format: %s\n", v);
+        return false;
+      }
+    } else if (arg.size() > 1 && arg[0] == '-' && arg != "-") {
+      std::fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+      return false;
+    } else {
+      options->inputs.push_back(arg);
+    }
+  }
+  if (!options->video_path.empty()) {
+    if (options->video_width <= 0) {
+      std::fprintf(stderr, "--video needs --video-size\n");
+      return false;
+    }
+    if (options->format != OutputFormat::kJsonl) {
+      std::fprintf(stderr, "--video writes JSON Lines only\n");
+      return false;
+    }
+    return options->inputs.empty() && options->list_file.empty();
+  }
+  return !options->inputs.empty() || !options->list_file.empty();
+}
+
+// Appends supported images under path (recursively, sorted per directory).
+void CollectImages(const std::string& path, std::vector<std::string>* out) {
+  struct stat info;
+  if (stat(path.c_str(), &info) != 0) {
+    std::fprintf(stderr, "Skipping missing path: %s\n", path.c_str());
+    return;
+  }
+  if (!S_ISDIR(info.st_mode)) {
+    out->push_back(path);
+    return;
+  }
+  DIR* dir = opendir(path.c_str());
+  if (dir == nullptr) return;
+  std::vector<std::string> entries;
+  while (dirent* entry = readdir(dir)) {
+    const std::string name = entry->d_name;
+    if (name == "." || name == "..") continue;
+    entries.push_back(path + "/" + name);
+  }
+  closedir(dir);
+  std::sort(entries.begin(), entries.end());
+  for (const std::string& entry : entries) {
+    struct stat child;
+    if (stat(entry.c_str(), &child) != 0) continue;
+    if (S_ISDIR(child.st_mode)) {
+      CollectImages(entry, out);
+    } else if (IsSupportedImagePath(entry)) {
+      out->push_back(entry);
+    }
+  }
+}
+
+bool ReadList(const std::string& list_file, std::vector<std::string>* out) {
+  std::ifstream file;
+  std::istream* in = &std::cin;
+  if (list_file != "-") {
+    file.open(list_file);
+    if (!file) return false;
+    in = &file;
+  }
+  std::string line;
+  while (std::getline(*in, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (!line.empty()) out->push_back(line);
+  }
+  return true;
+}
+
+void AppendJsonString(const std::string& value, std::string* out) {
+  out->push_back('"');
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        out->append("\\\"");
+        break;
+      case '\\':
+        out->append("\\\\");
+        break;
+      case '\n':
+        out->append("\\n");
+        break;
+      case '\t':
+        out->append("\\t");
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          out->append(escaped);
+        } else {
+          out->push_back(c);
+        }
+    }
+  }
+  out->push_back('"');
+}
+
+void AppendFloat(float value, std::string* out) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.6g", value);
+  out->append(buffer);
+}
+
+// Appends `,"width":..,"height":..,"hands":[...]}` and a newline.
+void AppendJsonHands(int32_t width, int32_t height,
+                     const HandPipelineHand* hands, int32_t count,
+                     std::string* out) {
+  out->append(",\"width\":" + std::to_string(width));
+  out->append(",\"height\":" + std::to_string(height));
+  out->append(",\"hands\":[");
+  for (int32_t i = 0; i < count; ++i) {
+    const HandPipelineHand& hand = hands[i];
+    if (i > 0) out->push_back(',');
+    out->append("{\"score\":");
+    AppendFloat(hand.score, out);
+    out->append(",\"box\":[");
+    AppendFloat(hand.left, out);
+    out->push_back(',');
+    AppendFloat(hand.top, out);
+    out->push_back(',');
+    AppendFloat(hand.right, out);
+    out->push_back(',');
+    AppendFloat(hand.bottom, out);
+    out->append("],\"rotation\":");
+    AppendFloat(hand.rotation, out);
+    out->append(",\"center\":[");
+    AppendFloat(hand.center_x, out);
+    out->push_back(',');
+    AppendFloat(hand.center_y, out);
+    out->append("],\"size\":");
+    AppendFloat(hand.size, out);
+    if (hand.handedness == HAND_PIPELINE_HANDEDNESS_UNKNOWN) {
+      out->append("}");
+      continue;
+    }
+    out->append(hand.handedness == HAND_PIPELINE_HANDEDNESS_RIGHT
+                    ? ",\"handedness\":\"right\""
+                    : ",\"handedness\":\"left\"");
+    out->append(",\"landmark_score\":");
+    AppendFloat(hand.landmark_score, out);
+    out->append(",\"landmarks\":[");
+    for (int32_t j = 0; j < HAND_PIPELINE_NUM_LANDMARKS; ++j) {
+      if (j > 0) out->push_back(',');
+      out->push_back('[');
+      AppendFloat(hand.landmarks[j * 3], out);
+      out->push_back(',');
+      AppendFloat(hand.landmarks[j * 3 + 1], out);
+      out->push_back(',');
+      AppendFloat(hand.landmarks[j * 3 + 2], out);
+      out->push_back(']');
+    }
+    out->append("]}");
+  }
+  out->append("]}\n");
+}
+
+void AppendJsonRecord(const std::string& path, const BgrImage& image,
+                      const HandPipelineHand* hands, int32_t count,
+                      const std::string& error, std::string* out) {
+  out->append("{\"file\":");
+  AppendJsonString(path, out);
+  if (count < 0) {
+    out->append(",\"error\":");
+    AppendJsonString(error, out);
+    out->append("}\n");
+    return;
+  }
+  AppendJsonHands(image.width, image.height, hands, count, out);
+}
+
+template <typename T>
+void AppendRaw(const T& value, std::string* out) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendBinaryRecord(const std::string& path, const BgrImage& image,
+                        const HandPipelineHand* hands, int32_t count,
+                        std::string* out) {
+  AppendRaw(static_cast<uint32_t>(path.size()), out);
+  out->append(path);
+  AppendRaw(image.width, out);
+  AppendRaw(image.height, out);
+  AppendRaw(count, out);
+  if (count > 0) {
+    out->append(reinterpret_cast<const char*>(hands),
+                sizeof(HandPipelineHand) * count);
+  }
+}
+
+// Per-image timings in milliseconds.
+struct Timing {
+  double decode_ms;
+  double detect_ms;
+};
+
+double Percentile(std::vector<double> values, double p) {
+  if (values.empty()) return 0.0;
+  std::sort(values.begin(), values.end());
+  const size_t index = std::min(
+      values.size() - 1, static_cast<size_t>(p * (values.size() - 1) + 0.5));
+  return values[index];
+}
+
+void PrintLatency(const char* name, const std::vector<double>& values) {
+  std::fprintf(stderr,
+               "  %-7s p50 %8.2f ms  p90 %8.2f ms  p99 %8.2f ms  max %8.2f "
+               "ms\n",
+               name, Percentile(values, 0.5), Percentile(values, 0.9),
+               Percentile(values, 0.99), Percentile(values, 1.0));
+}
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// Raw BGR24 frame source and JSONL sink for hand_pipeline_detect_video.
+struct VideoStream {
+  FILE* input;
+  size_t frame_bytes;
+  double fps;
+  int32_t width;
+  int32_t height;
+  FILE* output;
+  int64_t frames_read = 0;
+  int64_t hands = 0;
+  std::string record;
+  // Report time of each frame, for the inter-frame latency statistics.
+  std::vector<double> frame_ms;
+  std::chrono::steady_clock::time_point last;
+
+  static int32_t Read(void* user_data, uint8_t* bgr, int64_t* timestamp_us) {
+    VideoStream* stream = static_cast<VideoStream*>(user_data);
+    const size_t read = std::fread(bgr, 1, stream->frame_bytes, stream->input);
+    if (read == 0 && std::feof(stream->input)) return 0;
+    if (read != stream->frame_bytes) return -1;
+    *timestamp_us =
+        static_cast<int64_t>(stream->frames_read++ * 1e6 / stream->fps);
+    return 1;
+  }
+
+  static int32_t Report(void* user_data, int64_t frame, int64_t timestamp_us,
+                        const HandPipelineHand* hands, int32_t count) {
+    VideoStream* stream = static_cast<VideoStream*>(user_data);
+    const auto now = std::chrono::steady_clock::now();
+    stream->frame_ms.push_back(
+        std::chrono::duration<double, std::milli>(now - stream->last).count());
+    stream->last = now;
+    stream->hands += count;
+    stream->record = "{\"frame\":" + std::to_string(frame) +
+                     ",\"timestamp_us\":" + std::to_string(timestamp_us);
+    AppendJsonHands(stream->width, stream->height, hands, count,
+                    &stream->record);
+    return std::fwrite(stream->record.data(), 1, stream->record.size(),
+                       stream->output) == stream->record.size()
+               ? 0
+               : 1;
+  }
+};
+
+int RunVideo(const CliOptions& options,
+             const HandPipelineOptions& pipeline_options, FILE* output) {
+  FILE* input = options.video_path == "-"
+                    ? stdin
+                    : std::fopen(options.video_path.c_str(), "rb");
+  if (input == nullptr) {
+    std::fprintf(stderr, "Cannot open video: %s\n",
+                 options.video_path.c_str());
+    return 1;
+  }
+  HandPipeline* pipeline = hand_pipeline_create(&pipeline_options);
+  if (pipeline == nullptr) {
+    std::fprintf(stderr, "Failed to create pipeline: %s\n",
+                 hand_pipeline_last_error());
+    if (input != stdin) std::fclose(input);
+    return 1;
+  }
+
+  HandVideoOptions video_options;
+  hand_video_options_init(&video_options);
+  video_options.width = options.video_width;
+  video_options.height = options.video_height;
+  video_options.queue_depth = options.queue_depth;
+  VideoStream stream = {input,
+                        static_cast<size_t>(options.video_width) *
+                            options.video_height * 3,
+                        options.video_fps,
+                        options.video_width,
+                        options.video_height,
+                        output};
+
+  const auto wall_start = std::chrono::steady_clock::now();
+  stream.last = wall_start;
+  const int64_t frames =
+      hand_pipeline_detect_video(pipeline, &video_options, VideoStream::Read,
+                                 VideoStream::Report, &stream);
+  const double wall_ms = MillisecondsSince(wall_start);
+  if (frames < 0) {
+    std::fprintf(stderr, "Video detection failed: %s\n",
+                 hand_pipeline_last_error());
+  }
+  hand_pipeline_destroy(pipeline);
+  if (input != stdin) std::fclose(input);
+
+  if (!options.quiet && frames >= 0) {
+    const double seconds = wall_ms / 1000.0;
+    std::fprintf(stderr, "hand_detect: %lld frames, %lld hands\n",
+                 static_cast<long long>(frames),
+                 static_cast<long long>(stream.hands));
+    std::fprintf(stderr, "  wall    %.2f s, %.2f frames/s\n", seconds,
+                 seconds > 0 ? frames / seconds : 0.0);
+    PrintLatency("frame", stream.frame_ms);
+  }
+  return frames < 0 ? 1 : 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  CliOptions options;
+  if (!ParseArgs(argc, argv, &options)) {
+    PrintUsage();
+    return 2;
+  }
+
+  std::vector<std::string> paths;
+  for (const std::string& input : options.inputs) CollectImages(input, &paths);
+  if (!options.list_file.empty() && !ReadList(options.list_file, &paths)) {
+    std::fprintf(stderr, "Cannot read list: %s\n", options.list_file.c_str());
+    return 1;
+  }
+
+  FILE* output = stdout;
+  if (!options.output_path.empty()) {
+    output = std::fopen(options.output_path.c_str(), "wb");
+    if (output == nullptr) {
+      std::fprintf(stderr, "Cannot open output: %s\n",
+                   options.output_path.c_str());
+      return 1;
+    }
+  }
+  if (options.format == OutputFormat::kBinary) {
+    std::string header("HDET");
+    AppendRaw(kBinaryVersion, &header);
+    AppendRaw(static_cast<uint32_t>(sizeof(HandPipelineHand)), &header);
+    std::fwrite(header.data(), 1, header.size(), output);
+  }
+
+  const std::string palm_path = options.models_dir + "/hand_detection.tflite";
+  const std::string landmark_path =
+      options.models_dir + "/hand_landmark_full.tflite";
+  HandPipelineOptions pipeline_options;
+  hand_pipeline_options_init(&pipeline_options);
+  pipeline_options.palm_model_path = palm_path.c_str();
+  pipeline_options.landmark_model_path = landmark_path.c_str();
+  pipeline_options.num_threads = options.threads;
+  pipeline_options.num_workers = options.hand_workers;
+  pipeline_options.palm_tile_columns = options.tile_columns;
+  pipeline_options.palm_tile_rows = options.tile_rows;
+  pipeline_options.palm_tile_overlap = options.tile_overlap;
+  pipeline_options.mode = options.mode;
+  pipeline_options.detector_confidence = options.confidence;
+  pipeline_options.max_detections = options.max_hands;
+  pipeline_options.min_landmark_score = options.min_landmark_score;
+
+  if (!options.video_path.empty()) {
+    const int status = RunVideo(options, pipeline_options, output);
+    if (output != stdout) {
+      std::fclose(output);
+    } else {
+      std::fflush(stdout);
+    }
+    return status;
+  }
+
+  // Pipelines are created up front so model errors surface before any work.
+  const int32_t workers =
+      std::min<int32_t>(options.workers,
+                        std::max<int32_t>(1, static_cast<int32_t>(paths.size())));
+  std::vector<HandPipeline*> pipelines;
+  for (int32_t i = 0; i < workers; ++i) {
+    HandPipeline* pipeline = hand_pipeline_create(&pipeline_options);
+    if (pipeline == nullptr) {
+      std::fprintf(stderr, "Failed to create pipeline: %s\n",
+                   hand_pipeline_last_error());
+      for (HandPipeline* p : pipelines) hand_pipeline_destroy(p);
+      if (output != stdout) std::fclose(output);
+      return 1;
+    }
+    pipelines.push_back(pipeline);
+  }
+
+  std::atomic<size_t> next(0);
+  std::atomic<int64_t> failures(0);
+  std::atomic<int64_t> total_hands(0);
+  std::mutex output_mutex;
+  std::vector<std::vector<Timing>> timings(workers);
+
+  auto worker = [&](int32_t index) {
+    HandPipeline* pipeline = pipelines[index];
+    std::vector<HandPipelineHand> hands(options.max_hands);
+    BgrImage image;
+    std::string record;
+    std::string error;
+    while (true) {
+      const size_t i = next.fetch_add(1);
+      if (i >= paths.size()) break;
+      const std::string& path = paths[i];
+
+      Timing timing = {0.0, 0.0};
+      auto start = std::chrono::steady_clock::now();
+      int32_t count = -1;
+      if (DecodeImageFile(path, &image, &error)) {
+        timing.decode_ms = MillisecondsSince(start);
+        start = std::chrono::steady_clock::now();
+        count = hand_pipeline_detect(pipeline, image.pixels.data(),
+                                     image.width, image.height,
+                                     image.width * 3, hands.data(),
+                                     options.max_hands);
+        timing.detect_ms = MillisecondsSince(start);
+        if (count < 0) error = hand_pipeline_last_error();
+      }
+      if (count < 0) {
+        failures.fetch_add(1);
+      } else {
+        total_hands.fetch_add(count);
+        timings[index].push_back(timing);
+      }
+
+      record.clear();
+      if (options.format == OutputFormat::kJsonl) {
+        AppendJsonRecord(path, image, hands.data(), count, error, &record);
+      } else {
+        AppendBinaryRecord(path, image, hands.data(), count, &record);
+      }
+      std::lock_guard<std::mutex> lock(output_mutex);
+      std::fwrite(record.data(), 1, record.size(), output);
+    }
+  };
+
+  const auto wall_start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int32_t i = 1; i < workers; ++i) threads.emplace_back(worker, i);
+  worker(0);
+  for (std::thread& thread : threads) thread.join();
+  const double wall_ms = MillisecondsSince(wall_start);
+
+  for (HandPipeline* pipeline : pipelines) hand_pipeline_destroy(pipeline);
+  if (output != stdout) {
+    std::fclose(output);
+  } else {
+    std::fflush(stdout);
+  }
+
+  if (!options.quiet) {
+    std::vector<double> decode;
+    std::vector<double> detect;
+    std::vector<double> total;
+    for (const std::vector<Timing>& per_worker : timings) {
+      for (const Timing& t : per_worker) {
+        decode.push_back(t.decode_ms);
+        detect.push_back(t.detect_ms);
+        total.push_back(t.decode_ms + t.detect_ms);
+      }
+    }
+    const double seconds = wall_ms / 1000.0;
+    std::fprintf(stderr,
+                 "hand_detect: %zu images (%lld failed), %lld hands, "
+                 "%d workers\n",
+                 paths.size(), static_cast<long long>(failures.load()),
+                 static_cast<long long>(total_hands.load()), workers);
+    std::fprintf(stderr, "  wall    %.2f s, %.2f images/s\n", seconds,
+                 seconds > 0 ? paths.size() / seconds : 0.0);
+    PrintLatency("decode", decode);
+    PrintLatency("detect", detect);
+    PrintLatency("total", total);
+  }
+  return failures.load() == 0 ? 0 : 1;
+}
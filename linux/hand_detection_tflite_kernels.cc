@@ -0,0 +1,1119 @@
+#include "include/hand_detection_tflite/hand_detection_tflite_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+// Four-lane float vector. GCC/Clang lower this to SSE on x86 and NEON on ARM.
+typedef float Float4 __attribute__((vector_size(16)));
+typedef int32_t Int4 __attribute__((vector_size(16)));
+
+constexpr float kInv255 = 1.0f / 255.0f;
+constexpr double kPi = 3.14159265358979323846;
+
+// Palm NMS radius in source pixels (matches the Python reference).
+constexpr float kPalmNmsDistance = 200.0f;
+
+// Palm rotation rectangle is 2.9x the detected box (MediaPipe hand ROI).
+constexpr double kPalmRoiScale = 2.9;
+
+// One bilinear tap along an axis: two source offsets and their weights.
+struct AxisTap {
+  int32_t i0;
+  int32_t i1;
+  float w0;
+  float w1;
+};
+
+// Per-thread scratch so steady-state calls do not allocate.
+struct LetterboxScratch {
+  std::vector<AxisTap> x_taps;
+  std::vector<float> rows;
+  std::vector<float> blended;  // 8-bit output only
+};
+
+LetterboxScratch& GetLetterboxScratch() {
+  static thread_local LetterboxScratch scratch;
+  return scratch;
+}
+
+// Resized content size and padding of a keep-aspect letterbox, the geometry
+// of ImageUtils.keepAspectResizeAndPad.
+struct LetterboxGeometry {
+  int32_t new_w;
+  int32_t new_h;
+  int32_t pad_left;
+  int32_t pad_top;
+};
+
+LetterboxGeometry ComputeLetterbox(int32_t src_width, int32_t src_height,
+                                   int32_t dst_width, int32_t dst_height,
+                                   int32_t* info) {
+  const double ash = static_cast<double>(dst_height) / src_height;
+  const double asw = static_cast<double>(dst_width) / src_width;
+  const double ratio = asw < ash ? asw : ash;
+  LetterboxGeometry g;
+  g.new_w = std::max(1, static_cast<int32_t>(src_width * ratio));
+  g.new_h = std::max(1, static_cast<int32_t>(src_height * ratio));
+  g.pad_left = (dst_width - g.new_w) / 2;
+  g.pad_top = (dst_height - g.new_h) / 2;
+  if (info != nullptr) {
+    info[0] = g.new_w;
+    info[1] = g.new_h;
+    info[2] = g.pad_left;
+    info[3] = g.pad_top;
+  }
+  return g;
+}
+
+// Rounds [0, 255] samples to 8-bit pixels and maps them through lut, or
+// stores them unchanged when lut is null.
+inline void StorePixels(const float* in, int32_t count, const uint8_t* lut,
+                        uint8_t* out) {
+  if (lut == nullptr) {
+    for (int32_t i = 0; i < count; ++i) {
+      out[i] = static_cast<uint8_t>(std::min(in[i], 255.0f) + 0.5f);
+    }
+    return;
+  }
+  for (int32_t i = 0; i < count; ++i) {
+    out[i] = lut[static_cast<uint8_t>(std::min(in[i], 255.0f) + 0.5f)];
+  }
+}
+
+// Computes OpenCV INTER_LINEAR source positions for one output coordinate.
+inline void LinearTap(int32_t dst_index, double scale, int32_t src_len,
+                      int32_t* i0, int32_t* i1, float* frac) {
+  double f = (dst_index + 0.5) * scale - 0.5;
+  int32_t s = static_cast<int32_t>(std::floor(f));
+  f -= s;
+  if (s < 0) {
+    s = 0;
+    f = 0.0;
+  }
+  if (s >= src_len - 1) {
+    s = src_len - 1;
+    f = 0.0;
+  }
+  *i0 = s;
+  *i1 = std::min(s + 1, src_len - 1);
+  *frac = static_cast<float>(f);
+}
+
+// Horizontally resamples one BGR source row into normalized RGB floats.
+inline void ResampleRow(const uint8_t* row, const AxisTap* taps, int32_t count,
+                        float* out) {
+  for (int32_t x = 0; x < count; ++x) {
+    const uint8_t* p0 = row + taps[x].i0;
+    const uint8_t* p1 = row + taps[x].i1;
+    const float w0 = taps[x].w0;
+    const float w1 = taps[x].w1;
+    out[0] = p0[2] * w0 + p1[2] * w1;
+    out[1] = p0[1] * w0 + p1[1] * w1;
+    out[2] = p0[0] * w0 + p1[0] * w1;
+    out += 3;
+  }
+}
+
+// out = r0 + (r1 - r0) * wy, four lanes at a time.
+inline void BlendRows(const float* r0, const float* r1, float wy, float* out,
+                      int32_t count) {
+  if (wy == 0.0f) {
+    std::memcpy(out, r0, sizeof(float) * count);
+    return;
+  }
+  const Float4 w = {wy, wy, wy, wy};
+  int32_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    Float4 a;
+    Float4 b;
+    std::memcpy(&a, r0 + i, sizeof(a));
+    std::memcpy(&b, r1 + i, sizeof(b));
+    const Float4 v = a + (b - a) * w;
+    std::memcpy(out + i, &v, sizeof(v));
+  }
+  for (; i < count; ++i) {
+    out[i] = r0[i] + (r1[i] - r0[i]) * wy;
+  }
+}
+
+// Per-thread scratch for palm decoding.
+struct DecodeScratch {
+  std::vector<int32_t> candidates;
+  std::vector<HandPalmDetection> palms;
+  std::vector<float> kept_x;
+  std::vector<float> kept_y;
+};
+
+DecodeScratch& GetDecodeScratch() {
+  static thread_local DecodeScratch scratch;
+  return scratch;
+}
+
+// sigmoid(x) > t  <=>  x > log(t / (1 - t)).
+inline float LogitThreshold(float threshold) {
+  if (threshold <= 0.0f) return -INFINITY;
+  if (threshold >= 1.0f) return INFINITY;
+  return static_cast<float>(std::log(threshold / (1.0 - threshold)));
+}
+
+// Normalizes an angle to [-pi, pi).
+inline double NormalizeRadians(double angle) {
+  return angle - 2 * kPi * std::floor((angle + kPi) / (2 * kPi));
+}
+
+// Collects indices of anchors whose logit exceeds the threshold.
+void FilterScores(const float* raw_scores, int32_t count, float logit,
+                  std::vector<int32_t>* out) {
+  out->clear();
+  const Float4 t = {logit, logit, logit, logit};
+  int32_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    Float4 v;
+    std::memcpy(&v, raw_scores + i, sizeof(v));
+    const Int4 m = v > t;
+    if ((m[0] | m[1] | m[2] | m[3]) == 0) continue;
+    for (int32_t lane = 0; lane < 4; ++lane) {
+      if (m[lane]) out->push_back(i + lane);
+    }
+  }
+  for (; i < count; ++i) {
+    if (raw_scores[i] > logit) out->push_back(i);
+  }
+}
+
+// True when (x, y) lies within the NMS radius of any kept center.
+bool NearKept(const float* kx, const float* ky, size_t count, float x,
+              float y) {
+  const float r2 = kPalmNmsDistance * kPalmNmsDistance;
+  const Float4 vx = {x, x, x, x};
+  const Float4 vy = {y, y, y, y};
+  const Float4 vr2 = {r2, r2, r2, r2};
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    Float4 ax;
+    Float4 ay;
+    std::memcpy(&ax, kx + i, sizeof(ax));
+    std::memcpy(&ay, ky + i, sizeof(ay));
+    const Float4 dx = ax - vx;
+    const Float4 dy = ay - vy;
+    const Int4 m = (dx * dx + dy * dy) < vr2;
+    if (m[0] | m[1] | m[2] | m[3]) return true;
+  }
+  for (; i < count; ++i) {
+    const float dx = kx[i] - x;
+    const float dy = ky[i] - y;
+    if (dx * dx + dy * dy < r2) return true;
+  }
+  return false;
+}
+
+// Sorts count palms by descending score, then greedy NMS: a palm survives
+// when it is not near any already kept palm. Writes at most max_out
+// survivors to out, which may alias palms, and returns their number.
+int32_t SuppressPalms(HandPalmDetection* palms, size_t count,
+                      int32_t image_width, int32_t image_height,
+                      HandPalmDetection* out, int32_t max_out,
+                      DecodeScratch* scratch) {
+  std::stable_sort(palms, palms + count,
+                   [](const HandPalmDetection& a, const HandPalmDetection& b) {
+                     return a.score > b.score;
+                   });
+
+  scratch->kept_x.clear();
+  scratch->kept_y.clear();
+  int32_t written = 0;
+  for (size_t i = 0; i < count && written < max_out; ++i) {
+    const HandPalmDetection palm = palms[i];
+    const float px = palm.sqn_rr_center_x * image_width;
+    const float py = palm.sqn_rr_center_y * image_height;
+    if (NearKept(scratch->kept_x.data(), scratch->kept_y.data(),
+                 scratch->kept_x.size(), px, py)) {
+      continue;
+    }
+    scratch->kept_x.push_back(px);
+    scratch->kept_y.push_back(py);
+    out[written++] = palm;
+  }
+  return written;
+}
+
+// Splits an axis of length extent into count tiles sharing overlap of their
+// size, none shorter than min_size. Returns the tile count actually used
+// (lower than count when the tiles would be too short) and the tile length.
+int32_t TileAxis(int32_t extent, int32_t count, float overlap,
+                 int32_t min_size, int32_t* length) {
+  const int32_t floor_size = std::min(extent, min_size);
+  while (count > 1) {
+    const double size =
+        extent / (count - (count - 1) * static_cast<double>(overlap));
+    if (size >= floor_size) {
+      *length = std::min(extent, static_cast<int32_t>(std::lround(size)));
+      return count;
+    }
+    --count;
+  }
+  *length = extent;
+  return 1;
+}
+
+// Bilinear sample of a BGR888 pixel at (fx, fy) with a black constant border,
+// written as RGB multiplied by norm (normalized to [0, 1] by default).
+inline void SampleBilinear(const uint8_t* src, int32_t width, int32_t height,
+                           int32_t stride, float fx, float fy, float* out,
+                           float norm = kInv255) {
+  const float x_floor = std::floor(fx);
+  const float y_floor = std::floor(fy);
+  const int32_t x0 = static_cast<int32_t>(x_floor);
+  const int32_t y0 = static_cast<int32_t>(y_floor);
+  const float ax = fx - x_floor;
+  const float ay = fy - y_floor;
+  const float w00 = (1.0f - ax) * (1.0f - ay) * norm;
+  const float w01 = ax * (1.0f - ay) * norm;
+  const float w10 = (1.0f - ax) * ay * norm;
+  const float w11 = ax * ay * norm;
+
+  if (x0 >= 0 && y0 >= 0 && x0 + 1 < width && y0 + 1 < height) {
+    const uint8_t* p0 = src + static_cast<size_t>(y0) * stride + x0 * 3;
+    const uint8_t* p1 = p0 + stride;
+    for (int32_t c = 0; c < 3; ++c) {
+      out[2 - c] =
+          p0[c] * w00 + p0[c + 3] * w01 + p1[c] * w10 + p1[c + 3] * w11;
+    }
+    return;
+  }
+
+  out[0] = out[1] = out[2] = 0.0f;
+  if (x0 < -1 || y0 < -1 || x0 >= width || y0 >= height) return;
+  const int32_t xs[2] = {x0, x0 + 1};
+  const int32_t ys[2] = {y0, y0 + 1};
+  const float ws[2][2] = {{w00, w01}, {w10, w11}};
+  for (int32_t j = 0; j < 2; ++j) {
+    if (ys[j] < 0 || ys[j] >= height) continue;
+    const uint8_t* row = src + static_cast<size_t>(ys[j]) * stride;
+    for (int32_t i = 0; i < 2; ++i) {
+      if (xs[i] < 0 || xs[i] >= width) continue;
+      const uint8_t* p = row + xs[i] * 3;
+      out[0] += p[2] * ws[j][i];
+      out[1] += p[1] * ws[j][i];
+      out[2] += p[0] * ws[j][i];
+    }
+  }
+}
+
+// Validates a YUV 4:2:0 frame of width x height.
+bool ValidYuv420(const HandYuv420Image* src, int32_t width, int32_t height) {
+  if (src == nullptr || src->y == nullptr || src->u == nullptr ||
+      src->v == nullptr || width <= 0 || height <= 0) {
+    return false;
+  }
+  const int32_t chroma_width = (width + 1) / 2;
+  return src->y_stride >= width && src->uv_pixel_stride >= 1 &&
+         src->uv_stride >= (chroma_width - 1) * src->uv_pixel_stride + 1;
+}
+
+inline float Clamp01(float v) { return std::min(std::max(v, 0.0f), 1.0f); }
+
+// BT.601 limited-range YUV to normalized RGB, the conversion used by OpenCV's
+// COLOR_YUV2BGR_{I420,NV12,NV21}. Inputs may be interpolated samples.
+inline void YuvToRgb(float y, float u, float v, float* out) {
+  const float c = (y - 16.0f) * 1.164f;
+  const float d = u - 128.0f;
+  const float e = v - 128.0f;
+  out[0] = Clamp01((c + 1.596f * e) * kInv255);
+  out[1] = Clamp01((c - 0.813f * e - 0.391f * d) * kInv255);
+  out[2] = Clamp01((c + 2.018f * d) * kInv255);
+}
+
+// Per-thread scratch for the YUV letterbox.
+struct YuvLetterboxScratch {
+  std::vector<AxisTap> luma_taps;
+  std::vector<AxisTap> chroma_taps;
+};
+
+YuvLetterboxScratch& GetYuvLetterboxScratch() {
+  static thread_local YuvLetterboxScratch scratch;
+  return scratch;
+}
+
+// Builds an INTER_LINEAR tap; offsets are in bytes (index * pixel_stride).
+inline AxisTap MakeTap(int32_t dst_index, double scale, int32_t src_len,
+                       int32_t pixel_stride) {
+  int32_t s0;
+  int32_t s1;
+  float f;
+  LinearTap(dst_index, scale, src_len, &s0, &s1, &f);
+  AxisTap tap;
+  tap.i0 = s0 * pixel_stride;
+  tap.i1 = s1 * pixel_stride;
+  tap.w0 = 1.0f - f;
+  tap.w1 = f;
+  return tap;
+}
+
+inline float Lerp2D(const uint8_t* r0, const uint8_t* r1, const AxisTap& tx,
+                    float fy) {
+  const float top = r0[tx.i0] * tx.w0 + r0[tx.i1] * tx.w1;
+  const float bottom = r1[tx.i0] * tx.w0 + r1[tx.i1] * tx.w1;
+  return top + (bottom - top) * fy;
+}
+
+// Bilinear sample of one chroma plane at chroma coordinates (fx, fy),
+// replicating the edge.
+inline float SampleChroma(const uint8_t* plane, int32_t stride,
+                          int32_t pixel_stride, int32_t width, int32_t height,
+                          float fx, float fy) {
+  fx = std::min(std::max(fx, 0.0f), static_cast<float>(width - 1));
+  fy = std::min(std::max(fy, 0.0f), static_cast<float>(height - 1));
+  const int32_t x0 = static_cast<int32_t>(fx);
+  const int32_t y0 = static_cast<int32_t>(fy);
+  const int32_t x1 = std::min(x0 + 1, width - 1);
+  const int32_t y1 = std::min(y0 + 1, height - 1);
+  const float ax = fx - x0;
+  const float ay = fy - y0;
+  const uint8_t* r0 = plane + static_cast<size_t>(y0) * stride;
+  const uint8_t* r1 = plane + static_cast<size_t>(y1) * stride;
+  const float top =
+      r0[x0 * pixel_stride] + (r0[x1 * pixel_stride] - r0[x0 * pixel_stride]) *
+                                  ax;
+  const float bottom =
+      r1[x0 * pixel_stride] + (r1[x1 * pixel_stride] - r1[x0 * pixel_stride]) *
+                                  ax;
+  return top + (bottom - top) * ay;
+}
+
+// Bilinear sample of a YUV 4:2:0 frame at luma coordinates (fx, fy) with a
+// black constant border, written as normalized RGB. Taps outside the frame
+// blend towards black exactly like SampleBilinear: the conversion is affine,
+// so RGB of the in-frame luma average scaled by its coverage equals the
+// weighted sum of in-frame RGB taps (up to clamping).
+inline void SampleYuvBilinear(const HandYuv420Image& src, int32_t width,
+                              int32_t height, float fx, float fy, float* out) {
+  const float x_floor = std::floor(fx);
+  const float y_floor = std::floor(fy);
+  const int32_t x0 = static_cast<int32_t>(x_floor);
+  const int32_t y0 = static_cast<int32_t>(y_floor);
+  const float ax = fx - x_floor;
+  const float ay = fy - y_floor;
+
+  float luma;
+  float coverage = 1.0f;
+  if (x0 >= 0 && y0 >= 0 && x0 + 1 < width && y0 + 1 < height) {
+    const uint8_t* p0 = src.y + static_cast<size_t>(y0) * src.y_stride + x0;
+    const uint8_t* p1 = p0 + src.y_stride;
+    const float top = p0[0] + (p0[1] - p0[0]) * ax;
+    const float bottom = p1[0] + (p1[1] - p1[0]) * ax;
+    luma = top + (bottom - top) * ay;
+  } else {
+    if (x0 < -1 || y0 < -1 || x0 >= width || y0 >= height) {
+      out[0] = out[1] = out[2] = 0.0f;
+      return;
+    }
+    const int32_t xs[2] = {x0, x0 + 1};
+    const int32_t ys[2] = {y0, y0 + 1};
+    const float wx[2] = {1.0f - ax, ax};
+    const float wy[2] = {1.0f - ay, ay};
+    float sum = 0.0f;
+    coverage = 0.0f;
+    for (int32_t j = 0; j < 2; ++j) {
+      if (ys[j] < 0 || ys[j] >= height) continue;
+      const uint8_t* row = src.y + static_cast<size_t>(ys[j]) * src.y_stride;
+      for (int32_t i = 0; i < 2; ++i) {
+        if (xs[i] < 0 || xs[i] >= width) continue;
+        const float w = wx[i] * wy[j];
+        sum += row[xs[i]] * w;
+        coverage += w;
+      }
+    }
+    if (coverage <= 0.0f) {
+      out[0] = out[1] = out[2] = 0.0f;
+      return;
+    }
+    luma = sum / coverage;
+  }
+
+  // Chroma sample i sits between luma pixels 2i and 2i + 1.
+  const int32_t chroma_width = (width + 1) / 2;
+  const int32_t chroma_height = (height + 1) / 2;
+  const float cx = (fx - 0.5f) * 0.5f;
+  const float cy = (fy - 0.5f) * 0.5f;
+  const float u = SampleChroma(src.u, src.uv_stride, src.uv_pixel_stride,
+                               chroma_width, chroma_height, cx, cy);
+  const float v = SampleChroma(src.v, src.uv_stride, src.uv_pixel_stride,
+                               chroma_width, chroma_height, cx, cy);
+  YuvToRgb(luma, u, v, out);
+  out[0] *= coverage;
+  out[1] *= coverage;
+  out[2] *= coverage;
+}
+
+}  // namespace
+
+extern "C" {
+
+int32_t hand_detection_tflite_letterbox_bgr_to_rgb_f32(const uint8_t* src,
+                                                       int32_t src_width,
+                                                       int32_t src_height,
+                                                       int32_t src_stride,
+                                                       float* dst,
+                                                       int32_t dst_width,
+                                                       int32_t dst_height,
+                                                       int32_t* info) {
+  if (src == nullptr || dst == nullptr || src_width <= 0 || src_height <= 0 ||
+      dst_width <= 0 || dst_height <= 0 || src_stride < src_width * 3) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+
+  const LetterboxGeometry g =
+      ComputeLetterbox(src_width, src_height, dst_width, dst_height, info);
+  const int32_t new_w = g.new_w;
+  const int32_t new_h = g.new_h;
+  const int32_t pad_left = g.pad_left;
+  const int32_t pad_top = g.pad_top;
+
+  LetterboxScratch& scratch = GetLetterboxScratch();
+  scratch.x_taps.resize(new_w);
+  const int32_t row_len = new_w * 3;
+  scratch.rows.resize(static_cast<size_t>(row_len) * 2);
+
+  const double scale_x = static_cast<double>(src_width) / new_w;
+  const double scale_y = static_cast<double>(src_height) / new_h;
+
+  for (int32_t x = 0; x < new_w; ++x) {
+    int32_t s0;
+    int32_t s1;
+    float fx;
+    LinearTap(x, scale_x, src_width, &s0, &s1, &fx);
+    AxisTap& tap = scratch.x_taps[x];
+    tap.i0 = s0 * 3;
+    tap.i1 = s1 * 3;
+    tap.w0 = (1.0f - fx) * kInv255;
+    tap.w1 = fx * kInv255;
+  }
+
+  const size_t dst_row_floats = static_cast<size_t>(dst_width) * 3;
+
+  // Black padding above and below the resized content.
+  std::memset(dst, 0, sizeof(float) * dst_row_floats * pad_top);
+  const int32_t pad_bottom_start = pad_top + new_h;
+  std::memset(dst + dst_row_floats * pad_bottom_start, 0,
+              sizeof(float) * dst_row_floats * (dst_height - pad_bottom_start));
+
+  float* row_a = scratch.rows.data();
+  float* row_b = row_a + row_len;
+  int32_t row_a_src = -1;
+  int32_t row_b_src = -1;
+  const int32_t pad_right = dst_width - new_w - pad_left;
+
+  for (int32_t y = 0; y < new_h; ++y) {
+    int32_t sy0;
+    int32_t sy1;
+    float fy;
+    LinearTap(y, scale_y, src_height, &sy0, &sy1, &fy);
+
+    // Reuse horizontally resampled rows across consecutive output rows.
+    if (row_a_src != sy0) {
+      if (row_b_src == sy0) {
+        std::swap(row_a, row_b);
+        std::swap(row_a_src, row_b_src);
+      } else {
+        ResampleRow(src + static_cast<size_t>(sy0) * src_stride,
+                    scratch.x_taps.data(), new_w, row_a);
+        row_a_src = sy0;
+      }
+    }
+    if (fy != 0.0f && row_b_src != sy1) {
+      ResampleRow(src + static_cast<size_t>(sy1) * src_stride,
+                  scratch.x_taps.data(), new_w, row_b);
+      row_b_src = sy1;
+    }
+
+    float* out = dst + dst_row_floats * (pad_top + y);
+    std::memset(out, 0, sizeof(float) * 3 * pad_left);
+    BlendRows(row_a, row_b, fy, out + 3 * pad_left, row_len);
+    std::memset(out + 3 * (pad_left + new_w), 0, sizeof(float) * 3 * pad_right);
+  }
+
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+int32_t hand_detection_tflite_letterbox_yuv420_to_rgb_f32(
+    const HandYuv420Image* src, int32_t src_width, int32_t src_height,
+    float* dst, int32_t dst_width, int32_t dst_height, int32_t* info) {
+  if (!ValidYuv420(src, src_width, src_height) || dst == nullptr ||
+      dst_width <= 0 || dst_height <= 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+
+  const LetterboxGeometry g =
+      ComputeLetterbox(src_width, src_height, dst_width, dst_height, info);
+  const int32_t new_w = g.new_w;
+  const int32_t new_h = g.new_h;
+  const int32_t pad_left = g.pad_left;
+  const int32_t pad_top = g.pad_top;
+
+  const int32_t chroma_width = (src_width + 1) / 2;
+  const int32_t chroma_height = (src_height + 1) / 2;
+  const double scale_x = static_cast<double>(src_width) / new_w;
+  const double scale_y = static_cast<double>(src_height) / new_h;
+
+  // Halving the scale maps an output index onto the chroma grid, whose
+  // sample i sits between luma pixels 2i and 2i + 1.
+  YuvLetterboxScratch& scratch = GetYuvLetterboxScratch();
+  scratch.luma_taps.resize(new_w);
+  scratch.chroma_taps.resize(new_w);
+  for (int32_t x = 0; x < new_w; ++x) {
+    scratch.luma_taps[x] = MakeTap(x, scale_x, src_width, 1);
+    scratch.chroma_taps[x] =
+        MakeTap(x, scale_x * 0.5, chroma_width, src->uv_pixel_stride);
+  }
+
+  const size_t dst_row_floats = static_cast<size_t>(dst_width) * 3;
+  std::memset(dst, 0, sizeof(float) * dst_row_floats * pad_top);
+  const int32_t pad_bottom_start = pad_top + new_h;
+  std::memset(dst + dst_row_floats * pad_bottom_start, 0,
+              sizeof(float) * dst_row_floats * (dst_height - pad_bottom_start));
+  const int32_t pad_right = dst_width - new_w - pad_left;
+
+  for (int32_t y = 0; y < new_h; ++y) {
+    const AxisTap ty = MakeTap(y, scale_y, src_height, src->y_stride);
+    const AxisTap tc = MakeTap(y, scale_y * 0.5, chroma_height, src->uv_stride);
+    const uint8_t* y0 = src->y + ty.i0;
+    const uint8_t* y1 = src->y + ty.i1;
+    const uint8_t* u0 = src->u + tc.i0;
+    const uint8_t* u1 = src->u + tc.i1;
+    const uint8_t* v0 = src->v + tc.i0;
+    const uint8_t* v1 = src->v + tc.i1;
+
+    float* out = dst + dst_row_floats * (pad_top + y);
+    std::memset(out, 0, sizeof(float) * 3 * pad_left);
+    float* px = out + 3 * pad_left;
+    for (int32_t x = 0; x < new_w; ++x) {
+      const AxisTap& lx = scratch.luma_taps[x];
+      const AxisTap& cx = scratch.chroma_taps[x];
+      YuvToRgb(Lerp2D(y0, y1, lx, ty.w1), Lerp2D(u0, u1, cx, tc.w1),
+               Lerp2D(v0, v1, cx, tc.w1), px);
+      px += 3;
+    }
+    std::memset(out + 3 * (pad_left + new_w), 0, sizeof(float) * 3 * pad_right);
+  }
+
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+int32_t hand_detection_tflite_decode_palms(const float* raw_boxes,
+                                           const float* raw_scores,
+                                           int32_t num_anchors,
+                                           const float* anchors,
+                                           float score_threshold,
+                                           float input_size,
+                                           int32_t image_width,
+                                           int32_t image_height,
+                                           HandPalmDetection* out,
+                                           int32_t max_out) {
+  if (raw_boxes == nullptr || raw_scores == nullptr || anchors == nullptr ||
+      out == nullptr || num_anchors < 0 || max_out < 0 || input_size <= 0.0f ||
+      image_width <= 0 || image_height <= 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+
+  DecodeScratch& scratch = GetDecodeScratch();
+  FilterScores(raw_scores, num_anchors, LogitThreshold(score_threshold),
+               &scratch.candidates);
+
+  // Padding applied by the square letterbox, in source pixels.
+  const double square_size = std::max(image_width, image_height);
+  const double pad_half = std::abs(image_height - image_width) / 2;
+  const bool portrait = image_height > image_width;
+
+  scratch.palms.clear();
+  for (const int32_t i : scratch.candidates) {
+    const double score = 1.0 / (1.0 + std::exp(-raw_scores[i]));
+    if (score <= score_threshold) continue;
+
+    const float* box = raw_boxes + static_cast<size_t>(i) *
+                                       HAND_DETECTION_TFLITE_PALM_BOX_STRIDE;
+    const size_t n = static_cast<size_t>(num_anchors);
+    const double anchor_x = anchors[i];
+    const double anchor_y = anchors[n + i];
+    const double sx = anchors[2 * n + i] / input_size;
+    const double sy = anchors[3 * n + i] / input_size;
+
+    const double cx = box[0] * sx + anchor_x;
+    const double cy = box[1] * sy + anchor_y;
+    const double box_size = std::max(box[2] * sx, box[3] * sy);
+    if (box_size <= 0) continue;
+
+    // Keypoint 0 (wrist) and keypoint 2 (middle finger MCP) give rotation.
+    const double kp0_x = box[4] * sx + anchor_x;
+    const double kp0_y = box[5] * sy + anchor_y;
+    const double kp2_x = box[8] * sx + anchor_x;
+    const double kp2_y = box[9] * sy + anchor_y;
+    const double rotation = NormalizeRadians(
+        0.5 * kPi - std::atan2(-(kp2_y - kp0_y), kp2_x - kp0_x));
+
+    double center_x = cx + 0.5 * box_size * std::sin(rotation);
+    double center_y = cy - 0.5 * box_size * std::cos(rotation);
+    if (portrait) {
+      center_x = (center_x * square_size - pad_half) / image_width;
+    } else {
+      center_y = (center_y * square_size - pad_half) / image_height;
+    }
+
+    HandPalmDetection palm;
+    palm.score = static_cast<float>(score);
+    palm.sqn_rr_size = static_cast<float>(kPalmRoiScale * box_size);
+    palm.rotation = static_cast<float>(rotation);
+    palm.sqn_rr_center_x = static_cast<float>(center_x);
+    palm.sqn_rr_center_y = static_cast<float>(center_y);
+    scratch.palms.push_back(palm);
+  }
+
+  return SuppressPalms(scratch.palms.data(), scratch.palms.size(),
+                       image_width, image_height, out, max_out, &scratch);
+}
+
+int32_t hand_detection_tflite_warp_crop_bgr_to_rgb_f32(const uint8_t* src,
+                                                       int32_t src_width,
+                                                       int32_t src_height,
+                                                       int32_t src_stride,
+                                                       float center_x,
+                                                       float center_y,
+                                                       float rotation,
+                                                       int32_t crop_size,
+                                                       float* dst,
+                                                       int32_t dst_size) {
+  if (src == nullptr || dst == nullptr || src_width <= 0 || src_height <= 0 ||
+      src_stride < src_width * 3 || crop_size <= 0 || dst_size <= 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+
+  // Output pixel d samples crop pixel u = (d + 0.5) * k - 0.5 (INTER_LINEAR
+  // resize of the crop), and crop pixel u maps to the source through the
+  // inverse of the getRotationMatrix2D transform used by the Dart path.
+  const double k = static_cast<double>(crop_size) / dst_size;
+  const double half = crop_size / 2.0;
+  const double cos_r = std::cos(rotation);
+  const double sin_r = std::sin(rotation);
+  const float step_x = static_cast<float>(k * cos_r);
+  const float step_y = static_cast<float>(k * sin_r);
+
+  for (int32_t y = 0; y < dst_size; ++y) {
+    const double v = (y + 0.5) * k - 0.5 - half;
+    const double u0 = 0.5 * k - 0.5 - half;
+    float sx = static_cast<float>(cos_r * u0 - sin_r * v + center_x);
+    float sy = static_cast<float>(sin_r * u0 + cos_r * v + center_y);
+    float* out = dst + static_cast<size_t>(y) * dst_size * 3;
+    for (int32_t x = 0; x < dst_size; ++x) {
+      SampleBilinear(src, src_width, src_height, src_stride, sx, sy, out);
+      sx += step_x;
+      sy += step_y;
+      out += 3;
+    }
+  }
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+int32_t hand_detection_tflite_warp_crop_yuv420_to_rgb_f32(
+    const HandYuv420Image* src, int32_t src_width, int32_t src_height,
+    float center_x, float center_y, float rotation, int32_t crop_size,
+    float* dst, int32_t dst_size) {
+  if (!ValidYuv420(src, src_width, src_height) || dst == nullptr ||
+      crop_size <= 0 || dst_size <= 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+
+  // Same source mapping as the BGR variant.
+  const double k = static_cast<double>(crop_size) / dst_size;
+  const double half = crop_size / 2.0;
+  const double cos_r = std::cos(rotation);
+  const double sin_r = std::sin(rotation);
+  const float step_x = static_cast<float>(k * cos_r);
+  const float step_y = static_cast<float>(k * sin_r);
+
+  for (int32_t y = 0; y < dst_size; ++y) {
+    const double v = (y + 0.5) * k - 0.5 - half;
+    const double u0 = 0.5 * k - 0.5 - half;
+    float sx = static_cast<float>(cos_r * u0 - sin_r * v + center_x);
+    float sy = static_cast<float>(sin_r * u0 + cos_r * v + center_y);
+    float* out = dst + static_cast<size_t>(y) * dst_size * 3;
+    for (int32_t x = 0; x < dst_size; ++x) {
+      SampleYuvBilinear(*src, src_width, src_height, sx, sy, out);
+      sx += step_x;
+      sy += step_y;
+      out += 3;
+    }
+  }
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+int32_t hand_detection_tflite_project_landmarks(const float* raw,
+                                                int32_t count,
+                                                float input_size,
+                                                int32_t crop_size,
+                                                float center_x,
+                                                float center_y,
+                                                float rotation,
+                                                int32_t image_width,
+                                                int32_t image_height,
+                                                float* out) {
+  if (raw == nullptr || out == nullptr || count < 0 || input_size <= 0.0f ||
+      crop_size <= 0 || image_width <= 0 || image_height <= 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+
+  const float scale = crop_size / input_size;
+  const float crop = static_cast<float>(crop_size);
+  const float half = crop * 0.5f;
+  const float cos_r = std::cos(rotation);
+  const float sin_r = std::sin(rotation);
+  for (int32_t i = 0; i < count; ++i) {
+    const float* p = raw + i * 3;
+    const float x_rel = std::min(std::max(p[0] * scale, 0.0f), crop) - half;
+    const float y_rel = std::min(std::max(p[1] * scale, 0.0f), crop) - half;
+    const float z = p[2];
+    const float x = x_rel * cos_r - y_rel * sin_r + center_x;
+    const float y = x_rel * sin_r + y_rel * cos_r + center_y;
+    float* o = out + i * 3;
+    o[0] = std::min(std::max(x, 0.0f), static_cast<float>(image_width));
+    o[1] = std::min(std::max(y, 0.0f), static_cast<float>(image_height));
+    o[2] = z;
+  }
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+int32_t hand_detection_tflite_letterbox_bgr_to_rgb_u8(const uint8_t* src,
+                                                      int32_t src_width,
+                                                      int32_t src_height,
+                                                      int32_t src_stride,
+                                                      uint8_t* dst,
+                                                      int32_t dst_width,
+                                                      int32_t dst_height,
+                                                      const uint8_t* lut,
+                                                      int32_t* info) {
+  if (src == nullptr || dst == nullptr || src_width <= 0 || src_height <= 0 ||
+      dst_width <= 0 || dst_height <= 0 || src_stride < src_width * 3) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+
+  const LetterboxGeometry g =
+      ComputeLetterbox(src_width, src_height, dst_width, dst_height, info);
+
+  // Same separable INTER_LINEAR pass as the float kernel, in pixel units.
+  LetterboxScratch& scratch = GetLetterboxScratch();
+  scratch.x_taps.resize(g.new_w);
+  const int32_t row_len = g.new_w * 3;
+  scratch.rows.resize(static_cast<size_t>(row_len) * 2);
+  scratch.blended.resize(row_len);
+
+  const double scale_x = static_cast<double>(src_width) / g.new_w;
+  const double scale_y = static_cast<double>(src_height) / g.new_h;
+  for (int32_t x = 0; x < g.new_w; ++x) {
+    scratch.x_taps[x] = MakeTap(x, scale_x, src_width, 3);
+  }
+
+  const uint8_t black = lut != nullptr ? lut[0] : 0;
+  const size_t dst_row_bytes = static_cast<size_t>(dst_width) * 3;
+  std::memset(dst, black, dst_row_bytes * g.pad_top);
+  const int32_t pad_bottom_start = g.pad_top + g.new_h;
+  std::memset(dst + dst_row_bytes * pad_bottom_start, black,
+              dst_row_bytes * (dst_height - pad_bottom_start));
+
+  float* row_a = scratch.rows.data();
+  float* row_b = row_a + row_len;
+  int32_t row_a_src = -1;
+  int32_t row_b_src = -1;
+  const int32_t pad_right = dst_width - g.new_w - g.pad_left;
+
+  for (int32_t y = 0; y < g.new_h; ++y) {
+    int32_t sy0;
+    int32_t sy1;
+    float fy;
+    LinearTap(y, scale_y, src_height, &sy0, &sy1, &fy);
+
+    if (row_a_src != sy0) {
+      if (row_b_src == sy0) {
+        std::swap(row_a, row_b);
+        std::swap(row_a_src, row_b_src);
+      } else {
+        ResampleRow(src + static_cast<size_t>(sy0) * src_stride,
+                    scratch.x_taps.data(), g.new_w, row_a);
+        row_a_src = sy0;
+      }
+    }
+    if (fy != 0.0f && row_b_src != sy1) {
+      ResampleRow(src + static_cast<size_t>(sy1) * src_stride,
+                  scratch.x_taps.data(), g.new_w, row_b);
+      row_b_src = sy1;
+    }
+
+    uint8_t* out = dst + dst_row_bytes * (g.pad_top + y);
+    std::memset(out, black, 3 * g.pad_left);
+    BlendRows(row_a, row_b, fy, scratch.blended.data(), row_len);
+    StorePixels(scratch.blended.data(), row_len, lut, out + 3 * g.pad_left);
+    std::memset(out + 3 * (g.pad_left + g.new_w), black, 3 * pad_right);
+  }
+
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+int32_t hand_detection_tflite_warp_crop_bgr_to_rgb_u8(const uint8_t* src,
+                                                      int32_t src_width,
+                                                      int32_t src_height,
+                                                      int32_t src_stride,
+                                                      float center_x,
+                                                      float center_y,
+                                                      float rotation,
+                                                      int32_t crop_size,
+                                                      uint8_t* dst,
+                                                      int32_t dst_size,
+                                                      const uint8_t* lut) {
+  if (src == nullptr || dst == nullptr || src_width <= 0 || src_height <= 0 ||
+      src_stride < src_width * 3 || crop_size <= 0 || dst_size <= 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+
+  // Same source mapping as the float variant.
+  const double k = static_cast<double>(crop_size) / dst_size;
+  const double half = crop_size / 2.0;
+  const double cos_r = std::cos(rotation);
+  const double sin_r = std::sin(rotation);
+  const float step_x = static_cast<float>(k * cos_r);
+  const float step_y = static_cast<float>(k * sin_r);
+
+  for (int32_t y = 0; y < dst_size; ++y) {
+    const double v = (y + 0.5) * k - 0.5 - half;
+    const double u0 = 0.5 * k - 0.5 - half;
+    float sx = static_cast<float>(cos_r * u0 - sin_r * v + center_x);
+    float sy = static_cast<float>(sin_r * u0 + cos_r * v + center_y);
+    uint8_t* out = dst + static_cast<size_t>(y) * dst_size * 3;
+    for (int32_t x = 0; x < dst_size; ++x) {
+      float rgb[3];
+      SampleBilinear(src, src_width, src_height, src_stride, sx, sy, rgb,
+                     1.0f);
+      StorePixels(rgb, 3, lut, out);
+      sx += step_x;
+      sy += step_y;
+      out += 3;
+    }
+  }
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+int32_t hand_detection_tflite_input_quantization_lut(float scale,
+                                                     int32_t zero_point,
+                                                     int32_t tensor_type,
+                                                     uint8_t* lut) {
+  if (lut == nullptr || !(scale > 0.0f) ||
+      (tensor_type != HAND_DETECTION_TFLITE_TENSOR_UINT8 &&
+       tensor_type != HAND_DETECTION_TFLITE_TENSOR_INT8)) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+  const bool is_signed = tensor_type == HAND_DETECTION_TFLITE_TENSOR_INT8;
+  const int32_t lo = is_signed ? -128 : 0;
+  const int32_t hi = is_signed ? 127 : 255;
+  bool identity = true;
+  for (int32_t p = 0; p < 256; ++p) {
+    const int32_t q = static_cast<int32_t>(
+                          std::lround(p * kInv255 / scale)) +
+                      zero_point;
+    const int32_t clamped = std::min(std::max(q, lo), hi);
+    lut[p] = static_cast<uint8_t>(clamped);
+    identity = identity && lut[p] == p;
+  }
+  return identity ? 1 : 0;
+}
+
+int32_t hand_detection_tflite_quantize_unit_f32(const float* src,
+                                                int32_t count,
+                                                const uint8_t* lut,
+                                                uint8_t* dst) {
+  if (src == nullptr || dst == nullptr || count < 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+  for (int32_t i = 0; i < count; ++i) {
+    const float v = std::min(std::max(src[i], 0.0f), 1.0f) * 255.0f + 0.5f;
+    const uint8_t p = static_cast<uint8_t>(v);
+    dst[i] = lut != nullptr ? lut[p] : p;
+  }
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+int32_t hand_detection_tflite_dequantize(const void* src,
+                                         int32_t tensor_type,
+                                         int32_t count,
+                                         float scale,
+                                         int32_t zero_point,
+                                         float* dst) {
+  if (src == nullptr || dst == nullptr || count < 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+  // A small table keeps the loop free of int-to-float conversions.
+  float table[256];
+  if (tensor_type == HAND_DETECTION_TFLITE_TENSOR_UINT8) {
+    for (int32_t q = 0; q < 256; ++q) table[q] = (q - zero_point) * scale;
+  } else if (tensor_type == HAND_DETECTION_TFLITE_TENSOR_INT8) {
+    for (int32_t q = 0; q < 256; ++q) {
+      table[q] = (static_cast<int8_t>(q) - zero_point) * scale;
+    }
+  } else {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+  const uint8_t* bytes = static_cast<const uint8_t*>(src);
+  for (int32_t i = 0; i < count; ++i) dst[i] = table[bytes[i]];
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+int32_t hand_detection_tflite_palm_tile_grid(int32_t image_width,
+                                             int32_t image_height,
+                                             int32_t columns,
+                                             int32_t rows,
+                                             float overlap,
+                                             int32_t min_tile_size,
+                                             int32_t include_full_frame,
+                                             HandTileRect* out,
+                                             int32_t max_out) {
+  if (out == nullptr || image_width <= 0 || image_height <= 0 ||
+      columns <= 0 || rows <= 0 || !(overlap >= 0.0f && overlap <= 0.5f) ||
+      max_out < 0 || static_cast<int64_t>(columns) * rows + 1 > max_out) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+
+  int32_t tile_width;
+  int32_t tile_height;
+  columns = TileAxis(image_width, columns, overlap, min_tile_size,
+                     &tile_width);
+  rows = TileAxis(image_height, rows, overlap, min_tile_size, &tile_height);
+
+  int32_t count = 0;
+  const bool single = columns == 1 && rows == 1;
+  if (include_full_frame != 0 || single) {
+    out[count++] = {0, 0, image_width, image_height};
+  }
+  if (single) return count;
+
+  // Origins are spread evenly so the first and last tiles touch the frame
+  // edges; the last tile of an axis absorbs the rounding of the even origin.
+  const double step_x =
+      columns > 1
+          ? static_cast<double>(image_width - tile_width) / (columns - 1)
+          : 0.0;
+  const double step_y =
+      rows > 1 ? static_cast<double>(image_height - tile_height) / (rows - 1)
+               : 0.0;
+  for (int32_t r = 0; r < rows; ++r) {
+    const int32_t y = static_cast<int32_t>(std::lround(r * step_y)) & ~1;
+    const int32_t bottom = r == rows - 1 ? image_height : y + tile_height;
+    for (int32_t c = 0; c < columns; ++c) {
+      const int32_t x = static_cast<int32_t>(std::lround(c * step_x)) & ~1;
+      const int32_t right = c == columns - 1 ? image_width : x + tile_width;
+      out[count++] = {x, y, right - x, bottom - y};
+    }
+  }
+  return count;
+}
+
+int32_t hand_detection_tflite_map_tile_palms(HandPalmDetection* palms,
+                                             int32_t count,
+                                             const HandTileRect* tile,
+                                             int32_t image_width,
+                                             int32_t image_height) {
+  if ((palms == nullptr && count > 0) || count < 0 || tile == nullptr ||
+      tile->width <= 0 || tile->height <= 0 || image_width <= 0 ||
+      image_height <= 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+  // Tile edges on the frame border may cut hands; the frame does too.
+  const float left = tile->x > 0 ? 0.0f : -INFINITY;
+  const float top = tile->y > 0 ? 0.0f : -INFINITY;
+  const float right =
+      tile->x + tile->width < image_width ? tile->width : INFINITY;
+  const float bottom =
+      tile->y + tile->height < image_height ? tile->height : INFINITY;
+  const bool whole_frame = tile->width == image_width &&
+                           tile->height == image_height;
+
+  // Sizes are normalized to the longer side of the tile and of the frame.
+  const float tile_side = std::max(tile->width, tile->height);
+  const float size_scale = tile_side / std::max(image_width, image_height);
+  int32_t kept = 0;
+  for (int32_t i = 0; i < count; ++i) {
+    HandPalmDetection palm = palms[i];
+    const float cx = palm.sqn_rr_center_x * tile->width;
+    const float cy = palm.sqn_rr_center_y * tile->height;
+    if (!whole_frame) {
+      const float half = palm.sqn_rr_size * tile_side / 2;
+      const bool inside = cx >= 0.0f && cx < tile->width && cy >= 0.0f &&
+                          cy < tile->height;
+      if (!inside || cx - half < left || cy - half < top ||
+          cx + half > right || cy + half > bottom) {
+        continue;
+      }
+    }
+    palm.sqn_rr_center_x = (tile->x + cx) / image_width;
+    palm.sqn_rr_center_y = (tile->y + cy) / image_height;
+    palm.sqn_rr_size *= size_scale;
+    palms[kept++] = palm;
+  }
+  return kept;
+}
+
+int32_t hand_detection_tflite_suppress_palms(HandPalmDetection* palms,
+                                             int32_t count,
+                                             int32_t image_width,
+                                             int32_t image_height,
+                                             int32_t max_out) {
+  if ((palms == nullptr && count > 0) || count < 0 || max_out < 0 ||
+      image_width <= 0 || image_height <= 0) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+  return SuppressPalms(palms, static_cast<size_t>(count), image_width,
+                       image_height, palms, max_out, &GetDecodeScratch());
+}
+
+int32_t hand_detection_tflite_one_euro_filter(float* values,
+                                              float* state,
+                                              int32_t count,
+                                              int32_t group_size,
+                                              const float* scales,
+                                              float dt,
+                                              float min_cutoff,
+                                              float beta,
+                                              float derivative_cutoff) {
+  if ((count > 0 && (values == nullptr || state == nullptr)) || count < 0 ||
+      group_size <= 0 || !(dt > 0.0f) || !(min_cutoff > 0.0f) ||
+      !(beta >= 0.0f) || !(derivative_cutoff > 0.0f)) {
+    return HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT;
+  }
+  // A first-order low-pass at cutoff fc sampled every dt moves by
+  // alpha = r / (r + 1) towards the input, with r = 2 pi fc dt. No exp(), so
+  // the inner loop vectorizes.
+  const float step = static_cast<float>(2.0 * kPi) * dt;
+  const float inv_dt = 1.0f / dt;
+  const float derivative_alpha =
+      step * derivative_cutoff / (step * derivative_cutoff + 1.0f);
+  float* filtered = state;
+  float* derivative = state + count;
+  for (int32_t start = 0, group = 0; start < count;
+       start += group_size, ++group) {
+    const float speed_scale =
+        beta * (scales != nullptr ? scales[group] : 1.0f);
+    const int32_t end = std::min(count, start + group_size);
+    for (int32_t i = start; i < end; ++i) {
+      const float delta = values[i] - filtered[i];
+      const float dx = derivative[i] +
+                       derivative_alpha * (delta * inv_dt - derivative[i]);
+      const float r = step * (min_cutoff + speed_scale * std::fabs(dx));
+      const float x = filtered[i] + r / (r + 1.0f) * delta;
+      derivative[i] = dx;
+      filtered[i] = x;
+      values[i] = x;
+    }
+  }
+  return HAND_DETECTION_TFLITE_OK;
+}
+
+}  // extern "C"
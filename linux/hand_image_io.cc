@@ -0,0 +1,138 @@
+#include "hand_image_io.h"
+
+#include <csetjmp>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include <jpeglib.h>
+#include <png.h>
+
+namespace hand_detection_tflite {
+
+namespace {
+
+// libjpeg reports fatal errors through error_exit, which must not return.
+struct JpegErrorManager {
+  jpeg_error_mgr base;
+  std::jmp_buf jump;
+  char message[JMSG_LENGTH_MAX];
+};
+
+void JpegErrorExit(j_common_ptr cinfo) {
+  JpegErrorManager* manager = reinterpret_cast<JpegErrorManager*>(cinfo->err);
+  (*cinfo->err->format_message)(cinfo, manager->message);
+  std::longjmp(manager->jump, 1);
+}
+
+// Kept out of DecodeJpeg so no object with a destructor lives in the frame
+// that setjmp returns to.
+bool DecodeJpegFile(FILE* file, BgrImage* image, std::string* error) {
+  jpeg_decompress_struct cinfo;
+  JpegErrorManager manager;
+  cinfo.err = jpeg_std_error(&manager.base);
+  manager.base.error_exit = JpegErrorExit;
+  if (setjmp(manager.jump)) {
+    jpeg_destroy_decompress(&cinfo);
+    *error = manager.message;
+    return false;
+  }
+
+  jpeg_create_decompress(&cinfo);
+  jpeg_stdio_src(&cinfo, file);
+  jpeg_read_header(&cinfo, TRUE);
+#ifdef JCS_EXTENSIONS
+  cinfo.out_color_space = JCS_EXT_BGR;
+#else
+  cinfo.out_color_space = JCS_RGB;
+#endif
+  jpeg_start_decompress(&cinfo);
+
+  image->width = static_cast<int32_t>(cinfo.output_width);
+  image->height = static_cast<int32_t>(cinfo.output_height);
+  const size_t row_bytes = static_cast<size_t>(image->width) * 3;
+  image->pixels.resize(row_bytes * image->height);
+  while (cinfo.output_scanline < cinfo.output_height) {
+    JSAMPROW row = image->pixels.data() + row_bytes * cinfo.output_scanline;
+    jpeg_read_scanlines(&cinfo, &row, 1);
+  }
+  jpeg_finish_decompress(&cinfo);
+  jpeg_destroy_decompress(&cinfo);
+
+#ifndef JCS_EXTENSIONS
+  for (size_t i = 0; i < image->pixels.size(); i += 3) {
+    std::swap(image->pixels[i], image->pixels[i + 2]);
+  }
+#endif
+  return true;
+}
+
+bool DecodeJpeg(const std::string& path, BgrImage* image, std::string* error) {
+  FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    *error = "Cannot open " + path;
+    return false;
+  }
+  const bool ok = DecodeJpegFile(file, image, error);
+  std::fclose(file);
+  return ok;
+}
+
+bool DecodePng(const std::string& path, BgrImage* image, std::string* error) {
+  png_image png;
+  std::memset(&png, 0, sizeof(png));
+  png.version = PNG_IMAGE_VERSION;
+  if (!png_image_begin_read_from_file(&png, path.c_str())) {
+    *error = png.message;
+    return false;
+  }
+  png.format = PNG_FORMAT_BGR;
+  image->width = static_cast<int32_t>(png.width);
+  image->height = static_cast<int32_t>(png.height);
+  image->pixels.resize(PNG_IMAGE_SIZE(png));
+  if (!png_image_finish_read(&png, nullptr, image->pixels.data(), 0,
+                             nullptr)) {
+    *error = png.message;
+    png_image_free(&png);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool IsSupportedImagePath(const std::string& path) {
+  const size_t dot = path.rfind('.');
+  if (dot == std::string::npos) return false;
+  std::string ext = path.substr(dot + 1);
+  for (char& c : ext) {
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+  }
+  return ext == "jpg" || ext == "jpeg" || ext == "png";
+}
+
+bool DecodeImageFile(const std::string& path, BgrImage* image,
+                     std::string* error) {
+  image->width = 0;
+  image->height = 0;
+  unsigned char signature[8] = {0};
+  FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    *error = "Cannot open " + path;
+    return false;
+  }
+  const size_t read = std::fread(signature, 1, sizeof(signature), file);
+  std::fclose(file);
+
+  if (read >= 3 && signature[0] == 0xFF && signature[1] == 0xD8 &&
+      signature[2] == 0xFF) {
+    return DecodeJpeg(path, image, error);
+  }
+  if (read == sizeof(signature) && png_sig_cmp(signature, 0, 8) == 0) {
+    return DecodePng(path, image, error);
+  }
+  *error = "Unsupported image format: " + path;
+  return false;
+}
+
+}  // namespace hand_detection_tflite
@@ -0,0 +1,34 @@
+#ifndef HAND_DETECTION_TFLITE_HAND_IMAGE_IO_H_
+#define HAND_DETECTION_TFLITE_HAND_IMAGE_IO_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// JPEG/PNG decoding for the headless tools, via libjpeg(-turbo) and libpng.
+// The plugin and libhand_pipeline take already decoded pixels and do not
+// depend on this.
+
+namespace hand_detection_tflite {
+
+// Decoded BGR888 image with rows of width * 3 bytes.
+struct BgrImage {
+  int32_t width = 0;
+  int32_t height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+// True for paths with a .jpg, .jpeg or .png extension (case-insensitive).
+bool IsSupportedImagePath(const std::string& path);
+
+// Decodes a JPEG or PNG file, chosen by its signature rather than its
+// extension. Grayscale and paletted images are expanded to BGR; PNG alpha is
+// dropped. image->pixels is reused across calls. Returns false and sets
+// error on failure.
+bool DecodeImageFile(const std::string& path, BgrImage* image,
+                     std::string* error);
+
+}  // namespace hand_detection_tflite
+
+#endif  // HAND_DETECTION_TFLITE_HAND_IMAGE_IO_H_
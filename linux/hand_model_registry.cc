@@ -0,0 +1,114 @@
+#include "hand_model_registry.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <map>
+#include <mutex>
+
+namespace hand_detection_tflite {
+
+namespace {
+
+struct Registry {
+  std::mutex mutex;
+  std::map<std::string, std::weak_ptr<const SharedModel>> models;
+};
+
+// Never destroyed, so models released during static destruction still find
+// it.
+Registry& GetRegistry() {
+  static Registry* registry = new Registry();
+  return *registry;
+}
+
+std::string CanonicalPath(const std::string& path) {
+  char resolved[PATH_MAX];
+  return realpath(path.c_str(), resolved) != nullptr ? std::string(resolved)
+                                                      : path;
+}
+
+std::shared_ptr<const SharedModel> MapModel(const TfLiteApi* api,
+                                            const std::string& path,
+                                            std::string* error) {
+  const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    *error = "Failed to open model: " + path;
+    return nullptr;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    *error = "Failed to read model: " + path;
+    return nullptr;
+  }
+  const size_t size = static_cast<size_t>(st.st_size);
+  void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    *error = "Failed to map model: " + path;
+    return nullptr;
+  }
+
+  // TfLiteModelCreate references the buffer without copying it.
+  TfLiteModel* model = api->ModelCreate(data, size);
+  if (model == nullptr) {
+    munmap(data, size);
+    *error = "Failed to load model: " + path;
+    return nullptr;
+  }
+  return std::make_shared<const SharedModel>(api, path, data, size, model);
+}
+
+}  // namespace
+
+SharedModel::SharedModel(const TfLiteApi* api, const std::string& path,
+                         void* data, size_t size, TfLiteModel* model)
+    : api_(api), path_(path), data_(data), size_(size), model_(model) {}
+
+SharedModel::~SharedModel() {
+  api_->ModelDelete(model_);
+  munmap(data_, size_);
+}
+
+std::shared_ptr<const SharedModel> AcquireSharedModel(const std::string& path,
+                                                      std::string* error) {
+  const TfLiteApi* api = LoadTfLiteApi(error);
+  if (api == nullptr) return nullptr;
+
+  const std::string key = CanonicalPath(path);
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  std::weak_ptr<const SharedModel>& slot = registry.models[key];
+  std::shared_ptr<const SharedModel> model = slot.lock();
+  if (model != nullptr) return model;
+
+  model = MapModel(api, key, error);
+  if (model == nullptr) {
+    registry.models.erase(key);
+    return nullptr;
+  }
+  slot = model;
+  return model;
+}
+
+size_t SharedModelCount() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  size_t count = 0;
+  for (auto it = registry.models.begin(); it != registry.models.end();) {
+    if (it->second.expired()) {
+      it = registry.models.erase(it);
+    } else {
+      ++count;
+      ++it;
+    }
+  }
+  return count;
+}
+
+}  // namespace hand_detection_tflite
@@ -0,0 +1,55 @@
+#ifndef HAND_DETECTION_TFLITE_HAND_MODEL_REGISTRY_H_
+#define HAND_DETECTION_TFLITE_HAND_MODEL_REGISTRY_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <string>
+
+#include "hand_tflite.h"
+
+// Process-wide registry of memory-mapped .tflite models.
+//
+// Each model file is mapped read-only once and wrapped in a single
+// TfLiteModel that every interpreter built from that path references, so
+// weights are neither read into the heap nor duplicated per interpreter,
+// pipeline or detector. A mapping is released with its last reference.
+
+namespace hand_detection_tflite {
+
+class SharedModel {
+ public:
+  SharedModel(const TfLiteApi* api, const std::string& path, void* data,
+              size_t size, TfLiteModel* model);
+  ~SharedModel();
+
+  SharedModel(const SharedModel&) = delete;
+  SharedModel& operator=(const SharedModel&) = delete;
+
+  const TfLiteModel* model() const { return model_; }
+  const std::string& path() const { return path_; }
+  size_t size() const { return size_; }
+
+ private:
+  const TfLiteApi* api_;
+  std::string path_;
+  void* data_;
+  size_t size_;
+  TfLiteModel* model_;
+};
+
+// Returns the shared model for path, mapping it on first use. Paths are
+// compared after symlink and relative component resolution. Returns null and
+// fills error when the TFLite library, the file or the model is invalid.
+//
+// Interpreters created from the model must be deleted before the last
+// reference is dropped.
+std::shared_ptr<const SharedModel> AcquireSharedModel(const std::string& path,
+                                                      std::string* error);
+
+// Number of models currently mapped.
+size_t SharedModelCount();
+
+}  // namespace hand_detection_tflite
+
+#endif  // HAND_DETECTION_TFLITE_HAND_MODEL_REGISTRY_H_
@@ -0,0 +1,96 @@
+#include "hand_palm_anchors.h"
+
+#include <stddef.h>
+
+namespace hand_detection_tflite {
+
+namespace {
+
+struct AnchorLayer {
+  int32_t stride;
+  int32_t anchors_per_cell;
+};
+
+constexpr AnchorLayer kAnchorLayers[] = {{8, 2}, {16, 6}};
+
+constexpr int32_t AnchorCount(int32_t input_size) {
+  int32_t count = 0;
+  for (const AnchorLayer& layer : kAnchorLayers) {
+    const int32_t grid = (input_size + layer.stride - 1) / layer.stride;
+    count += grid * grid * layer.anchors_per_cell;
+  }
+  return count;
+}
+
+// Visits anchors in model output order as (index, cx, cy).
+template <typename Fn>
+constexpr void ForEachAnchor(int32_t input_size, Fn&& fn) {
+  int32_t index = 0;
+  for (const AnchorLayer& layer : kAnchorLayers) {
+    const int32_t grid = (input_size + layer.stride - 1) / layer.stride;
+    for (int32_t y = 0; y < grid; ++y) {
+      for (int32_t x = 0; x < grid; ++x) {
+        for (int32_t a = 0; a < layer.anchors_per_cell; ++a) {
+          fn(index++, (x + 0.5f) / grid, (y + 0.5f) / grid);
+        }
+      }
+    }
+  }
+}
+
+struct PalmAnchorTable {
+  float values[4 * kNumPalmAnchors];
+};
+
+// C++14 constexpr lambdas are unavailable, hence the functor.
+struct TableWriter {
+  PalmAnchorTable* table;
+  constexpr void operator()(int32_t i, float cx, float cy) const {
+    table->values[i] = cx;
+    table->values[kNumPalmAnchors + i] = cy;
+    table->values[2 * kNumPalmAnchors + i] = 1.0f;
+    table->values[3 * kNumPalmAnchors + i] = 1.0f;
+  }
+};
+
+constexpr PalmAnchorTable MakePalmAnchorTable() {
+  PalmAnchorTable table{};
+  ForEachAnchor(kPalmAnchorInputSize, TableWriter{&table});
+  return table;
+}
+
+static_assert(AnchorCount(kPalmAnchorInputSize) == kNumPalmAnchors,
+              "palm anchor layout changed");
+
+constexpr PalmAnchorTable kPalmAnchorTable = MakePalmAnchorTable();
+
+static_assert(kPalmAnchorTable.values[0] == 0.5f / 24,
+              "first stride-8 anchor");
+static_assert(kPalmAnchorTable.values[kNumPalmAnchors - 1] == 11.5f / 12,
+              "last stride-16 anchor");
+
+struct VectorWriter {
+  float* values;
+  int32_t count;
+  void operator()(int32_t i, float cx, float cy) const {
+    values[i] = cx;
+    values[count + i] = cy;
+  }
+};
+
+}  // namespace
+
+const float* PalmAnchors(int32_t input_size, std::vector<float>* storage,
+                         int32_t* num_anchors) {
+  if (input_size == kPalmAnchorInputSize) {
+    *num_anchors = kNumPalmAnchors;
+    return kPalmAnchorTable.values;
+  }
+  const int32_t count = AnchorCount(input_size);
+  storage->assign(static_cast<size_t>(count) * 4, 1.0f);
+  ForEachAnchor(input_size, VectorWriter{storage->data(), count});
+  *num_anchors = count;
+  return storage->data();
+}
+
+}  // namespace hand_detection_tflite
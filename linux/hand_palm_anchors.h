@@ -0,0 +1,30 @@
+#ifndef HAND_DETECTION_TFLITE_HAND_PALM_ANCHORS_H_
+#define HAND_DETECTION_TFLITE_HAND_PALM_ANCHORS_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+// SSD anchors of the palm model (PalmDetector.generateAnchors with strides
+// [8, 16, 16, 16] and fixedAnchorSize): one 2-anchor layer at stride 8 and
+// three stride-16 layers sharing a 6-anchor grid, all 1 x 1.
+//
+// Tables are struct-of-arrays [4, num_anchors] (every cx, then cy, w, h), the
+// layout hand_detection_tflite_decode_palms reads.
+
+namespace hand_detection_tflite {
+
+// Input size and anchor count of the bundled palm model.
+constexpr int32_t kPalmAnchorInputSize = 192;
+constexpr int32_t kNumPalmAnchors = 2016;
+
+// Returns the anchor table for a palm model with the given square input size
+// and stores its anchor count in num_anchors. The bundled 192 x 192 layout is
+// a table built at compile time and storage is not touched; other sizes are
+// generated into storage.
+const float* PalmAnchors(int32_t input_size, std::vector<float>* storage,
+                         int32_t* num_anchors);
+
+}  // namespace hand_detection_tflite
+
+#endif  // HAND_DETECTION_TFLITE_HAND_PALM_ANCHORS_H_
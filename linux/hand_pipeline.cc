@@ -0,0 +1,958 @@
+#include "include/hand_detection_tflite/hand_pipeline.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "hand_model_registry.h"
+#include "hand_palm_anchors.h"
+#include "hand_thread_pool.h"
+#include "hand_tflite.h"
+
+namespace hand_detection_tflite {
+
+namespace {
+
+// Landmark model outputs, in interpreter order.
+constexpr int32_t kLandmarkOutputScreen = 0;
+constexpr int32_t kLandmarkOutputScore = 1;
+constexpr int32_t kLandmarkOutputHandedness = 2;
+
+// Palm model outputs, in interpreter order.
+constexpr int32_t kPalmOutputBoxes = 0;
+constexpr int32_t kPalmOutputScores = 1;
+
+// sizeof(HandPipelineOptions) in ABI version 1, before num_workers.
+constexpr size_t kOptionsV1Size = offsetof(HandPipelineOptions, num_workers);
+
+// Smallest HandVideoOptions accepted: the frame size is required.
+constexpr size_t kVideoOptionsMinSize =
+    offsetof(HandVideoOptions, queue_depth);
+
+thread_local std::string g_last_error;
+
+void SetLastError(const std::string& message) { g_last_error = message; }
+
+// Source image for one detect call: packed BGR888 or YUV 4:2:0 planes.
+// Only the palm letterbox and the landmark crops sample it, so a YUV frame
+// is never converted at full resolution.
+struct Frame {
+  int32_t width;
+  int32_t height;
+  const uint8_t* bgr;
+  int32_t stride;
+  const HandYuv420Image* yuv;
+
+  // The part of the frame inside rect, sharing its pixels. A YUV tile's
+  // planes are described by yuv_tile, so rect must have an even origin.
+  Frame Tile(const HandTileRect& rect, HandYuv420Image* yuv_tile) const {
+    if (yuv == nullptr) {
+      return {rect.width, rect.height,
+              bgr + static_cast<size_t>(rect.y) * stride + rect.x * 3, stride,
+              nullptr};
+    }
+    const size_t chroma =
+        static_cast<size_t>(rect.y / 2) * yuv->uv_stride +
+        static_cast<size_t>(rect.x / 2) * yuv->uv_pixel_stride;
+    const uint8_t* luma =
+        yuv->y + static_cast<size_t>(rect.y) * yuv->y_stride + rect.x;
+    *yuv_tile = {luma,          yuv->u + chroma, yuv->v + chroma,
+                 yuv->y_stride, yuv->uv_stride,  yuv->uv_pixel_stride};
+    return {rect.width, rect.height, nullptr, 0, yuv_tile};
+  }
+
+  // Letterboxes the frame into image `index` of runner's size x size input
+  // tensor.
+  bool Letterbox(const TfLiteModelRunner& runner, int32_t index,
+                 int32_t size) const {
+    const size_t offset = static_cast<size_t>(size) * size * 3 * index;
+    int32_t status;
+    if (!runner.input_quantized()) {
+      float* dst = runner.input_data() + offset;
+      status = yuv != nullptr
+                   ? hand_detection_tflite_letterbox_yuv420_to_rgb_f32(
+                         yuv, width, height, dst, size, size, nullptr)
+                   : hand_detection_tflite_letterbox_bgr_to_rgb_f32(
+                         bgr, width, height, stride, dst, size, size, nullptr);
+    } else if (yuv == nullptr) {
+      status = hand_detection_tflite_letterbox_bgr_to_rgb_u8(
+          bgr, width, height, stride,
+          static_cast<uint8_t*>(runner.input_buffer()) + offset, size, size,
+          runner.input_lut(), nullptr);
+    } else {
+      float* scratch = QuantizeScratch(size);
+      status = hand_detection_tflite_letterbox_yuv420_to_rgb_f32(
+          yuv, width, height, scratch, size, size, nullptr);
+      if (status == HAND_DETECTION_TFLITE_OK) {
+        hand_detection_tflite_quantize_unit_f32(
+            scratch, size * size * 3, runner.input_lut(),
+            static_cast<uint8_t*>(runner.input_buffer()) + offset);
+      }
+    }
+    return status == HAND_DETECTION_TFLITE_OK;
+  }
+
+  // Samples hand's crop into image `index` of runner's input tensor.
+  void WarpCrop(const HandPipelineHand& hand, const TfLiteModelRunner& runner,
+                int32_t index, int32_t dst_size) const {
+    const int32_t crop_size = static_cast<int32_t>(std::lround(hand.size));
+    const size_t offset = static_cast<size_t>(dst_size) * dst_size * 3 * index;
+    if (!runner.input_quantized()) {
+      float* dst = runner.input_data() + offset;
+      if (yuv != nullptr) {
+        hand_detection_tflite_warp_crop_yuv420_to_rgb_f32(
+            yuv, width, height, hand.center_x, hand.center_y, hand.rotation,
+            crop_size, dst, dst_size);
+      } else {
+        hand_detection_tflite_warp_crop_bgr_to_rgb_f32(
+            bgr, width, height, stride, hand.center_x, hand.center_y,
+            hand.rotation, crop_size, dst, dst_size);
+      }
+      return;
+    }
+
+    uint8_t* dst = static_cast<uint8_t*>(runner.input_buffer()) + offset;
+    if (yuv == nullptr) {
+      hand_detection_tflite_warp_crop_bgr_to_rgb_u8(
+          bgr, width, height, stride, hand.center_x, hand.center_y,
+          hand.rotation, crop_size, dst, dst_size, runner.input_lut());
+      return;
+    }
+    // The YUV conversion is floating point, so YUV frames are quantized
+    // from a float crop.
+    float* scratch = QuantizeScratch(dst_size);
+    hand_detection_tflite_warp_crop_yuv420_to_rgb_f32(
+        yuv, width, height, hand.center_x, hand.center_y, hand.rotation,
+        crop_size, scratch, dst_size);
+    hand_detection_tflite_quantize_unit_f32(scratch, dst_size * dst_size * 3,
+                                            runner.input_lut(), dst);
+  }
+
+  // Per-thread float image for quantized inputs from YUV frames.
+  static float* QuantizeScratch(int32_t size) {
+    static thread_local std::vector<float> scratch;
+    scratch.resize(static_cast<size_t>(size) * size * 3);
+    return scratch.data();
+  }
+};
+
+// Frames shared by the decode, palm and landmark stages of
+// HandPipeline::DetectVideo. Frame i lives in slot i % depth. Each stage
+// counts the frames it has finished: a stage may take frame i once the
+// previous stage has finished it, and the decoder may refill a slot once
+// the landmark stage has reported the frame it held.
+class VideoRing {
+ public:
+  enum Stage { kDecode = 0, kPalms = 1, kLandmarks = 2 };
+
+  struct Slot {
+    std::vector<uint8_t> bgr;
+    int64_t timestamp_us = 0;
+    // Rotated squares from the palm stage, for the landmark stage.
+    std::vector<HandPipelineHand> hands;
+    int32_t count = 0;
+  };
+
+  VideoRing(int32_t depth, size_t frame_bytes, int32_t max_hands)
+      : slots_(depth) {
+    for (Slot& slot : slots_) {
+      slot.bgr.resize(frame_bytes);
+      slot.hands.resize(max_hands);
+    }
+  }
+
+  Slot& slot(int64_t frame) {
+    return slots_[static_cast<size_t>(frame % slots_.size())];
+  }
+
+  // Blocks until stage may process frame. Returns false when the stream
+  // ended before frame or was stopped.
+  bool WaitFor(Stage stage, int64_t frame) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [&] {
+      return stopped_ || frame >= end_ || Ready(stage, frame);
+    });
+    return !stopped_ && Ready(stage, frame);
+  }
+
+  void Done(Stage stage, int64_t frame) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    done_[stage] = frame + 1;
+    changed_.notify_all();
+  }
+
+  // The stream has `frames` frames.
+  void End(int64_t frames) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    end_ = frames;
+    changed_.notify_all();
+  }
+
+  // Stops every stage. The first failure is kept for Status.
+  void Stop(int32_t status, const std::string& error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (status < 0 && status_ == HAND_PIPELINE_OK) {
+      status_ = status;
+      error_ = error;
+    }
+    stopped_ = true;
+    changed_.notify_all();
+  }
+
+  int32_t Status(std::string* error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (status_ < 0) *error = error_;
+    return status_;
+  }
+
+ private:
+  bool Ready(Stage stage, int64_t frame) const {
+    if (stage == kDecode) {
+      return frame < done_[kLandmarks] + static_cast<int64_t>(slots_.size());
+    }
+    return frame < done_[stage - 1];
+  }
+
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  std::vector<Slot> slots_;
+  int64_t done_[3] = {0, 0, 0};
+  int64_t end_ = std::numeric_limits<int64_t>::max();
+  bool stopped_ = false;
+  int32_t status_ = HAND_PIPELINE_OK;
+  std::string error_;
+};
+
+}  // namespace
+
+}  // namespace hand_detection_tflite
+
+using hand_detection_tflite::AcquireSharedModel;
+using hand_detection_tflite::Frame;
+using hand_detection_tflite::kOptionsV1Size;
+using hand_detection_tflite::kVideoOptionsMinSize;
+using hand_detection_tflite::PalmAnchors;
+using hand_detection_tflite::SetLastError;
+using hand_detection_tflite::SharedModel;
+using hand_detection_tflite::SharedModelCount;
+using hand_detection_tflite::TaskGroup;
+using hand_detection_tflite::TfLiteModelRunner;
+using hand_detection_tflite::VideoRing;
+using hand_detection_tflite::WorkStealingPool;
+
+struct HandModel {
+  std::shared_ptr<const SharedModel> shared;
+};
+
+struct HandPipeline {
+  HandPipelineOptions options;
+  TfLiteModelRunner palm;
+  TfLiteModelRunner landmark;
+  // Sequential mode: a second landmark interpreter whose input is sized once
+  // to max_detections, for frames with more than one hand. Single hands, and
+  // every hand when the model rejects a batch dimension, run on the batch-1
+  // `landmark`.
+  TfLiteModelRunner landmark_batched;
+  bool landmark_batching = false;
+  int32_t palm_input_size = 0;
+  int32_t landmark_input_size = 0;
+  int32_t num_anchors = 0;
+  const float* anchors = nullptr;  // SoA, see hand_palm_anchors.h
+  std::vector<float> anchor_storage;
+  std::vector<HandPalmDetection> palms;  // max_detections capacity
+  std::vector<HandPipelineHand> candidates;
+
+  // Tiled palm detection: the tile grid of the last frame size, the current
+  // batch dimension of the palm input tensor, and the palms each tile found
+  // before the merge.
+  bool palm_tiled = false;
+  std::vector<HandTileRect> tiles;
+  int32_t tiles_width = 0;
+  int32_t tiles_height = 0;
+  int32_t palm_batch = 0;
+  // Cleared when the palm model rejects a batch dimension; tiles then run
+  // one invoke each.
+  bool palm_batching = true;
+  std::vector<HandPalmDetection> tile_palms;
+  std::vector<int32_t> tile_counts;
+
+  // Parallel mode (num_workers > 1): hands, and palm tiles when tiled, run
+  // as tasks on a work-stealing pool with one interpreter per worker; the
+  // thread waiting in Detect uses `landmark` / `palm`.
+  std::unique_ptr<WorkStealingPool> pool;
+  std::vector<std::unique_ptr<TfLiteModelRunner>> worker_landmarks;
+  std::vector<std::unique_ptr<TfLiteModelRunner>> worker_palms;
+
+  bool Initialize(const HandPipelineOptions& opts, std::string* error);
+  int32_t Detect(const Frame& frame, HandPipelineHand* out, int32_t max_out,
+                 std::string* error);
+  // The two halves of Detect, which touch disjoint state so that the video
+  // path can run them on different frames concurrently. FindHands writes the
+  // rotated squares of up to max_detections palms to hands and returns their
+  // count; FinishHands runs the landmark stage on them (helping the pool
+  // from the calling thread only when help is set) and writes the kept
+  // hands to out.
+  int32_t FindHands(const Frame& frame, HandPipelineHand* hands,
+                    std::string* error);
+  int32_t FinishHands(const Frame& frame, HandPipelineHand* hands,
+                      int32_t count, bool help, HandPipelineHand* out,
+                      int32_t max_out, std::string* error);
+  int64_t DetectVideo(const HandVideoOptions& video, HandVideoReadFn read_frame,
+                      HandVideoResultFn on_result, void* user_data,
+                      std::string* error);
+  int32_t DetectPalms(const Frame& frame, std::string* error);
+  int32_t DetectPalmsTiled(const Frame& frame, std::string* error);
+  bool RunPalmTiles(const Frame& frame, std::string* error);
+  bool RunPalmTilesParallel(const Frame& frame, std::string* error);
+  int32_t DecodeTile(const TfLiteModelRunner& runner, int32_t index,
+                     int32_t tile, const Frame& frame);
+  bool ResizePalmBatch(int32_t batch, std::string* error);
+  // Loads landmark_batched at max_detections; false when the model cannot
+  // take that batch.
+  bool LoadLandmarkBatch();
+  bool RunLandmarks(const Frame& frame, HandPipelineHand* hands, int32_t count,
+                    std::string* error);
+  bool RunLandmarksParallel(const Frame& frame, HandPipelineHand* hands,
+                            int32_t count, bool help, std::string* error);
+  void ParseLandmarks(const TfLiteModelRunner& runner, int32_t index,
+                      int32_t width, int32_t height,
+                      HandPipelineHand* hand) const;
+};
+
+bool HandPipeline::Initialize(const HandPipelineOptions& opts,
+                              std::string* error) {
+  options = opts;
+  if (!palm.Load(opts.palm_model_path, opts.num_threads, error)) return false;
+  palm_input_size = palm.input_dim(1);
+  palm_batch = palm.input_dim(0);
+  anchors = PalmAnchors(palm_input_size, &anchor_storage, &num_anchors);
+  palms.resize(opts.max_detections);
+  candidates.resize(opts.max_detections);
+  palm_tiled = std::max(opts.palm_tile_columns, 1) *
+                   std::max(opts.palm_tile_rows, 1) >
+               1;
+
+  const bool with_landmarks =
+      opts.mode == HAND_PIPELINE_MODE_BOXES_AND_LANDMARKS;
+  if (with_landmarks) {
+    if (!landmark.Load(opts.landmark_model_path, opts.num_threads, error)) {
+      return false;
+    }
+    landmark_input_size = landmark.input_dim(1);
+    if (opts.num_workers <= 1 && opts.max_detections > 1) {
+      landmark_batching = LoadLandmarkBatch();
+    }
+  }
+
+  if (opts.num_workers > 1 && (with_landmarks || palm_tiled)) {
+    for (int32_t i = 0; i < opts.num_workers; ++i) {
+      if (with_landmarks) {
+        std::unique_ptr<TfLiteModelRunner> runner(new TfLiteModelRunner());
+        if (!runner->Load(opts.landmark_model_path, opts.num_threads, error)) {
+          return false;
+        }
+        worker_landmarks.push_back(std::move(runner));
+      }
+      if (palm_tiled) {
+        std::unique_ptr<TfLiteModelRunner> runner(new TfLiteModelRunner());
+        if (!runner->Load(opts.palm_model_path, opts.num_threads, error)) {
+          return false;
+        }
+        worker_palms.push_back(std::move(runner));
+      }
+    }
+    pool.reset(new WorkStealingPool(opts.num_workers));
+  }
+  return true;
+}
+
+int32_t HandPipeline::Detect(const Frame& frame, HandPipelineHand* out,
+                             int32_t max_out, std::string* error) {
+  const int32_t count = FindHands(frame, candidates.data(), error);
+  if (count < 0) return count;
+  return FinishHands(frame, candidates.data(), count, true, out, max_out,
+                     error);
+}
+
+int32_t HandPipeline::FindHands(const Frame& frame, HandPipelineHand* hands,
+                                std::string* error) {
+  const int32_t width = frame.width;
+  const int32_t height = frame.height;
+
+  // Stage 1: palms of the whole frame, or merged from its tiles.
+  const int32_t palm_count = palm_tiled ? DetectPalmsTiled(frame, error)
+                                        : DetectPalms(frame, error);
+  if (palm_count < 0) return palm_count;
+
+  // Rotated squares in pixels; hands whose crop rounds to nothing are
+  // dropped in landmark mode, like ImageUtils.rotateAndCropRectangle.
+  const bool with_landmarks =
+      options.mode == HAND_PIPELINE_MODE_BOXES_AND_LANDMARKS;
+  const float long_side = static_cast<float>(std::max(width, height));
+  int32_t count = 0;
+  for (int32_t i = 0; i < palm_count; ++i) {
+    const HandPalmDetection& palm_det = palms[i];
+    HandPipelineHand& hand = hands[count];
+    std::memset(&hand, 0, sizeof(hand));
+    hand.score = palm_det.score;
+    hand.rotation = palm_det.rotation;
+    hand.center_x = palm_det.sqn_rr_center_x * width;
+    hand.center_y = palm_det.sqn_rr_center_y * height;
+    hand.size = palm_det.sqn_rr_size * long_side;
+    hand.handedness = HAND_PIPELINE_HANDEDNESS_UNKNOWN;
+
+    const float half = hand.size / 2;
+    hand.left = std::min(std::max(hand.center_x - half, 0.0f),
+                         static_cast<float>(width));
+    hand.top = std::min(std::max(hand.center_y - half, 0.0f),
+                        static_cast<float>(height));
+    hand.right = std::min(std::max(hand.center_x + half, 0.0f),
+                          static_cast<float>(width));
+    hand.bottom = std::min(std::max(hand.center_y + half, 0.0f),
+                           static_cast<float>(height));
+
+    if (with_landmarks && std::lround(hand.size) <= 0) continue;
+    ++count;
+  }
+  return count;
+}
+
+int32_t HandPipeline::FinishHands(const Frame& frame, HandPipelineHand* hands,
+                                  int32_t count, bool help,
+                                  HandPipelineHand* out, int32_t max_out,
+                                  std::string* error) {
+  // Stage 2: one task per hand on the pool, or all crops in one batched
+  // landmark inference.
+  const bool with_landmarks =
+      options.mode == HAND_PIPELINE_MODE_BOXES_AND_LANDMARKS;
+  if (with_landmarks && count > 0) {
+    const bool ok =
+        pool != nullptr
+            ? RunLandmarksParallel(frame, hands, count, help, error)
+            : RunLandmarks(frame, hands, count, error);
+    if (!ok) return HAND_PIPELINE_ERROR_INFERENCE;
+  }
+
+  int32_t written = 0;
+  for (int32_t i = 0; i < count && written < max_out; ++i) {
+    if (with_landmarks &&
+        hands[i].landmark_score < options.min_landmark_score) {
+      continue;
+    }
+    out[written++] = hands[i];
+  }
+  return written;
+}
+
+int32_t HandPipeline::DetectPalms(const Frame& frame, std::string* error) {
+  // Letterbox straight into the palm input tensor, run, decode.
+  if (!frame.Letterbox(palm, 0, palm_input_size)) {
+    *error = "Invalid image";
+    return HAND_PIPELINE_ERROR_INVALID_ARGUMENT;
+  }
+  if (!palm.Invoke(error)) return HAND_PIPELINE_ERROR_INFERENCE;
+
+  const int32_t count = hand_detection_tflite_decode_palms(
+      palm.output_data(hand_detection_tflite::kPalmOutputBoxes),
+      palm.output_data(hand_detection_tflite::kPalmOutputScores), num_anchors,
+      anchors, options.detector_confidence,
+      static_cast<float>(palm_input_size), frame.width, frame.height,
+      palms.data(), options.max_detections);
+  if (count < 0) {
+    *error = "Palm decoding failed";
+    return HAND_PIPELINE_ERROR_INFERENCE;
+  }
+  return count;
+}
+
+int32_t HandPipeline::DetectPalmsTiled(const Frame& frame,
+                                       std::string* error) {
+  const int32_t width = frame.width;
+  const int32_t height = frame.height;
+  if (width != tiles_width || height != tiles_height) {
+    const int32_t columns = std::max(options.palm_tile_columns, 1);
+    const int32_t rows = std::max(options.palm_tile_rows, 1);
+    tiles.resize(static_cast<size_t>(columns) * rows + 1);
+    const int32_t count = hand_detection_tflite_palm_tile_grid(
+        width, height, columns, rows, options.palm_tile_overlap,
+        palm_input_size, options.palm_tile_full_frame, tiles.data(),
+        static_cast<int32_t>(tiles.size()));
+    if (count < 0) {
+      *error = "Invalid palm tiling";
+      return HAND_PIPELINE_ERROR_INVALID_ARGUMENT;
+    }
+    tiles.resize(count);
+    tiles_width = width;
+    tiles_height = height;
+  }
+
+  // Each tile decodes into its own max_detections slice of tile_palms.
+  const int32_t num_tiles = static_cast<int32_t>(tiles.size());
+  tile_palms.resize(static_cast<size_t>(num_tiles) * options.max_detections);
+  tile_counts.assign(num_tiles, 0);
+  const bool ok = pool != nullptr ? RunPalmTilesParallel(frame, error)
+                                  : RunPalmTiles(frame, error);
+  if (!ok) return HAND_PIPELINE_ERROR_INFERENCE;
+
+  int32_t gathered = 0;
+  for (int32_t t = 0; t < num_tiles; ++t) {
+    const auto first =
+        tile_palms.begin() + static_cast<size_t>(t) * options.max_detections;
+    std::copy(first, first + tile_counts[t], tile_palms.begin() + gathered);
+    gathered += tile_counts[t];
+  }
+  const int32_t kept = hand_detection_tflite_suppress_palms(
+      tile_palms.data(), gathered, width, height, options.max_detections);
+  if (kept < 0) {
+    *error = "Palm decoding failed";
+    return HAND_PIPELINE_ERROR_INFERENCE;
+  }
+  std::copy(tile_palms.begin(), tile_palms.begin() + kept, palms.begin());
+  return kept;
+}
+
+bool HandPipeline::RunPalmTiles(const Frame& frame, std::string* error) {
+  // All tiles in one invoke when the model takes a batch dimension,
+  // otherwise one invoke per tile.
+  const int32_t num_tiles = static_cast<int32_t>(tiles.size());
+  if (palm_batching && !ResizePalmBatch(num_tiles, error)) {
+    palm_batching = false;
+    if (!ResizePalmBatch(1, error)) return false;
+  }
+  const int32_t batch = palm_batching ? num_tiles : 1;
+
+  for (int32_t first = 0; first < num_tiles; first += batch) {
+    const int32_t end = std::min(num_tiles, first + batch);
+    for (int32_t t = first; t < end; ++t) {
+      HandYuv420Image yuv_tile;
+      if (!frame.Tile(tiles[t], &yuv_tile)
+               .Letterbox(palm, t - first, palm_input_size)) {
+        *error = "Invalid image";
+        return false;
+      }
+    }
+    if (!palm.Invoke(error)) return false;
+    for (int32_t t = first; t < end; ++t) {
+      tile_counts[t] = DecodeTile(palm, t - first, t, frame);
+      if (tile_counts[t] < 0) {
+        *error = "Palm decoding failed";
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool HandPipeline::RunPalmTilesParallel(const Frame& frame,
+                                        std::string* error) {
+  std::atomic<bool> failed(false);
+  TaskGroup group(pool.get());
+  for (int32_t t = 0; t < static_cast<int32_t>(tiles.size()); ++t) {
+    group.Run([this, &frame, t, &failed](int32_t slot) {
+      TfLiteModelRunner& runner =
+          slot < static_cast<int32_t>(worker_palms.size())
+              ? *worker_palms[slot]
+              : palm;
+      HandYuv420Image yuv_tile;
+      std::string task_error;
+      if (!frame.Tile(tiles[t], &yuv_tile)
+               .Letterbox(runner, 0, palm_input_size) ||
+          !runner.Invoke(&task_error)) {
+        failed = true;
+        return;
+      }
+      tile_counts[t] = DecodeTile(runner, 0, t, frame);
+      if (tile_counts[t] < 0) failed = true;
+    });
+  }
+  group.Wait();
+  if (failed) {
+    *error = "Palm tile inference failed";
+    return false;
+  }
+  return true;
+}
+
+int32_t HandPipeline::DecodeTile(const TfLiteModelRunner& runner,
+                                 int32_t index, int32_t tile,
+                                 const Frame& frame) {
+  const HandTileRect& rect = tiles[tile];
+  HandPalmDetection* found =
+      tile_palms.data() + static_cast<size_t>(tile) * options.max_detections;
+  const size_t box_floats =
+      static_cast<size_t>(num_anchors) * HAND_DETECTION_TFLITE_PALM_BOX_STRIDE;
+  const int32_t count = hand_detection_tflite_decode_palms(
+      runner.output_data(hand_detection_tflite::kPalmOutputBoxes) +
+          box_floats * index,
+      runner.output_data(hand_detection_tflite::kPalmOutputScores) +
+          static_cast<size_t>(num_anchors) * index,
+      num_anchors, anchors, options.detector_confidence,
+      static_cast<float>(palm_input_size), rect.width, rect.height, found,
+      options.max_detections);
+  if (count < 0) return count;
+  return hand_detection_tflite_map_tile_palms(found, count, &rect, frame.width,
+                                              frame.height);
+}
+
+bool HandPipeline::ResizePalmBatch(int32_t batch, std::string* error) {
+  if (batch == palm_batch) return true;
+  const int dims[4] = {batch, palm_input_size, palm_input_size, 3};
+  if (!palm.ResizeInput(dims, 4, error)) return false;
+  palm_batch = batch;
+  // Models that reshape their outputs to a fixed batch of 1 fold the images
+  // into the anchor axis, which cannot be split back per tile.
+  if (palm.output_dim(hand_detection_tflite::kPalmOutputBoxes, 0) != batch) {
+    *error = "Palm model does not support batched input";
+    return false;
+  }
+  return true;
+}
+
+bool HandPipeline::LoadLandmarkBatch() {
+  const int32_t batch = options.max_detections;
+  const int dims[4] = {batch, landmark_input_size, landmark_input_size, 3};
+  std::string batch_error;
+  if (!landmark_batched.Load(options.landmark_model_path, options.num_threads,
+                             &batch_error) ||
+      !landmark_batched.ResizeInput(dims, 4, &batch_error) ||
+      landmark_batched.output_dim(
+          hand_detection_tflite::kLandmarkOutputScore, 0) != batch) {
+    // Models with a fixed batch of 1 keep the per-hand invokes.
+    return false;
+  }
+  // Slots past a frame's hand count are padding; start them out defined.
+  const size_t pixels = static_cast<size_t>(batch) * landmark_input_size *
+                        landmark_input_size * 3;
+  std::memset(landmark_batched.input_buffer(), 0,
+              landmark_batched.input_quantized() ? pixels
+                                                 : pixels * sizeof(float));
+  return true;
+}
+
+bool HandPipeline::RunLandmarks(const Frame& frame, HandPipelineHand* hands,
+                                int32_t count, std::string* error) {
+  // Several hands share one invoke of the fixed max_detections batch; the
+  // unused slots keep whatever crops they last held and are not parsed.
+  if (landmark_batching && count > 1) {
+    for (int32_t i = 0; i < count; ++i) {
+      frame.WarpCrop(hands[i], landmark_batched, i, landmark_input_size);
+    }
+    if (!landmark_batched.Invoke(error)) return false;
+    for (int32_t i = 0; i < count; ++i) {
+      ParseLandmarks(landmark_batched, i, frame.width, frame.height,
+                     &hands[i]);
+    }
+    return true;
+  }
+
+  for (int32_t i = 0; i < count; ++i) {
+    frame.WarpCrop(hands[i], landmark, 0, landmark_input_size);
+    if (!landmark.Invoke(error)) return false;
+    ParseLandmarks(landmark, 0, frame.width, frame.height, &hands[i]);
+  }
+  return true;
+}
+
+bool HandPipeline::RunLandmarksParallel(const Frame& frame,
+                                        HandPipelineHand* hands, int32_t count,
+                                        bool help, std::string* error) {
+  std::atomic<bool> failed(false);
+  TaskGroup group(pool.get());
+  for (int32_t i = 0; i < count; ++i) {
+    HandPipelineHand* hand = hands + i;
+    group.Run([this, &frame, hand, &failed](int32_t slot) {
+      TfLiteModelRunner& runner =
+          slot < static_cast<int32_t>(worker_landmarks.size())
+              ? *worker_landmarks[slot]
+              : landmark;
+      frame.WarpCrop(*hand, runner, 0, landmark_input_size);
+      std::string task_error;
+      if (!runner.Invoke(&task_error)) {
+        failed = true;
+        return;
+      }
+      ParseLandmarks(runner, 0, frame.width, frame.height, hand);
+    });
+  }
+  group.Wait(help);
+  if (failed) {
+    *error = "Interpreter invoke failed";
+    return false;
+  }
+  return true;
+}
+
+void HandPipeline::ParseLandmarks(const TfLiteModelRunner& runner,
+                                  int32_t index, int32_t width, int32_t height,
+                                  HandPipelineHand* hand) const {
+  constexpr int32_t kCoords = HAND_PIPELINE_NUM_LANDMARKS * 3;
+  const float raw_score =
+      runner.output_data(hand_detection_tflite::kLandmarkOutputScore)[index];
+  const float handedness = runner.output_data(
+      hand_detection_tflite::kLandmarkOutputHandedness)[index];
+  hand->landmark_score = 1.0f / (1.0f + std::exp(-raw_score));
+  hand->handedness = handedness > 0.5f ? HAND_PIPELINE_HANDEDNESS_RIGHT
+                                       : HAND_PIPELINE_HANDEDNESS_LEFT;
+  hand_detection_tflite_project_landmarks(
+      runner.output_data(hand_detection_tflite::kLandmarkOutputScreen) +
+          kCoords * index,
+      HAND_PIPELINE_NUM_LANDMARKS, static_cast<float>(landmark_input_size),
+      static_cast<int32_t>(std::lround(hand->size)), hand->center_x,
+      hand->center_y, hand->rotation, width, height, hand->landmarks);
+}
+
+int64_t HandPipeline::DetectVideo(const HandVideoOptions& video,
+                                  HandVideoReadFn read_frame,
+                                  HandVideoResultFn on_result,
+                                  void* user_data, std::string* error) {
+  const int32_t width = video.width;
+  const int32_t height = video.height;
+  const int32_t stride = width * 3;
+  VideoRing ring(video.queue_depth, static_cast<size_t>(stride) * height,
+                 options.max_detections);
+
+  // Decode thread: fills free slots ahead of the other stages.
+  std::thread decoder([&] {
+    for (int64_t i = 0; ring.WaitFor(VideoRing::kDecode, i); ++i) {
+      VideoRing::Slot& slot = ring.slot(i);
+      const int32_t status =
+          read_frame(user_data, slot.bgr.data(), &slot.timestamp_us);
+      if (status < 0) {
+        ring.Stop(HAND_PIPELINE_ERROR_INVALID_ARGUMENT,
+                  "Video frame read failed");
+        return;
+      }
+      if (status == 0) {
+        ring.End(i);
+        return;
+      }
+      ring.Done(VideoRing::kDecode, i);
+    }
+  });
+
+  // Palm thread: stage 1 of frame N + 1 overlaps stage 2 of frame N. The
+  // stages share the worker pool; only this thread helps run its tasks, so
+  // the fallback `palm` / `landmark` runners (slot size()) stay
+  // single-threaded.
+  std::thread palm_stage([&] {
+    std::string stage_error;
+    for (int64_t i = 0; ring.WaitFor(VideoRing::kPalms, i); ++i) {
+      VideoRing::Slot& slot = ring.slot(i);
+      const Frame frame = {width, height, slot.bgr.data(), stride, nullptr};
+      slot.count = FindHands(frame, slot.hands.data(), &stage_error);
+      if (slot.count < 0) {
+        ring.Stop(slot.count, stage_error);
+        return;
+      }
+      ring.Done(VideoRing::kPalms, i);
+    }
+  });
+
+  // Landmark stage and in-order reporting on the calling thread.
+  std::vector<HandPipelineHand> out(options.max_detections);
+  std::string stage_error;
+  int64_t reported = 0;
+  while (ring.WaitFor(VideoRing::kLandmarks, reported)) {
+    VideoRing::Slot& slot = ring.slot(reported);
+    const Frame frame = {width, height, slot.bgr.data(), stride, nullptr};
+    const int32_t count =
+        FinishHands(frame, slot.hands.data(), slot.count, false, out.data(),
+                    options.max_detections, &stage_error);
+    if (count < 0) {
+      ring.Stop(count, stage_error);
+      break;
+    }
+    const int32_t stop = on_result(user_data, reported, slot.timestamp_us,
+                                   out.data(), count);
+    ring.Done(VideoRing::kLandmarks, reported);
+    ++reported;
+    if (stop != 0) {
+      ring.Stop(HAND_PIPELINE_OK, "");
+      break;
+    }
+  }
+  decoder.join();
+  palm_stage.join();
+
+  const int32_t status = ring.Status(error);
+  return status < 0 ? status : reported;
+}
+
+extern "C" {
+
+int32_t hand_pipeline_abi_version(void) { return HAND_PIPELINE_ABI_VERSION; }
+
+void hand_pipeline_options_init(HandPipelineOptions* options) {
+  if (options == nullptr) return;
+  std::memset(options, 0, sizeof(*options));
+  options->struct_size = sizeof(*options);
+  options->num_threads = 0;
+  options->detector_confidence = 0.6f;
+  options->max_detections = 10;
+  options->min_landmark_score = 0.5f;
+  options->mode = HAND_PIPELINE_MODE_BOXES_AND_LANDMARKS;
+  options->num_workers = 0;
+  options->palm_tile_columns = 0;
+  options->palm_tile_rows = 0;
+  options->palm_tile_overlap = 0.25f;
+  options->palm_tile_full_frame = 1;
+}
+
+HandPipeline* hand_pipeline_create(const HandPipelineOptions* options) {
+  SetLastError("");
+  if (options == nullptr || options->struct_size < kOptionsV1Size) {
+    SetLastError("Invalid pipeline options");
+    return nullptr;
+  }
+  // Fields past the caller's struct_size keep their defaults.
+  HandPipelineOptions opts;
+  hand_pipeline_options_init(&opts);
+  std::memcpy(&opts, options,
+              std::min<size_t>(options->struct_size, sizeof(opts)));
+  opts.struct_size = sizeof(opts);
+
+  if (opts.palm_model_path == nullptr || opts.max_detections <= 0 ||
+      (opts.mode == HAND_PIPELINE_MODE_BOXES_AND_LANDMARKS &&
+       opts.landmark_model_path == nullptr) ||
+      opts.palm_tile_columns < 0 || opts.palm_tile_rows < 0 ||
+      !(opts.palm_tile_overlap >= 0.0f && opts.palm_tile_overlap <= 0.5f)) {
+    SetLastError("Invalid pipeline options");
+    return nullptr;
+  }
+
+  std::unique_ptr<HandPipeline> pipeline(new HandPipeline());
+  std::string error;
+  if (!pipeline->Initialize(opts, &error)) {
+    SetLastError(error);
+    return nullptr;
+  }
+  // Paths are only needed while loading; do not keep borrowed pointers.
+  pipeline->options.palm_model_path = nullptr;
+  pipeline->options.landmark_model_path = nullptr;
+  return pipeline.release();
+}
+
+int32_t hand_pipeline_detect(HandPipeline* pipeline, const uint8_t* bgr,
+                             int32_t width, int32_t height, int32_t src_stride,
+                             HandPipelineHand* out, int32_t max_out) {
+  if (pipeline == nullptr || bgr == nullptr || out == nullptr || width <= 0 ||
+      height <= 0 || src_stride < width * 3 || max_out < 0) {
+    SetLastError("Invalid detect arguments");
+    return HAND_PIPELINE_ERROR_INVALID_ARGUMENT;
+  }
+  const Frame frame = {width, height, bgr, src_stride, nullptr};
+  std::string error;
+  const int32_t result = pipeline->Detect(frame, out, max_out, &error);
+  if (result < 0) SetLastError(error);
+  return result;
+}
+
+int32_t hand_pipeline_detect_yuv420(HandPipeline* pipeline,
+                                    const HandYuv420Image* image,
+                                    int32_t width, int32_t height,
+                                    HandPipelineHand* out, int32_t max_out) {
+  if (pipeline == nullptr || image == nullptr || out == nullptr ||
+      width <= 0 || height <= 0 || max_out < 0) {
+    SetLastError("Invalid detect arguments");
+    return HAND_PIPELINE_ERROR_INVALID_ARGUMENT;
+  }
+  const Frame frame = {width, height, nullptr, 0, image};
+  std::string error;
+  const int32_t result = pipeline->Detect(frame, out, max_out, &error);
+  if (result < 0) SetLastError(error);
+  return result;
+}
+
+void hand_video_options_init(HandVideoOptions* options) {
+  if (options == nullptr) return;
+  std::memset(options, 0, sizeof(*options));
+  options->struct_size = sizeof(*options);
+  options->queue_depth = 4;
+}
+
+int64_t hand_pipeline_detect_video(HandPipeline* pipeline,
+                                   const HandVideoOptions* options,
+                                   HandVideoReadFn read_frame,
+                                   HandVideoResultFn on_result,
+                                   void* user_data) {
+  HandVideoOptions video;
+  hand_video_options_init(&video);
+  if (options != nullptr && options->struct_size >= kVideoOptionsMinSize) {
+    std::memcpy(&video, options,
+                std::min<size_t>(options->struct_size, sizeof(video)));
+  }
+  if (pipeline == nullptr || options == nullptr ||
+      options->struct_size < kVideoOptionsMinSize || read_frame == nullptr ||
+      on_result == nullptr || video.width <= 0 || video.height <= 0 ||
+      video.queue_depth < 1) {
+    SetLastError("Invalid video arguments");
+    return HAND_PIPELINE_ERROR_INVALID_ARGUMENT;
+  }
+  std::string error;
+  const int64_t result =
+      pipeline->DetectVideo(video, read_frame, on_result, user_data, &error);
+  if (result < 0) SetLastError(error);
+  return result;
+}
+
+void hand_pipeline_destroy(HandPipeline* pipeline) { delete pipeline; }
+
+HandModel* hand_model_acquire(const char* path) {
+  SetLastError("");
+  if (path == nullptr) {
+    SetLastError("Invalid model path");
+    return nullptr;
+  }
+  std::string error;
+  std::shared_ptr<const SharedModel> shared = AcquireSharedModel(path, &error);
+  if (shared == nullptr) {
+    SetLastError(error);
+    return nullptr;
+  }
+  return new HandModel{std::move(shared)};
+}
+
+void hand_model_release(HandModel* model) { delete model; }
+
+void* hand_model_create_interpreter(HandModel* model, const void* options) {
+  if (model == nullptr) {
+    SetLastError("Invalid model");
+    return nullptr;
+  }
+  std::string error;
+  const hand_detection_tflite::TfLiteApi* api =
+      hand_detection_tflite::LoadTfLiteApi(&error);
+  TfLiteInterpreter* interpreter =
+      api == nullptr
+          ? nullptr
+          : api->InterpreterCreate(
+                model->shared->model(),
+                static_cast<const TfLiteInterpreterOptions*>(options));
+  if (interpreter == nullptr) {
+    SetLastError(api == nullptr ? error
+                                : "Failed to create interpreter for " +
+                                      model->shared->path());
+  }
+  return interpreter;
+}
+
+int32_t hand_model_live_count(void) {
+  return static_cast<int32_t>(SharedModelCount());
+}
+
+const char* hand_pipeline_last_error(void) {
+  return hand_detection_tflite::g_last_error.c_str();
+}
+
+}  // extern "C"
@@ -0,0 +1,266 @@
+#include "hand_tflite.h"
+
+#include <dlfcn.h>
+
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#include "hand_model_registry.h"
+#include "include/hand_detection_tflite/hand_detection_tflite_kernels.h"
+
+namespace hand_detection_tflite {
+
+static_assert(kTensorFloat32 == HAND_DETECTION_TFLITE_TENSOR_FLOAT32 &&
+                  kTensorUInt8 == HAND_DETECTION_TFLITE_TENSOR_UINT8 &&
+                  kTensorInt8 == HAND_DETECTION_TFLITE_TENSOR_INT8,
+              "tensor type codes must match TfLiteType");
+
+namespace {
+
+// File name of the TFLite C library shipped in assets/bin.
+constexpr char kBundledLibrary[] = "libtensorflowlite_c-linux.so";
+
+// TfLiteStatus kTfLiteOk.
+constexpr int kTfLiteOk = 0;
+
+// Directory containing the shared object this code was loaded from, with a
+// trailing slash, or empty when it cannot be determined.
+std::string ThisLibraryDirectory() {
+  Dl_info info;
+  if (dladdr(reinterpret_cast<void*>(&ThisLibraryDirectory), &info) == 0 ||
+      info.dli_fname == nullptr) {
+    return std::string();
+  }
+  const std::string path(info.dli_fname);
+  const size_t slash = path.rfind('/');
+  return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+}
+
+void* OpenTfLiteLibrary(std::string* error) {
+  std::vector<std::string> candidates;
+  const char* env = std::getenv("HAND_TFLITE_LIB");
+  if (env != nullptr && env[0] != '\0') candidates.emplace_back(env);
+  const std::string dir = ThisLibraryDirectory();
+  if (!dir.empty()) candidates.push_back(dir + kBundledLibrary);
+  candidates.emplace_back(kBundledLibrary);
+  candidates.emplace_back("libtensorflowlite_c.so");
+
+  std::string tried;
+  for (const std::string& candidate : candidates) {
+    void* handle = dlopen(candidate.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle != nullptr) return handle;
+    tried += "\n  " + candidate + ": " + dlerror();
+  }
+  *error = "Failed to load TensorFlow Lite C library. Tried:" + tried;
+  return nullptr;
+}
+
+template <typename T>
+bool Resolve(void* handle, const char* name, T* fn, std::string* error) {
+  *fn = reinterpret_cast<T>(dlsym(handle, name));
+  if (*fn == nullptr) {
+    *error = std::string("TensorFlow Lite C library is missing ") + name;
+    return false;
+  }
+  return true;
+}
+
+bool ResolveAll(void* handle, TfLiteApi* api, std::string* error) {
+  return Resolve(handle, "TfLiteVersion", &api->Version, error) &&
+         Resolve(handle, "TfLiteModelCreate", &api->ModelCreate, error) &&
+         Resolve(handle, "TfLiteModelCreateFromFile",
+                 &api->ModelCreateFromFile, error) &&
+         Resolve(handle, "TfLiteModelDelete", &api->ModelDelete, error) &&
+         Resolve(handle, "TfLiteInterpreterOptionsCreate",
+                 &api->InterpreterOptionsCreate, error) &&
+         Resolve(handle, "TfLiteInterpreterOptionsDelete",
+                 &api->InterpreterOptionsDelete, error) &&
+         Resolve(handle, "TfLiteInterpreterOptionsSetNumThreads",
+                 &api->InterpreterOptionsSetNumThreads, error) &&
+         Resolve(handle, "TfLiteInterpreterCreate", &api->InterpreterCreate,
+                 error) &&
+         Resolve(handle, "TfLiteInterpreterDelete", &api->InterpreterDelete,
+                 error) &&
+         Resolve(handle, "TfLiteInterpreterGetInputTensor",
+                 &api->InterpreterGetInputTensor, error) &&
+         Resolve(handle, "TfLiteInterpreterResizeInputTensor",
+                 &api->InterpreterResizeInputTensor, error) &&
+         Resolve(handle, "TfLiteInterpreterAllocateTensors",
+                 &api->InterpreterAllocateTensors, error) &&
+         Resolve(handle, "TfLiteInterpreterInvoke", &api->InterpreterInvoke,
+                 error) &&
+         Resolve(handle, "TfLiteInterpreterGetOutputTensorCount",
+                 &api->InterpreterGetOutputTensorCount, error) &&
+         Resolve(handle, "TfLiteInterpreterGetOutputTensor",
+                 &api->InterpreterGetOutputTensor, error) &&
+         Resolve(handle, "TfLiteTensorType", &api->TensorType, error) &&
+         Resolve(handle, "TfLiteTensorNumDims", &api->TensorNumDims, error) &&
+         Resolve(handle, "TfLiteTensorDim", &api->TensorDim, error) &&
+         Resolve(handle, "TfLiteTensorByteSize", &api->TensorByteSize,
+                 error) &&
+         Resolve(handle, "TfLiteTensorData", &api->TensorData, error) &&
+         Resolve(handle, "TfLiteTensorQuantizationParams",
+                 &api->TensorQuantizationParams, error);
+}
+
+}  // namespace
+
+const TfLiteApi* LoadTfLiteApi(std::string* error) {
+  static std::once_flag once;
+  static TfLiteApi api;
+  static const TfLiteApi* loaded = nullptr;
+  static std::string load_error;
+
+  std::call_once(once, [] {
+    void* handle = OpenTfLiteLibrary(&load_error);
+    if (handle == nullptr) return;
+    if (!ResolveAll(handle, &api, &load_error)) {
+      dlclose(handle);
+      return;
+    }
+    // The handle is intentionally kept open for the process lifetime.
+    loaded = &api;
+  });
+
+  if (loaded == nullptr && error != nullptr) *error = load_error;
+  return loaded;
+}
+
+TfLiteModelRunner::~TfLiteModelRunner() { Reset(); }
+
+void TfLiteModelRunner::Reset() {
+  if (api_ == nullptr) return;
+  if (interpreter_ != nullptr) api_->InterpreterDelete(interpreter_);
+  if (options_ != nullptr) api_->InterpreterOptionsDelete(options_);
+  interpreter_ = nullptr;
+  options_ = nullptr;
+  model_.reset();
+  input_type_ = kTensorFloat32;
+  dequantized_.clear();
+}
+
+bool TfLiteModelRunner::Load(const std::string& path, int32_t num_threads,
+                             std::string* error) {
+  Reset();
+  api_ = LoadTfLiteApi(error);
+  if (api_ == nullptr) return false;
+
+  model_ = AcquireSharedModel(path, error);
+  if (model_ == nullptr) return false;
+  options_ = api_->InterpreterOptionsCreate();
+  if (num_threads > 0) {
+    api_->InterpreterOptionsSetNumThreads(options_, num_threads);
+  }
+  interpreter_ = api_->InterpreterCreate(model_->model(), options_);
+  if (interpreter_ == nullptr) {
+    *error = "Failed to create interpreter for " + path;
+    Reset();
+    return false;
+  }
+  if (api_->InterpreterAllocateTensors(interpreter_) != kTfLiteOk) {
+    *error = "Failed to allocate tensors for " + path;
+    Reset();
+    return false;
+  }
+  return InspectTensors(path, error);
+}
+
+bool TfLiteModelRunner::InspectTensors(const std::string& path,
+                                       std::string* error) {
+  const TfLiteTensor* input = api_->InterpreterGetInputTensor(interpreter_, 0);
+  input_type_ = api_->TensorType(input);
+  input_lut_identity_ = true;
+  if (input_type_ == kTensorUInt8 || input_type_ == kTensorInt8) {
+    const TfLiteQuantParams q = api_->TensorQuantizationParams(input);
+    const int32_t status = hand_detection_tflite_input_quantization_lut(
+        q.scale, q.zero_point, input_type_, input_lut_);
+    if (status < 0) {
+      *error = "Unsupported input quantization in " + path;
+      Reset();
+      return false;
+    }
+    input_lut_identity_ = status == 1;
+  } else if (input_type_ != kTensorFloat32) {
+    *error = "Unsupported input tensor type in " + path;
+    Reset();
+    return false;
+  }
+
+  const int32_t outputs = api_->InterpreterGetOutputTensorCount(interpreter_);
+  dequantized_.assign(outputs, std::vector<float>());
+  for (int32_t i = 0; i < outputs; ++i) {
+    const int type =
+        api_->TensorType(api_->InterpreterGetOutputTensor(interpreter_, i));
+    if (type != kTensorFloat32 && type != kTensorUInt8 &&
+        type != kTensorInt8) {
+      *error = "Unsupported output tensor type in " + path;
+      Reset();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TfLiteModelRunner::ResizeInput(const int* dims, int32_t dims_size,
+                                    std::string* error) {
+  if (api_->InterpreterResizeInputTensor(interpreter_, 0, dims, dims_size) !=
+          kTfLiteOk ||
+      api_->InterpreterAllocateTensors(interpreter_) != kTfLiteOk) {
+    *error = "Failed to resize input tensor";
+    return false;
+  }
+  return true;
+}
+
+bool TfLiteModelRunner::Invoke(std::string* error) {
+  if (api_->InterpreterInvoke(interpreter_) != kTfLiteOk) {
+    *error = "Interpreter invoke failed";
+    return false;
+  }
+  for (size_t i = 0; i < dequantized_.size(); ++i) {
+    const TfLiteTensor* tensor = api_->InterpreterGetOutputTensor(
+        interpreter_, static_cast<int32_t>(i));
+    const int type = api_->TensorType(tensor);
+    if (type == kTensorFloat32) continue;
+    // One byte per element; the size follows batch resizes.
+    const size_t count = api_->TensorByteSize(tensor);
+    const TfLiteQuantParams q = api_->TensorQuantizationParams(tensor);
+    dequantized_[i].resize(count);
+    hand_detection_tflite_dequantize(
+        api_->TensorData(tensor), type, static_cast<int32_t>(count), q.scale,
+        q.zero_point, dequantized_[i].data());
+  }
+  return true;
+}
+
+int32_t TfLiteModelRunner::input_dim(int32_t index) const {
+  return api_->TensorDim(api_->InterpreterGetInputTensor(interpreter_, 0),
+                         index);
+}
+
+int32_t TfLiteModelRunner::output_dim(int32_t output, int32_t index) const {
+  return api_->TensorDim(api_->InterpreterGetOutputTensor(interpreter_, output),
+                         index);
+}
+
+float* TfLiteModelRunner::input_data() const {
+  return static_cast<float*>(input_buffer());
+}
+
+void* TfLiteModelRunner::input_buffer() const {
+  return api_->TensorData(api_->InterpreterGetInputTensor(interpreter_, 0));
+}
+
+const float* TfLiteModelRunner::output_data(int32_t index) const {
+  const std::vector<float>& dequantized = dequantized_[index];
+  if (!dequantized.empty()) return dequantized.data();
+  return static_cast<const float*>(
+      api_->TensorData(api_->InterpreterGetOutputTensor(interpreter_, index)));
+}
+
+int32_t TfLiteModelRunner::output_count() const {
+  return api_->InterpreterGetOutputTensorCount(interpreter_);
+}
+
+}  // namespace hand_detection_tflite
@@ -0,0 +1,150 @@
+#ifndef HAND_DETECTION_TFLITE_HAND_TFLITE_H_
+#define HAND_DETECTION_TFLITE_HAND_TFLITE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Runtime binding to the TensorFlow Lite C API.
+//
+// The bundled libtensorflowlite_c-linux.so carries the SONAME
+// libtensorflowlite_c.so, so it cannot be linked by its bundled file name.
+// Like HandLandmarkModelRunner.ensureTFLiteLoaded on the Dart side, the
+// library is located at runtime (HAND_TFLITE_LIB override, next to this
+// library, then the default search path) and the symbols below are resolved
+// with dlsym.
+
+extern "C" {
+typedef struct TfLiteModel TfLiteModel;
+typedef struct TfLiteInterpreterOptions TfLiteInterpreterOptions;
+typedef struct TfLiteInterpreter TfLiteInterpreter;
+typedef struct TfLiteTensor TfLiteTensor;
+}
+
+namespace hand_detection_tflite {
+
+class SharedModel;
+
+// Subset of TfLiteType values used by the pipeline.
+enum TfLiteTensorType {
+  kTensorFloat32 = 1,
+  kTensorUInt8 = 3,
+  kTensorInt8 = 9,
+};
+
+// Mirrors TfLiteQuantizationParams.
+struct TfLiteQuantParams {
+  float scale;
+  int32_t zero_point;
+};
+
+// Function table for the TFLite C API.
+struct TfLiteApi {
+  const char* (*Version)();
+  TfLiteModel* (*ModelCreate)(const void* data, size_t size);
+  TfLiteModel* (*ModelCreateFromFile)(const char* path);
+  void (*ModelDelete)(TfLiteModel* model);
+  TfLiteInterpreterOptions* (*InterpreterOptionsCreate)();
+  void (*InterpreterOptionsDelete)(TfLiteInterpreterOptions* options);
+  void (*InterpreterOptionsSetNumThreads)(TfLiteInterpreterOptions* options,
+                                          int32_t num_threads);
+  TfLiteInterpreter* (*InterpreterCreate)(
+      const TfLiteModel* model, const TfLiteInterpreterOptions* options);
+  void (*InterpreterDelete)(TfLiteInterpreter* interpreter);
+  TfLiteTensor* (*InterpreterGetInputTensor)(
+      const TfLiteInterpreter* interpreter, int32_t index);
+  int (*InterpreterResizeInputTensor)(TfLiteInterpreter* interpreter,
+                                      int32_t index, const int* dims,
+                                      int32_t dims_size);
+  int (*InterpreterAllocateTensors)(TfLiteInterpreter* interpreter);
+  int (*InterpreterInvoke)(TfLiteInterpreter* interpreter);
+  int32_t (*InterpreterGetOutputTensorCount)(
+      const TfLiteInterpreter* interpreter);
+  const TfLiteTensor* (*InterpreterGetOutputTensor)(
+      const TfLiteInterpreter* interpreter, int32_t index);
+  int (*TensorType)(const TfLiteTensor* tensor);
+  int32_t (*TensorNumDims)(const TfLiteTensor* tensor);
+  int32_t (*TensorDim)(const TfLiteTensor* tensor, int32_t dim_index);
+  size_t (*TensorByteSize)(const TfLiteTensor* tensor);
+  void* (*TensorData)(const TfLiteTensor* tensor);
+  TfLiteQuantParams (*TensorQuantizationParams)(const TfLiteTensor* tensor);
+};
+
+// Loads the TFLite C library once per process. Returns null and fills error
+// when it cannot be found or lacks a required symbol.
+const TfLiteApi* LoadTfLiteApi(std::string* error);
+
+// One interpreter over a shared, memory-mapped model (see
+// hand_model_registry.h) with fixed input shape.
+//
+// Input 0 may be float32 or a uint8/int8 quantized tensor; uint8/int8
+// outputs are dequantized after each Invoke so output_data is always float.
+//
+// Not thread-safe: each thread that runs inference needs its own runner.
+class TfLiteModelRunner {
+ public:
+  TfLiteModelRunner() = default;
+  ~TfLiteModelRunner();
+
+  TfLiteModelRunner(const TfLiteModelRunner&) = delete;
+  TfLiteModelRunner& operator=(const TfLiteModelRunner&) = delete;
+
+  // Creates an interpreter for the model at path and allocates tensors. num_threads <= 0 keeps the
+  // TFLite default.
+  bool Load(const std::string& path, int32_t num_threads, std::string* error);
+
+  // Resizes input 0 to dims and reallocates tensors.
+  bool ResizeInput(const int* dims, int32_t dims_size, std::string* error);
+
+  bool Invoke(std::string* error);
+
+  // Input tensor 0 geometry ([N, H, W, C]).
+  int32_t input_dim(int32_t index) const;
+
+  // Input tensor 0 element type (TfLiteTensorType).
+  int32_t input_type() const { return input_type_; }
+  bool input_quantized() const { return input_type_ != kTensorFloat32; }
+
+  // For quantized inputs: the table mapping an 8-bit pixel value to the
+  // stored byte, or null when pixels are stored unchanged. See
+  // hand_detection_tflite_input_quantization_lut.
+  const uint8_t* input_lut() const {
+    return input_lut_identity_ ? nullptr : input_lut_;
+  }
+
+  // Float input data; only valid when !input_quantized().
+  float* input_data() const;
+  // Input data of either type.
+  void* input_buffer() const;
+
+  const float* output_data(int32_t index) const;
+  int32_t output_count() const;
+  // Output tensor `output` geometry, e.g. [N, anchors, 18].
+  int32_t output_dim(int32_t output, int32_t index) const;
+
+  const TfLiteApi* api() const { return api_; }
+  TfLiteInterpreter* interpreter() const { return interpreter_; }
+
+ private:
+  void Reset();
+  // Records the input encoding and validates the tensor types after Load.
+  bool InspectTensors(const std::string& path, std::string* error);
+
+  const TfLiteApi* api_ = nullptr;
+  std::shared_ptr<const SharedModel> model_;
+  TfLiteInterpreterOptions* options_ = nullptr;
+  TfLiteInterpreter* interpreter_ = nullptr;
+
+  int32_t input_type_ = kTensorFloat32;
+  uint8_t input_lut_[256];
+  bool input_lut_identity_ = true;
+  // Dequantized copies of uint8/int8 outputs, empty for float outputs.
+  std::vector<std::vector<float>> dequantized_;
+};
+
+}  // namespace hand_detection_tflite
+
+#endif  // HAND_DETECTION_TFLITE_HAND_TFLITE_H_
@@ -0,0 +1,120 @@
+#include "hand_thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace hand_detection_tflite {
+
+namespace {
+
+// Upper bound on a single blocking wait. Waiters re-check their predicate
+// and look for stealable work after each timeout, so a missed notification
+// can only delay them, never hang them.
+constexpr std::chrono::milliseconds kWaitSlice(20);
+
+}  // namespace
+
+WorkStealingPool::WorkStealingPool(int32_t num_workers) {
+  const int32_t count = std::max(num_workers, 1);
+  for (int32_t i = 0; i < count; ++i) {
+    queues_.emplace_back(new Queue());
+  }
+  for (int32_t i = 0; i < count; ++i) {
+    threads_.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread& thread : threads_) thread.join();
+}
+
+void WorkStealingPool::Submit(PoolTask task) {
+  const uint32_t index = next_queue_.fetch_add(1) % queues_.size();
+  {
+    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(task));
+  }
+  pending_.fetch_add(1);
+  {
+    // Pairs with the predicate check in WorkerLoop so a wakeup is not lost.
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+  }
+  wake_.notify_one();
+}
+
+bool WorkStealingPool::PopLocal(int32_t index, PoolTask* task) {
+  Queue& queue = *queues_[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty()) return false;
+  *task = std::move(queue.tasks.back());
+  queue.tasks.pop_back();
+  return true;
+}
+
+bool WorkStealingPool::Steal(int32_t thief, PoolTask* task) {
+  const int32_t count = size();
+  for (int32_t offset = 1; offset <= count; ++offset) {
+    const int32_t victim = (thief + offset) % count;
+    if (victim == thief) continue;
+    Queue& queue = *queues_[victim];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) continue;
+    *task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    return true;
+  }
+  return false;
+}
+
+bool WorkStealingPool::RunOne() {
+  PoolTask task;
+  if (!Steal(size(), &task)) return false;
+  pending_.fetch_sub(1);
+  task(size());
+  return true;
+}
+
+void WorkStealingPool::WorkerLoop(int32_t index) {
+  while (true) {
+    PoolTask task;
+    if (PopLocal(index, &task) || Steal(index, &task)) {
+      pending_.fetch_sub(1);
+      task(index);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    wake_.wait_for(lock, kWaitSlice,
+                   [this] { return stopping_ || pending_.load() > 0; });
+    if (stopping_ && pending_.load() == 0) return;
+  }
+}
+
+void TaskGroup::Run(PoolTask task) {
+  outstanding_.fetch_add(1);
+  pool_->Submit([this, task](int32_t slot) {
+    task(slot);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (outstanding_.fetch_sub(1) == 1) done_.notify_all();
+  });
+}
+
+void TaskGroup::Wait(bool help) {
+  while (outstanding_.load() > 0) {
+    if (help && pool_->RunOne()) continue;
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait_for(lock, kWaitSlice,
+                   [this] { return outstanding_.load() == 0; });
+  }
+  // The last task drops outstanding_ to 0 and notifies under mutex_. Taking
+  // it once more means that task has released it, so the caller may destroy
+  // the group as soon as this returns.
+  std::lock_guard<std::mutex> lock(mutex_);
+}
+
+}  // namespace hand_detection_tflite
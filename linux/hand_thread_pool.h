@@ -0,0 +1,86 @@
+#ifndef HAND_DETECTION_TFLITE_HAND_THREAD_POOL_H_
+#define HAND_DETECTION_TFLITE_HAND_THREAD_POOL_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hand_detection_tflite {
+
+// A task receives the slot index of the thread running it: 0..size()-1 for
+// pool workers and size() for a thread helping from TaskGroup::Wait. Slots
+// let tasks use per-thread resources (e.g. one interpreter each) without
+// locking.
+typedef std::function<void(int32_t slot)> PoolTask;
+
+// Fixed-size work-stealing thread pool.
+//
+// Each worker owns a deque: it pops its own work LIFO from the back (cache
+// warm) and, when empty, steals FIFO from the front of the other deques.
+// Submissions from outside the pool are spread round-robin across deques.
+class WorkStealingPool {
+ public:
+  explicit WorkStealingPool(int32_t num_workers);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  int32_t size() const { return static_cast<int32_t>(queues_.size()); }
+
+  void Submit(PoolTask task);
+
+  // Runs one queued task on the calling thread as slot size(). Returns false
+  // when every deque is empty.
+  bool RunOne();
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<PoolTask> tasks;
+  };
+
+  void WorkerLoop(int32_t index);
+  bool PopLocal(int32_t index, PoolTask* task);
+  bool Steal(int32_t thief, PoolTask* task);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+  std::atomic<uint32_t> next_queue_{0};
+  std::atomic<int32_t> pending_{0};
+
+  std::mutex wake_mutex_;
+  std::condition_variable wake_;
+  bool stopping_ = false;
+};
+
+// Tracks a set of tasks and signals a single completion when all finish.
+class TaskGroup {
+ public:
+  explicit TaskGroup(WorkStealingPool* pool) : pool_(pool) {}
+
+  void Run(PoolTask task);
+
+  // Blocks until every task passed to Run has finished. With help, queued
+  // work (of any group) runs on the calling thread meanwhile as slot
+  // size(); without it the thread only sleeps, so two threads waiting on the
+  // same pool never run tasks as the same slot at once.
+  void Wait(bool help = true);
+
+ private:
+  WorkStealingPool* pool_;
+  std::atomic<int32_t> outstanding_{0};
+  std::mutex mutex_;
+  std::condition_variable done_;
+};
+
+}  // namespace hand_detection_tflite
+
+#endif  // HAND_DETECTION_TFLITE_HAND_THREAD_POOL_H_
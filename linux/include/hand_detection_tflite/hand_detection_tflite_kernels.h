@@ -0,0 +1,329 @@
+#ifndef FLUTTER_PLUGIN_HAND_DETECTION_TFLITE_KERNELS_H_
+#define FLUTTER_PLUGIN_HAND_DETECTION_TFLITE_KERNELS_H_
+
+#include <stdint.h>
+
+// Native preprocessing/postprocessing kernels for the hand detection pipeline.
+//
+// These functions are plain C so they can be bound from Dart via dart:ffi and
+// reused by native consumers without pulling in Flutter or GTK.
+
+#if defined(__GNUC__)
+#define HAND_DETECTION_TFLITE_EXPORT __attribute__((visibility("default")))
+#else
+#define HAND_DETECTION_TFLITE_EXPORT
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Status codes returned by the kernels.
+#define HAND_DETECTION_TFLITE_OK 0
+#define HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT -1
+
+// Tensor element types, numbered like TfLiteType.
+#define HAND_DETECTION_TFLITE_TENSOR_FLOAT32 1
+#define HAND_DETECTION_TFLITE_TENSOR_UINT8 3
+#define HAND_DETECTION_TFLITE_TENSOR_INT8 9
+
+// Resizes a BGR888 image keeping its aspect ratio, centers it on a black
+// canvas of dst_width x dst_height, swaps BGR to RGB and scales to [0, 1],
+// writing an interleaved float32 RGB tensor in a single pass.
+//
+// Matches the Dart ImageUtils.keepAspectResizeAndPad + matToFloat32Tensor
+// pair (bilinear sampling with OpenCV INTER_LINEAR pixel-center alignment).
+//
+// src_stride is the number of bytes between source rows. dst must hold
+// dst_width * dst_height * 3 floats. When info is non-null it receives
+// [resized_width, resized_height, pad_left, pad_top].
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_letterbox_bgr_to_rgb_f32(const uint8_t* src,
+                                               int32_t src_width,
+                                               int32_t src_height,
+                                               int32_t src_stride,
+                                               float* dst,
+                                               int32_t dst_width,
+                                               int32_t dst_height,
+                                               int32_t* info);
+
+// A YUV 4:2:0 frame: a full-resolution Y plane and 2x2-subsampled U and V
+// planes. The strides follow Android's YUV_420_888 layout, so one struct
+// covers I420 (uv_pixel_stride 1, separate planes), NV12 (uv_pixel_stride 2,
+// v = u + 1) and NV21 (uv_pixel_stride 2, u = v + 1).
+typedef struct {
+  const uint8_t* y;
+  const uint8_t* u;
+  const uint8_t* v;
+  // Bytes between Y rows.
+  int32_t y_stride;
+  // Bytes between U (and V) rows.
+  int32_t uv_stride;
+  // Bytes between horizontally adjacent U (and V) samples.
+  int32_t uv_pixel_stride;
+} HandYuv420Image;
+
+// Same as hand_detection_tflite_letterbox_bgr_to_rgb_f32 for a YUV 4:2:0
+// frame. Y, U and V are interpolated separately and converted with BT.601
+// limited range (OpenCV's COLOR_YUV2BGR_{I420,NV12,NV21}) per output pixel,
+// so no full-resolution RGB image is produced.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_letterbox_yuv420_to_rgb_f32(const HandYuv420Image* src,
+                                                  int32_t src_width,
+                                                  int32_t src_height,
+                                                  float* dst,
+                                                  int32_t dst_width,
+                                                  int32_t dst_height,
+                                                  int32_t* info);
+
+// Number of floats per anchor in the palm model box regressor output.
+#define HAND_DETECTION_TFLITE_PALM_BOX_STRIDE 18
+
+// A decoded palm as a rotated square, packed as 5 floats. Center and size are
+// normalized to the source image (size relative to its longer side).
+typedef struct {
+  float score;
+  float sqn_rr_size;
+  float rotation;
+  float sqn_rr_center_x;
+  float sqn_rr_center_y;
+} HandPalmDetection;
+
+// Decodes raw palm detector outputs into rotated palm rectangles.
+//
+// raw_boxes is the [1, num_anchors, 18] regressor tensor, raw_scores the
+// [1, num_anchors, 1] logit tensor and anchors a struct-of-arrays
+// [4, num_anchors] table: every anchor's cx, then cy, w and h. Scores are
+// thresholded in logit space so the sigmoid is only evaluated for survivors,
+// the rotation rectangle is derived from keypoints 0 and 2, coordinates are
+// mapped back from the square letterbox of an image_width x image_height
+// source, and overlapping palms are removed with a 200 px center-distance NMS.
+//
+// Writes up to max_out detections sorted by descending score and returns the
+// number written, or a negative status code.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_decode_palms(const float* raw_boxes,
+                                   const float* raw_scores,
+                                   int32_t num_anchors,
+                                   const float* anchors,
+                                   float score_threshold,
+                                   float input_size,
+                                   int32_t image_width,
+                                   int32_t image_height,
+                                   HandPalmDetection* out,
+                                   int32_t max_out);
+
+// Samples a rotated square crop of a BGR888 image straight into a
+// dst_size x dst_size float32 RGB tensor scaled to [0, 1].
+//
+// Equivalent to ImageUtils.rotateAndCropRectangle (warpAffine of a
+// crop_size x crop_size square centered at (center_x, center_y) and rotated
+// by rotation radians, black border) followed by the keep-aspect resize to
+// dst_size, but without materializing the intermediate crop.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_warp_crop_bgr_to_rgb_f32(const uint8_t* src,
+                                               int32_t src_width,
+                                               int32_t src_height,
+                                               int32_t src_stride,
+                                               float center_x,
+                                               float center_y,
+                                               float rotation,
+                                               int32_t crop_size,
+                                               float* dst,
+                                               int32_t dst_size);
+
+// Same as hand_detection_tflite_warp_crop_bgr_to_rgb_f32 for a YUV 4:2:0
+// frame, converting only the sampled pixels.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_warp_crop_yuv420_to_rgb_f32(const HandYuv420Image* src,
+                                                  int32_t src_width,
+                                                  int32_t src_height,
+                                                  float center_x,
+                                                  float center_y,
+                                                  float rotation,
+                                                  int32_t crop_size,
+                                                  float* dst,
+                                                  int32_t dst_size);
+
+// Maps count landmarks from landmark-model input space back to the source
+// image, undoing hand_detection_tflite_warp_crop_bgr_to_rgb_f32.
+//
+// raw and out hold count * 3 floats (x, y, z). x and y are scaled from
+// input_size to crop_size, clamped to the crop, rotated back about the crop
+// center and clamped to the image; z is copied unchanged. raw and out may
+// alias.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_project_landmarks(const float* raw,
+                                        int32_t count,
+                                        float input_size,
+                                        int32_t crop_size,
+                                        float center_x,
+                                        float center_y,
+                                        float rotation,
+                                        int32_t image_width,
+                                        int32_t image_height,
+                                        float* out);
+
+// Quantized-input variant of hand_detection_tflite_letterbox_bgr_to_rgb_f32:
+// writes dst_width * dst_height * 3 RGB bytes for a uint8 or int8 input
+// tensor, without a float tensor in between.
+//
+// Each interpolated 8-bit pixel value p is stored as lut[p] (see
+// hand_detection_tflite_input_quantization_lut), or as p when lut is null,
+// which is the encoding of a uint8 input with scale 1/255 and zero point 0.
+// Padding is lut[0] (black).
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_letterbox_bgr_to_rgb_u8(const uint8_t* src,
+                                              int32_t src_width,
+                                              int32_t src_height,
+                                              int32_t src_stride,
+                                              uint8_t* dst,
+                                              int32_t dst_width,
+                                              int32_t dst_height,
+                                              const uint8_t* lut,
+                                              int32_t* info);
+
+// Quantized-input variant of hand_detection_tflite_warp_crop_bgr_to_rgb_f32,
+// writing dst_size * dst_size * 3 bytes encoded as in
+// hand_detection_tflite_letterbox_bgr_to_rgb_u8.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_warp_crop_bgr_to_rgb_u8(const uint8_t* src,
+                                              int32_t src_width,
+                                              int32_t src_height,
+                                              int32_t src_stride,
+                                              float center_x,
+                                              float center_y,
+                                              float rotation,
+                                              int32_t crop_size,
+                                              uint8_t* dst,
+                                              int32_t dst_size,
+                                              const uint8_t* lut);
+
+// Fills the 256-entry table mapping an 8-bit pixel value p to the byte a
+// tensor of tensor_type (HAND_DETECTION_TFLITE_TENSOR_UINT8 or _INT8) with
+// the given quantization stores for the normalized value p / 255:
+// clamp(round(p / 255 / scale) + zero_point).
+//
+// Returns 1 when the table is the identity (pixels can be stored unchanged,
+// so callers may pass a null lut to the kernels), 0 otherwise, or a negative
+// status code.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_input_quantization_lut(float scale,
+                                             int32_t zero_point,
+                                             int32_t tensor_type,
+                                             uint8_t* lut);
+
+// Encodes count normalized [0, 1] floats as 8-bit pixels mapped through lut
+// (or stored unchanged when lut is null). Used for inputs that have no
+// direct 8-bit kernel, such as YUV frames.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_quantize_unit_f32(const float* src,
+                                        int32_t count,
+                                        const uint8_t* lut,
+                                        uint8_t* dst);
+
+// Dequantizes count uint8 or int8 values of tensor_type into floats:
+// dst[i] = (src[i] - zero_point) * scale.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_dequantize(const void* src,
+                                 int32_t tensor_type,
+                                 int32_t count,
+                                 float scale,
+                                 int32_t zero_point,
+                                 float* dst);
+
+// A rectangle of source pixels.
+typedef struct {
+  int32_t x;
+  int32_t y;
+  int32_t width;
+  int32_t height;
+} HandTileRect;
+
+// Lays out the palm detection tiles for an image_width x image_height frame:
+// a columns x rows grid of overlapping tiles, each sharing the overlap
+// fraction (in [0, 0.5]) of its size with its neighbours, preceded by the
+// whole frame when include_full_frame is non-zero. Each tile is letterboxed
+// to the palm input on its own, so small hands keep more pixels than in the
+// whole-frame pass, while the whole frame still covers hands larger than a
+// tile.
+//
+// Tiles are never smaller than min_tile_size (typically the palm input size)
+// so no tile is upsampled; a grid axis that would need smaller tiles uses
+// fewer of them. Tile origins are even, so YUV 4:2:0 tiles stay aligned with
+// their chroma samples.
+//
+// Writes the tiles to out and returns their number, or a negative status
+// code when max_out cannot hold columns * rows + 1 tiles.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_palm_tile_grid(int32_t image_width,
+                                     int32_t image_height,
+                                     int32_t columns,
+                                     int32_t rows,
+                                     float overlap,
+                                     int32_t min_tile_size,
+                                     int32_t include_full_frame,
+                                     HandTileRect* out,
+                                     int32_t max_out);
+
+// Maps count palms decoded from a tile (hand_detection_tflite_decode_palms
+// with the tile's width and height) to the coordinates of the
+// image_width x image_height frame the tile was taken from.
+//
+// Palms the tile did not see whole are dropped: a palm is kept when its
+// center lies inside the tile and its rotated square does not cross a tile
+// edge that lies inside the frame, since the overlapping neighbour (or the
+// whole-frame tile) covers those hands. A whole-frame tile keeps every palm.
+// Survivors are compacted to the front of palms; returns their number, or a
+// negative status code.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_map_tile_palms(HandPalmDetection* palms,
+                                     int32_t count,
+                                     const HandTileRect* tile,
+                                     int32_t image_width,
+                                     int32_t image_height);
+
+// Merges palms gathered from several tiles: sorts them by descending score
+// and applies the same 200 px center-distance NMS as
+// hand_detection_tflite_decode_palms, compacting the survivors (at most
+// max_out) to the front of palms. Returns their number, or a negative status
+// code.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_suppress_palms(HandPalmDetection* palms,
+                                     int32_t count,
+                                     int32_t image_width,
+                                     int32_t image_height,
+                                     int32_t max_out);
+
+// Smooths count values in place with the One Euro filter (Casiez et al.,
+// CHI 2012): a first-order low-pass whose cutoff rises with the speed of the
+// value, min_cutoff + beta * |speed| in Hz, so jitter at rest is removed
+// while fast motion keeps little lag. The speed is itself low-passed at
+// derivative_cutoff. With beta 0 this is an exponential moving average with
+// a fixed cutoff.
+//
+// state holds 2 * count floats: the previous filtered values, then their
+// filtered derivatives, and is updated in place. A state of (value, 0)
+// passes the value through unchanged, which is how a new track starts. dt
+// is the time since the previous sample in seconds.
+//
+// Values come in groups of group_size (e.g. one hand's 63 landmark
+// coordinates); speeds in group g are multiplied by scales[g], or 1 when
+// scales is null, so normalizing by object size lets one beta work across
+// image resolutions and hand distances.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_detection_tflite_one_euro_filter(float* values,
+                                      float* state,
+                                      int32_t count,
+                                      int32_t group_size,
+                                      const float* scales,
+                                      float dt,
+                                      float min_cutoff,
+                                      float beta,
+                                      float derivative_cutoff);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // FLUTTER_PLUGIN_HAND_DETECTION_TFLITE_KERNELS_H_
@@ -0,0 +1,238 @@
+#ifndef FLUTTER_PLUGIN_HAND_PIPELINE_H_
+#define FLUTTER_PLUGIN_HAND_PIPELINE_H_
+
+#include <stdint.h>
+
+#include "hand_detection_tflite_kernels.h"
+
+// Native two-stage hand detection pipeline (libhand_pipeline).
+//
+// Runs palm detection, rotated cropping, hand landmark inference and
+// back-projection to image coordinates without Flutter, mirroring the Dart
+// HandDetector. TensorFlow Lite is loaded at runtime (HAND_TFLITE_LIB, then
+// libtensorflowlite_c-linux.so next to this library, then the default search
+// path).
+//
+// A pipeline is not thread-safe; use one per thread. Only
+// hand_pipeline_detect_video runs it on several threads, internally.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bumped whenever a struct layout or function signature below changes.
+#define HAND_PIPELINE_ABI_VERSION 1
+
+#define HAND_PIPELINE_NUM_LANDMARKS 21
+
+// Status codes returned by the pipeline functions.
+#define HAND_PIPELINE_OK 0
+#define HAND_PIPELINE_ERROR_INVALID_ARGUMENT -1
+#define HAND_PIPELINE_ERROR_INFERENCE -2
+
+// Detection modes (HandMode on the Dart side).
+#define HAND_PIPELINE_MODE_BOXES 0
+#define HAND_PIPELINE_MODE_BOXES_AND_LANDMARKS 1
+
+// Handedness values. Unknown is reported in boxes mode.
+#define HAND_PIPELINE_HANDEDNESS_UNKNOWN -1
+#define HAND_PIPELINE_HANDEDNESS_LEFT 0
+#define HAND_PIPELINE_HANDEDNESS_RIGHT 1
+
+typedef struct HandPipeline HandPipeline;
+
+// Pipeline configuration. Initialize with hand_pipeline_options_init before
+// setting fields so that new fields keep their defaults. Fields beyond
+// struct_size (callers built against an older header) take their defaults.
+typedef struct {
+  // sizeof(HandPipelineOptions), set by hand_pipeline_options_init.
+  uint32_t struct_size;
+  // Path to hand_detection.tflite.
+  const char* palm_model_path;
+  // Path to hand_landmark_full.tflite.
+  const char* landmark_model_path;
+  // Interpreter threads; <= 0 keeps the TensorFlow Lite default.
+  int32_t num_threads;
+  // Palm detection confidence threshold. Default: 0.6.
+  float detector_confidence;
+  // Maximum number of hands per frame. Default: 10.
+  int32_t max_detections;
+  // Minimum landmark confidence to keep a hand. Default: 0.5.
+  float min_landmark_score;
+  // HAND_PIPELINE_MODE_*. Default: boxes and landmarks.
+  int32_t mode;
+  // When > 1, hands are processed as independent crop + inference +
+  // back-projection tasks on a work-stealing pool of this many threads, each
+  // with its own landmark interpreter. Otherwise all hands of a frame run as
+  // one batched inference on the calling thread. Default: 0.
+  int32_t num_workers;
+  // Tiled palm detection for high-resolution frames: when the grid has more
+  // than one tile, palms are detected on palm_tile_columns x palm_tile_rows
+  // overlapping tiles (see hand_detection_tflite_palm_tile_grid), run
+  // through the palm model as one batch, and merged with the distance NMS.
+  // Default: 0 x 0 (whole frame only).
+  int32_t palm_tile_columns;
+  int32_t palm_tile_rows;
+  // Fraction of a tile shared with each neighbour, in [0, 0.5].
+  // Default: 0.25.
+  float palm_tile_overlap;
+  // Non-zero to also detect on the whole frame, for hands larger than a
+  // tile. Default: 1.
+  int32_t palm_tile_full_frame;
+} HandPipelineOptions;
+
+// One detected hand. Coordinates are source image pixels.
+typedef struct {
+  // Palm detection confidence.
+  float score;
+  // Axis-aligned bounding box of the rotated square, clamped to the image.
+  float left;
+  float top;
+  float right;
+  float bottom;
+  // Rotated square used for landmark cropping.
+  float rotation;
+  float center_x;
+  float center_y;
+  float size;
+  // HAND_PIPELINE_HANDEDNESS_*.
+  int32_t handedness;
+  // Landmark model confidence, 0 in boxes mode.
+  float landmark_score;
+  // HAND_PIPELINE_NUM_LANDMARKS (x, y, z) triples, zero in boxes mode.
+  float landmarks[HAND_PIPELINE_NUM_LANDMARKS * 3];
+} HandPipelineHand;
+
+HAND_DETECTION_TFLITE_EXPORT int32_t hand_pipeline_abi_version(void);
+
+// Fills options with defaults.
+HAND_DETECTION_TFLITE_EXPORT void hand_pipeline_options_init(
+    HandPipelineOptions* options);
+
+// Loads both models. Returns null on failure; see hand_pipeline_last_error.
+HAND_DETECTION_TFLITE_EXPORT HandPipeline* hand_pipeline_create(
+    const HandPipelineOptions* options);
+
+// Detects hands in a BGR888 image with src_stride bytes per row.
+//
+// Writes up to max_out hands sorted by descending palm score and returns the
+// number written, or a negative status code.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_pipeline_detect(HandPipeline* pipeline,
+                     const uint8_t* bgr,
+                     int32_t width,
+                     int32_t height,
+                     int32_t src_stride,
+                     HandPipelineHand* out,
+                     int32_t max_out);
+
+// Same as hand_pipeline_detect for a YUV 4:2:0 frame (I420, NV12 or NV21;
+// see HandYuv420Image). The planes are sampled directly while building the
+// model inputs; no full-resolution BGR image is created.
+HAND_DETECTION_TFLITE_EXPORT int32_t
+hand_pipeline_detect_yuv420(HandPipeline* pipeline,
+                            const HandYuv420Image* image,
+                            int32_t width,
+                            int32_t height,
+                            HandPipelineHand* out,
+                            int32_t max_out);
+
+// Pipelined video processing.
+//
+// hand_pipeline_detect_video runs three stages on different frames at once:
+// a decode thread fills a bounded ring of frame buffers through a read
+// callback, a palm thread detects palms on the oldest decoded frame, and
+// the calling thread runs the landmark stage and reports each frame's hands
+// in order. With num_workers > 1 the palm tiles and hands of a frame still
+// fan out over the worker pool. The library has no video decoder: the read
+// callback supplies decoded BGR frames, e.g. from OpenCV VideoCapture or a
+// raw ffmpeg pipe (see hand_detect --video).
+
+// Video stream configuration. Initialize with hand_video_options_init;
+// fields beyond struct_size take their defaults.
+typedef struct {
+  // sizeof(HandVideoOptions), set by hand_video_options_init.
+  uint32_t struct_size;
+  // Size of every frame in pixels.
+  int32_t width;
+  int32_t height;
+  // Frame buffers in the ring shared by the three stages: up to this many
+  // frames are decoded ahead of the one being reported. Default: 4.
+  int32_t queue_depth;
+} HandVideoOptions;
+
+// Writes the next frame into bgr (height rows of width * 3 bytes) and its
+// presentation time into *timestamp_us. Returns 1 for a frame, 0 at the end
+// of the stream and a negative value on a decode error. Called on the
+// decode thread.
+typedef int32_t (*HandVideoReadFn)(void* user_data, uint8_t* bgr,
+                                   int64_t* timestamp_us);
+
+// Receives the hands of one frame, in frame order, on the thread that called
+// hand_pipeline_detect_video. hands is only valid during the call. Return
+// non-zero to stop the stream.
+typedef int32_t (*HandVideoResultFn)(void* user_data,
+                                     int64_t frame_index,
+                                     int64_t timestamp_us,
+                                     const HandPipelineHand* hands,
+                                     int32_t count);
+
+// Fills options with defaults.
+HAND_DETECTION_TFLITE_EXPORT void hand_video_options_init(
+    HandVideoOptions* options);
+
+// Detects hands in every frame read from read_frame until the end of the
+// stream, on_result stops it, or an error occurs. Up to max_detections
+// hands per frame are reported. Blocks until all stage threads have
+// finished.
+//
+// Returns the number of frames reported, or a negative status code (a read
+// error is HAND_PIPELINE_ERROR_INVALID_ARGUMENT).
+HAND_DETECTION_TFLITE_EXPORT int64_t
+hand_pipeline_detect_video(HandPipeline* pipeline,
+                           const HandVideoOptions* options,
+                           HandVideoReadFn read_frame,
+                           HandVideoResultFn on_result,
+                           void* user_data);
+
+HAND_DETECTION_TFLITE_EXPORT void hand_pipeline_destroy(
+    HandPipeline* pipeline);
+
+// Shared models.
+//
+// Pipelines never load the same .tflite file twice: each file is mapped
+// read-only once per process and every interpreter built from it, in any
+// pipeline, references that one mapping. The functions below expose the same
+// registry to other TensorFlow Lite users in the process (the Dart
+// interpreters), so all of them share the weights.
+
+typedef struct HandModel HandModel;
+
+// Returns a reference to the shared model for path, mapping the file on
+// first use. Returns null on failure; see hand_pipeline_last_error.
+HAND_DETECTION_TFLITE_EXPORT HandModel* hand_model_acquire(const char* path);
+
+// Drops a reference from hand_model_acquire. The file is unmapped with the
+// last reference, so interpreters created from the model must be deleted
+// first.
+HAND_DETECTION_TFLITE_EXPORT void hand_model_release(HandModel* model);
+
+// Creates a TfLiteInterpreter for the model with TfLiteInterpreterOptions
+// (may be null). The options must come from the same TensorFlow Lite library
+// this one loads. The caller owns the interpreter and deletes it with
+// TfLiteInterpreterDelete. Returns null on failure.
+HAND_DETECTION_TFLITE_EXPORT void* hand_model_create_interpreter(
+    HandModel* model,
+    const void* options);
+
+// Number of distinct model files currently mapped.
+HAND_DETECTION_TFLITE_EXPORT int32_t hand_model_live_count(void);
+
+// Message for the last failure on the calling thread, or "" if none.
+HAND_DETECTION_TFLITE_EXPORT const char* hand_pipeline_last_error(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // FLUTTER_PLUGIN_HAND_PIPELINE_H_
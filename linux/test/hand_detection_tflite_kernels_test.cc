@@ -0,0 +1,548 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "include/hand_detection_tflite/hand_detection_tflite_kernels.h"
+
+namespace hand_detection_tflite {
+namespace test {
+
+TEST(HandDetectionTfliteKernels, LetterboxRejectsInvalidArguments) {
+  std::vector<uint8_t> src(4 * 4 * 3, 0);
+  std::vector<float> dst(8 * 8 * 3, 0.0f);
+  EXPECT_EQ(hand_detection_tflite_letterbox_bgr_to_rgb_f32(
+                nullptr, 4, 4, 12, dst.data(), 8, 8, nullptr),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(hand_detection_tflite_letterbox_bgr_to_rgb_f32(
+                src.data(), 4, 4, 6, dst.data(), 8, 8, nullptr),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(HandDetectionTfliteKernels, LetterboxPadsPortraitAndSwapsChannels) {
+  // 4 wide x 8 tall, solid B=255 G=128 R=0.
+  const int w = 4;
+  const int h = 8;
+  std::vector<uint8_t> src(w * h * 3);
+  for (int i = 0; i < w * h; ++i) {
+    src[i * 3 + 0] = 255;
+    src[i * 3 + 1] = 128;
+    src[i * 3 + 2] = 0;
+  }
+  const int out = 16;
+  std::vector<float> dst(out * out * 3, -1.0f);
+  int32_t info[4] = {0, 0, 0, 0};
+  ASSERT_EQ(hand_detection_tflite_letterbox_bgr_to_rgb_f32(
+                src.data(), w, h, w * 3, dst.data(), out, out, info),
+            HAND_DETECTION_TFLITE_OK);
+
+  EXPECT_EQ(info[0], 8);
+  EXPECT_EQ(info[1], 16);
+  EXPECT_EQ(info[2], 4);
+  EXPECT_EQ(info[3], 0);
+
+  for (int y = 0; y < out; ++y) {
+    for (int x = 0; x < out; ++x) {
+      const float* px = &dst[(y * out + x) * 3];
+      if (x < 4 || x >= 12) {
+        EXPECT_FLOAT_EQ(px[0], 0.0f);
+        EXPECT_FLOAT_EQ(px[1], 0.0f);
+        EXPECT_FLOAT_EQ(px[2], 0.0f);
+      } else {
+        EXPECT_NEAR(px[0], 0.0f, 1e-6f);
+        EXPECT_NEAR(px[1], 128.0f / 255.0f, 1e-6f);
+        EXPECT_NEAR(px[2], 1.0f, 1e-6f);
+      }
+    }
+  }
+}
+
+TEST(HandDetectionTfliteKernels, LetterboxInterpolatesBilinearly) {
+  // Horizontal ramp 0..255 across 2 pixels, upscaled 2x with no padding.
+  std::vector<uint8_t> src = {0, 0, 0, 255, 255, 255};
+  std::vector<float> dst(4 * 2 * 3, 0.0f);
+  ASSERT_EQ(hand_detection_tflite_letterbox_bgr_to_rgb_f32(
+                src.data(), 2, 1, 6, dst.data(), 4, 2, nullptr),
+            HAND_DETECTION_TFLITE_OK);
+  // OpenCV INTER_LINEAR: dst x=1 maps to src 0.25, x=2 maps to 0.75.
+  EXPECT_NEAR(dst[0], 0.0f, 1e-6f);
+  EXPECT_NEAR(dst[3], 0.25f, 1e-6f);
+  EXPECT_NEAR(dst[6], 0.75f, 1e-6f);
+  EXPECT_NEAR(dst[9], 1.0f, 1e-6f);
+  // Second row duplicates the first (single source row).
+  for (int i = 0; i < 12; ++i) {
+    EXPECT_FLOAT_EQ(dst[12 + i], dst[i]);
+  }
+}
+
+// Fills one anchor's regressor with a box of size (w, h) and keypoints 0/2
+// placed vertically below/above the center, i.e. an upright hand.
+void SetUprightBox(std::vector<float>* boxes, int index, float w, float h) {
+  float* box = boxes->data() + index * HAND_DETECTION_TFLITE_PALM_BOX_STRIDE;
+  box[2] = w;
+  box[3] = h;
+  box[5] = 19.2f;   // kp0 y: +0.1
+  box[9] = -19.2f;  // kp2 y: -0.1
+}
+
+TEST(HandDetectionTfliteKernels, DecodePalmsThresholdsRotatesAndSuppresses) {
+  const int n = 5;
+  std::vector<float> boxes(n * HAND_DETECTION_TFLITE_PALM_BOX_STRIDE, 0.0f);
+  std::vector<float> scores = {2.0f, 1.0f, -1.0f, -5.0f, 3.0f};
+  // Struct-of-arrays: cx, cy, w, h rows.
+  std::vector<float> anchors = {0.5f, 0.5f, 0.5f, 0.5f, 0.1f,  //
+                                0.5f, 0.5f, 0.5f, 0.5f, 0.1f,  //
+                                1.0f, 1.0f, 1.0f, 1.0f, 1.0f,  //
+                                1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+  for (int i = 0; i < n; ++i) SetUprightBox(&boxes, i, 19.2f, 9.6f);
+
+  std::vector<HandPalmDetection> out(n);
+  const int32_t count = hand_detection_tflite_decode_palms(
+      boxes.data(), scores.data(), n, anchors.data(), 0.5f, 192.0f, 400, 400,
+      out.data(), n);
+
+  // Anchor 1 is suppressed by anchor 0, anchors 2 and 3 fall below 0.5.
+  ASSERT_EQ(count, 2);
+
+  EXPECT_NEAR(out[0].score, 1.0f / (1.0f + std::exp(-3.0f)), 1e-6f);
+  EXPECT_NEAR(out[0].sqn_rr_center_x, 0.1f, 1e-6f);
+  EXPECT_NEAR(out[0].sqn_rr_center_y, 0.05f, 1e-6f);
+
+  EXPECT_NEAR(out[1].score, 1.0f / (1.0f + std::exp(-2.0f)), 1e-6f);
+  EXPECT_NEAR(out[1].rotation, 0.0f, 1e-6f);
+  EXPECT_NEAR(out[1].sqn_rr_size, 0.29f, 1e-6f);
+  EXPECT_NEAR(out[1].sqn_rr_center_x, 0.5f, 1e-6f);
+  EXPECT_NEAR(out[1].sqn_rr_center_y, 0.45f, 1e-6f);
+}
+
+TEST(HandDetectionTfliteKernels, DecodePalmsUndoesLetterboxPadding) {
+  std::vector<float> boxes(HAND_DETECTION_TFLITE_PALM_BOX_STRIDE, 0.0f);
+  std::vector<float> scores = {4.0f};
+  std::vector<float> anchors = {0.5f, 0.5f, 1.0f, 1.0f};
+  SetUprightBox(&boxes, 0, 19.2f, 19.2f);
+
+  HandPalmDetection out;
+  // Landscape 800x400: 200 px of padding above and below.
+  ASSERT_EQ(hand_detection_tflite_decode_palms(boxes.data(), scores.data(), 1,
+                                               anchors.data(), 0.5f, 192.0f,
+                                               800, 400, &out, 1),
+            1);
+  EXPECT_NEAR(out.sqn_rr_center_x, 0.5f, 1e-6f);
+  EXPECT_NEAR(out.sqn_rr_center_y, (0.45f * 800.0f - 200.0f) / 400.0f, 1e-5f);
+}
+
+TEST(HandDetectionTfliteKernels, PalmTileGridCoversFrameWithOverlap) {
+  HandTileRect tiles[7];
+  ASSERT_EQ(hand_detection_tflite_palm_tile_grid(3840, 2160, 3, 2, 0.25f, 192,
+                                                 1, tiles, 7),
+            7);
+  EXPECT_EQ(tiles[0].x, 0);
+  EXPECT_EQ(tiles[0].width, 3840);
+  EXPECT_EQ(tiles[0].height, 2160);
+  // 3840 / (3 - 2 * 0.25) and 2160 / (2 - 0.25), spread edge to edge.
+  const int32_t xs[3] = {0, 1152, 2304};
+  for (int c = 0; c < 3; ++c) {
+    EXPECT_EQ(tiles[1 + c].x, xs[c]);
+    EXPECT_EQ(tiles[1 + c].y, 0);
+    EXPECT_EQ(tiles[1 + c].width, 1536);
+    EXPECT_EQ(tiles[1 + c].height, 1234);
+    EXPECT_EQ(tiles[4 + c].y, 926);
+    EXPECT_EQ(tiles[4 + c].height, 2160 - 926);
+  }
+
+  // Odd origins are rounded down to even; the last tile reaches the edge.
+  ASSERT_EQ(hand_detection_tflite_palm_tile_grid(640, 480, 2, 1, 0.5f, 192, 0,
+                                                 tiles, 7),
+            2);
+  EXPECT_EQ(tiles[0].width, 427);
+  EXPECT_EQ(tiles[1].x, 212);
+  EXPECT_EQ(tiles[1].width, 428);
+  EXPECT_EQ(tiles[1].height, 480);
+
+  // Tiles would be smaller than the palm input: only the whole frame.
+  ASSERT_EQ(hand_detection_tflite_palm_tile_grid(300, 200, 3, 2, 0.25f, 192,
+                                                 0, tiles, 7),
+            1);
+  EXPECT_EQ(tiles[0].width, 300);
+  EXPECT_EQ(tiles[0].height, 200);
+
+  EXPECT_EQ(hand_detection_tflite_palm_tile_grid(3840, 2160, 3, 2, 0.25f, 192,
+                                                 1, tiles, 6),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(hand_detection_tflite_palm_tile_grid(3840, 2160, 3, 2, 0.6f, 192,
+                                                 1, tiles, 7),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(HandDetectionTfliteKernels, MapTilePalmsKeepsHandsSeenWhole) {
+  auto palm = [](float score, float x, float y, float size) {
+    HandPalmDetection p = {score, size, 0.0f, x, y};
+    return p;
+  };
+
+  // Interior tile of a 400x200 frame: all four edges can cut hands.
+  const HandTileRect inner = {100, 50, 200, 100};
+  std::vector<HandPalmDetection> palms = {
+      palm(0.9f, 0.5f, 0.5f, 0.5f),  // 100 px square touching the edges
+      palm(0.8f, 0.1f, 0.5f, 0.5f),  // crosses the left edge
+      palm(0.7f, 0.5f, 1.2f, 0.1f),  // center below the tile
+  };
+  ASSERT_EQ(hand_detection_tflite_map_tile_palms(palms.data(), 3, &inner, 400,
+                                                 200),
+            1);
+  EXPECT_FLOAT_EQ(palms[0].score, 0.9f);
+  EXPECT_FLOAT_EQ(palms[0].sqn_rr_center_x, 0.5f);
+  EXPECT_FLOAT_EQ(palms[0].sqn_rr_center_y, 0.5f);
+  EXPECT_FLOAT_EQ(palms[0].sqn_rr_size, 0.25f);
+
+  // Corner tile: squares may leave the tile through the frame border.
+  const HandTileRect corner = {0, 0, 200, 100};
+  palms = {palm(0.9f, 0.05f, 0.5f, 0.5f), palm(0.8f, 0.9f, 0.5f, 0.5f)};
+  ASSERT_EQ(hand_detection_tflite_map_tile_palms(palms.data(), 2, &corner,
+                                                 400, 200),
+            1);
+  EXPECT_FLOAT_EQ(palms[0].sqn_rr_center_x, 10.0f / 400.0f);
+
+  // The whole frame keeps everything.
+  const HandTileRect frame = {0, 0, 400, 200};
+  palms = {palm(0.9f, 1.5f, 0.5f, 0.5f)};
+  EXPECT_EQ(hand_detection_tflite_map_tile_palms(palms.data(), 1, &frame, 400,
+                                                 200),
+            1);
+  EXPECT_FLOAT_EQ(palms[0].sqn_rr_center_x, 1.5f);
+}
+
+TEST(HandDetectionTfliteKernels, SuppressPalmsMergesAcrossTiles) {
+  std::vector<HandPalmDetection> palms = {
+      {0.6f, 0.1f, 0.0f, 0.50f, 0.5f},
+      {0.9f, 0.1f, 0.0f, 0.55f, 0.5f},  // 50 px from the first
+      {0.7f, 0.1f, 0.0f, 0.10f, 0.1f},
+  };
+  ASSERT_EQ(hand_detection_tflite_suppress_palms(palms.data(), 3, 1000, 1000,
+                                                 10),
+            2);
+  EXPECT_FLOAT_EQ(palms[0].score, 0.9f);
+  EXPECT_FLOAT_EQ(palms[1].score, 0.7f);
+  EXPECT_EQ(hand_detection_tflite_suppress_palms(palms.data(), 2, 1000, 1000,
+                                                 1),
+            1);
+  EXPECT_EQ(hand_detection_tflite_suppress_palms(nullptr, 1, 1000, 1000, 1),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(HandDetectionTfliteKernels, WarpCropSamplesUprightAndRotatedSquares) {
+  // 8x8 image whose B channel encodes x and G channel encodes y.
+  const int w = 8;
+  std::vector<uint8_t> src(w * w * 3, 0);
+  for (int y = 0; y < w; ++y) {
+    for (int x = 0; x < w; ++x) {
+      src[(y * w + x) * 3 + 0] = static_cast<uint8_t>(x * 10);
+      src[(y * w + x) * 3 + 1] = static_cast<uint8_t>(y * 10);
+    }
+  }
+
+  std::vector<float> dst(4 * 4 * 3, -1.0f);
+  ASSERT_EQ(hand_detection_tflite_warp_crop_bgr_to_rgb_f32(
+                src.data(), w, w, w * 3, 4.0f, 4.0f, 0.0f, 4, dst.data(), 4),
+            HAND_DETECTION_TFLITE_OK);
+  // Unrotated, crop pixel (x, y) is source pixel (x + 2, y + 2).
+  for (int y = 0; y < 4; ++y) {
+    for (int x = 0; x < 4; ++x) {
+      const float* px = &dst[(y * 4 + x) * 3];
+      EXPECT_NEAR(px[2], (x + 2) * 10 / 255.0f, 1e-5f);
+      EXPECT_NEAR(px[1], (y + 2) * 10 / 255.0f, 1e-5f);
+      EXPECT_FLOAT_EQ(px[0], 0.0f);
+    }
+  }
+
+  // Rotated by 90 degrees, crop +x walks along source +y.
+  ASSERT_EQ(hand_detection_tflite_warp_crop_bgr_to_rgb_f32(
+                src.data(), w, w, w * 3, 4.0f, 4.0f,
+                static_cast<float>(M_PI / 2), 4, dst.data(), 4),
+            HAND_DETECTION_TFLITE_OK);
+  EXPECT_NEAR(dst[(0 * 4 + 3) * 3 + 1], 5 * 10 / 255.0f, 1e-4f);
+  EXPECT_NEAR(dst[(0 * 4 + 3) * 3 + 2], 6 * 10 / 255.0f, 1e-4f);
+
+  // Samples outside the image are black.
+  ASSERT_EQ(hand_detection_tflite_warp_crop_bgr_to_rgb_f32(
+                src.data(), w, w, w * 3, 0.0f, 0.0f, 0.0f, 4, dst.data(), 4),
+            HAND_DETECTION_TFLITE_OK);
+  EXPECT_FLOAT_EQ(dst[0], 0.0f);
+  EXPECT_FLOAT_EQ(dst[1], 0.0f);
+}
+
+TEST(HandDetectionTfliteKernels, ProjectLandmarksRotatesBackAndClamps) {
+  std::vector<float> raw = {112.0f, 112.0f, 1.5f,  //
+                            224.0f, 112.0f, -2.0f};
+  std::vector<float> out(raw.size(), 0.0f);
+  ASSERT_EQ(hand_detection_tflite_project_landmarks(
+                raw.data(), 2, 224.0f, 100, 50.0f, 50.0f,
+                static_cast<float>(M_PI / 2), 200, 80, out.data()),
+            HAND_DETECTION_TFLITE_OK);
+  EXPECT_NEAR(out[0], 50.0f, 1e-4f);
+  EXPECT_NEAR(out[1], 50.0f, 1e-4f);
+  EXPECT_FLOAT_EQ(out[2], 1.5f);
+  // Crop +x maps to image +y, then clamps to the 80 px image height.
+  EXPECT_NEAR(out[3], 50.0f, 1e-4f);
+  EXPECT_FLOAT_EQ(out[4], 80.0f);
+  EXPECT_FLOAT_EQ(out[5], -2.0f);
+}
+
+namespace {
+
+// Reference BT.601 limited-range conversion, rounded like OpenCV.
+uint8_t ClampByte(float v) {
+  return static_cast<uint8_t>(std::min(std::max(std::lround(v), 0L), 255L));
+}
+
+void YuvPixelToBgr(int y, int u, int v, uint8_t* bgr) {
+  const float c = (y - 16) * 1.164f;
+  bgr[0] = ClampByte(c + 2.018f * (u - 128));
+  bgr[1] = ClampByte(c - 0.813f * (v - 128) - 0.391f * (u - 128));
+  bgr[2] = ClampByte(c + 1.596f * (v - 128));
+}
+
+}  // namespace
+
+TEST(HandDetectionTfliteKernels, YuvKernelsRejectInvalidArguments) {
+  std::vector<uint8_t> plane(64, 128);
+  std::vector<float> dst(4 * 4 * 3);
+  HandYuv420Image image = {plane.data(), plane.data(), plane.data(), 4, 2, 1};
+  EXPECT_EQ(hand_detection_tflite_letterbox_yuv420_to_rgb_f32(
+                nullptr, 4, 4, dst.data(), 4, 4, nullptr),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+  image.y_stride = 3;
+  EXPECT_EQ(hand_detection_tflite_letterbox_yuv420_to_rgb_f32(
+                &image, 4, 4, dst.data(), 4, 4, nullptr),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+  image.y_stride = 4;
+  image.uv_pixel_stride = 2;
+  EXPECT_EQ(hand_detection_tflite_warp_crop_yuv420_to_rgb_f32(
+                &image, 4, 4, 2.0f, 2.0f, 0.0f, 4, dst.data(), 4),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(HandDetectionTfliteKernels, YuvKernelsMatchConvertedBgr) {
+  // 12x8 frame: luma gradient and constant chroma that stay inside the RGB
+  // gamut, so the reference BGR image differs from direct YUV sampling only
+  // by rounding.
+  const int w = 12;
+  const int h = 8;
+  const int cw = w / 2;
+  const int ch = h / 2;
+  const int u = 120;
+  const int v = 136;
+  std::vector<uint8_t> luma(w * h);
+  std::vector<uint8_t> bgr(w * h * 3);
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      luma[y * w + x] = static_cast<uint8_t>(40 + x * 10 + y * 5);
+      YuvPixelToBgr(luma[y * w + x], u, v, &bgr[(y * w + x) * 3]);
+    }
+  }
+  std::vector<uint8_t> u_plane(cw * ch, u);
+  std::vector<uint8_t> v_plane(cw * ch, v);
+  std::vector<uint8_t> uv_interleaved(cw * ch * 2);
+  for (int i = 0; i < cw * ch; ++i) {
+    uv_interleaved[i * 2] = u;
+    uv_interleaved[i * 2 + 1] = v;
+  }
+  const HandYuv420Image i420 = {luma.data(), u_plane.data(), v_plane.data(),
+                                w, cw, 1};
+  const HandYuv420Image nv12 = {luma.data(), uv_interleaved.data(),
+                                uv_interleaved.data() + 1, w, w, 2};
+
+  const float tolerance = 1.5f / 255.0f;
+  std::vector<float> expected(16 * 16 * 3);
+  std::vector<float> actual(16 * 16 * 3);
+  std::vector<float> actual_nv12(16 * 16 * 3);
+  int32_t info[4];
+  ASSERT_EQ(hand_detection_tflite_letterbox_bgr_to_rgb_f32(
+                bgr.data(), w, h, w * 3, expected.data(), 16, 16, nullptr),
+            HAND_DETECTION_TFLITE_OK);
+  ASSERT_EQ(hand_detection_tflite_letterbox_yuv420_to_rgb_f32(
+                &i420, w, h, actual.data(), 16, 16, info),
+            HAND_DETECTION_TFLITE_OK);
+  ASSERT_EQ(hand_detection_tflite_letterbox_yuv420_to_rgb_f32(
+                &nv12, w, h, actual_nv12.data(), 16, 16, nullptr),
+            HAND_DETECTION_TFLITE_OK);
+  EXPECT_EQ(info[0], 16);
+  EXPECT_EQ(info[1], 10);
+  EXPECT_EQ(info[3], 3);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(actual[i], expected[i], tolerance) << i;
+    EXPECT_FLOAT_EQ(actual_nv12[i], actual[i]) << i;
+  }
+
+  // Rotated crop reaching past the frame edge, so the black border blends in.
+  std::vector<float> warp_expected(8 * 8 * 3);
+  std::vector<float> warp_actual(8 * 8 * 3);
+  ASSERT_EQ(hand_detection_tflite_warp_crop_bgr_to_rgb_f32(
+                bgr.data(), w, h, w * 3, 8.0f, 5.0f, 0.4f, 9,
+                warp_expected.data(), 8),
+            HAND_DETECTION_TFLITE_OK);
+  ASSERT_EQ(hand_detection_tflite_warp_crop_yuv420_to_rgb_f32(
+                &nv12, w, h, 8.0f, 5.0f, 0.4f, 9, warp_actual.data(), 8),
+            HAND_DETECTION_TFLITE_OK);
+  for (size_t i = 0; i < warp_expected.size(); ++i) {
+    EXPECT_NEAR(warp_actual[i], warp_expected[i], tolerance) << i;
+  }
+}
+
+// Pseudo-random BGR image for comparing kernel variants.
+std::vector<uint8_t> NoiseImage(int w, int h) {
+  std::vector<uint8_t> img(w * h * 3);
+  uint32_t state = 12345;
+  for (uint8_t& v : img) {
+    state = state * 1664525u + 1013904223u;
+    v = static_cast<uint8_t>(state >> 24);
+  }
+  return img;
+}
+
+TEST(HandDetectionTfliteKernels, QuantizedKernelsMatchFloatKernels) {
+  const int w = 37;
+  const int h = 23;
+  const std::vector<uint8_t> src = NoiseImage(w, h);
+
+  const int out = 32;
+  std::vector<float> f32(out * out * 3);
+  std::vector<uint8_t> u8(out * out * 3, 7);
+  int32_t info_f[4];
+  int32_t info_u[4];
+  ASSERT_EQ(hand_detection_tflite_letterbox_bgr_to_rgb_f32(
+                src.data(), w, h, w * 3, f32.data(), out, out, info_f),
+            HAND_DETECTION_TFLITE_OK);
+  ASSERT_EQ(hand_detection_tflite_letterbox_bgr_to_rgb_u8(
+                src.data(), w, h, w * 3, u8.data(), out, out, nullptr,
+                info_u),
+            HAND_DETECTION_TFLITE_OK);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(info_u[i], info_f[i]);
+  for (size_t i = 0; i < f32.size(); ++i) {
+    ASSERT_NEAR(u8[i], f32[i] * 255.0f, 0.51f) << "letterbox " << i;
+  }
+
+  ASSERT_EQ(hand_detection_tflite_warp_crop_bgr_to_rgb_f32(
+                src.data(), w, h, w * 3, 18.0f, 11.0f, 0.7f, 30, f32.data(),
+                out),
+            HAND_DETECTION_TFLITE_OK);
+  ASSERT_EQ(hand_detection_tflite_warp_crop_bgr_to_rgb_u8(
+                src.data(), w, h, w * 3, 18.0f, 11.0f, 0.7f, 30, u8.data(),
+                out, nullptr),
+            HAND_DETECTION_TFLITE_OK);
+  for (size_t i = 0; i < f32.size(); ++i) {
+    ASSERT_NEAR(u8[i], f32[i] * 255.0f, 0.51f) << "warp " << i;
+  }
+}
+
+TEST(HandDetectionTfliteKernels, InputQuantizationLut) {
+  uint8_t lut[256];
+  // uint8 in [0, 1]: pixels are stored unchanged.
+  EXPECT_EQ(hand_detection_tflite_input_quantization_lut(
+                1.0f / 255.0f, 0, HAND_DETECTION_TFLITE_TENSOR_UINT8, lut),
+            1);
+
+  // int8 in [0, 1]: pixels shift by the -128 zero point.
+  EXPECT_EQ(hand_detection_tflite_input_quantization_lut(
+                1.0f / 255.0f, -128, HAND_DETECTION_TFLITE_TENSOR_INT8, lut),
+            0);
+  EXPECT_EQ(static_cast<int8_t>(lut[0]), -128);
+  EXPECT_EQ(static_cast<int8_t>(lut[128]), 0);
+  EXPECT_EQ(static_cast<int8_t>(lut[255]), 127);
+
+  // Black padding is lut[0], not byte 0.
+  const std::vector<uint8_t> src(2 * 4 * 3, 255);
+  std::vector<uint8_t> dst(4 * 4 * 3);
+  ASSERT_EQ(hand_detection_tflite_letterbox_bgr_to_rgb_u8(
+                src.data(), 2, 4, 6, dst.data(), 4, 4, lut, nullptr),
+            HAND_DETECTION_TFLITE_OK);
+  EXPECT_EQ(static_cast<int8_t>(dst[0]), -128);
+  EXPECT_EQ(static_cast<int8_t>(dst[3 * 1]), 127);
+
+  EXPECT_EQ(hand_detection_tflite_input_quantization_lut(
+                0.0f, 0, HAND_DETECTION_TFLITE_TENSOR_UINT8, lut),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(hand_detection_tflite_input_quantization_lut(
+                1.0f, 0, HAND_DETECTION_TFLITE_TENSOR_FLOAT32, lut),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(HandDetectionTfliteKernels, DequantizeUint8AndInt8) {
+  const uint8_t u[3] = {0, 10, 255};
+  float out[3];
+  ASSERT_EQ(hand_detection_tflite_dequantize(
+                u, HAND_DETECTION_TFLITE_TENSOR_UINT8, 3, 0.5f, 10, out),
+            HAND_DETECTION_TFLITE_OK);
+  EXPECT_FLOAT_EQ(out[0], -5.0f);
+  EXPECT_FLOAT_EQ(out[1], 0.0f);
+  EXPECT_FLOAT_EQ(out[2], 122.5f);
+
+  const int8_t s[3] = {-128, 0, 127};
+  ASSERT_EQ(hand_detection_tflite_dequantize(
+                s, HAND_DETECTION_TFLITE_TENSOR_INT8, 3, 0.25f, -128, out),
+            HAND_DETECTION_TFLITE_OK);
+  EXPECT_FLOAT_EQ(out[0], 0.0f);
+  EXPECT_FLOAT_EQ(out[1], 32.0f);
+  EXPECT_FLOAT_EQ(out[2], 63.75f);
+
+  EXPECT_EQ(hand_detection_tflite_dequantize(
+                u, HAND_DETECTION_TFLITE_TENSOR_FLOAT32, 3, 1.0f, 0, out),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(HandDetectionTfliteKernels, OneEuroFilterSmoothsJitterAndTracksMotion) {
+  // Two groups of one value: a jittering one at rest and a fast-moving one
+  // whose speed scale is 0 (a fixed-cutoff EMA).
+  const float dt = 1.0f / 30.0f;
+  float state[4] = {100.0f, 50.0f, 0.0f, 0.0f};
+  const float scales[2] = {1.0f, 0.0f};
+  float max_jitter = 0.0f;
+  for (int32_t frame = 1; frame <= 30; ++frame) {
+    float values[2] = {frame % 2 == 0 ? 102.0f : 98.0f, 50.0f + 20.0f * frame};
+    ASSERT_EQ(hand_detection_tflite_one_euro_filter(values, state, 2, 1, scales,
+                                                    dt, 1.0f, 0.1f, 1.0f),
+              HAND_DETECTION_TFLITE_OK);
+    EXPECT_FLOAT_EQ(values[0], state[0]);
+    if (frame > 10) {
+      max_jitter = std::max(max_jitter, std::fabs(values[0] - 100.0f));
+    }
+    // A low fixed cutoff lags a steady motion.
+    EXPECT_LT(values[1], 50.0f + 20.0f * frame);
+  }
+  EXPECT_LT(max_jitter, 1.0f);
+
+  // With beta the cutoff rises with speed, so the same motion lags less.
+  float fast[2] = {50.0f, 0.0f};
+  float slow[2] = {50.0f, 0.0f};
+  for (int32_t frame = 1; frame <= 30; ++frame) {
+    float a = 50.0f + 20.0f * frame;
+    float b = a;
+    ASSERT_EQ(hand_detection_tflite_one_euro_filter(&a, fast, 1, 1, nullptr,
+                                                    dt, 1.0f, 0.5f, 1.0f),
+              HAND_DETECTION_TFLITE_OK);
+    ASSERT_EQ(hand_detection_tflite_one_euro_filter(&b, slow, 1, 1, nullptr,
+                                                    dt, 1.0f, 0.0f, 1.0f),
+              HAND_DETECTION_TFLITE_OK);
+    EXPECT_GT(a, b);
+  }
+
+  // A (value, 0) state passes the value through.
+  float start[2] = {7.0f, 0.0f};
+  float value = 7.0f;
+  ASSERT_EQ(hand_detection_tflite_one_euro_filter(&value, start, 1, 1, nullptr,
+                                                  dt, 1.0f, 0.5f, 1.0f),
+            HAND_DETECTION_TFLITE_OK);
+  EXPECT_FLOAT_EQ(value, 7.0f);
+
+  EXPECT_EQ(hand_detection_tflite_one_euro_filter(&value, start, 1, 1, nullptr,
+                                                  0.0f, 1.0f, 0.5f, 1.0f),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(hand_detection_tflite_one_euro_filter(&value, start, 1, 0, nullptr,
+                                                  dt, 1.0f, 0.5f, 1.0f),
+            HAND_DETECTION_TFLITE_ERROR_INVALID_ARGUMENT);
+}
+
+}  // namespace test
+}  // namespace hand_detection_tflite
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "hand_image_io.h"
+
+namespace hand_detection_tflite {
+namespace test {
+
+namespace {
+
+std::string SamplePath(const char* name) {
+  return std::string(HAND_PIPELINE_TEST_ASSETS_DIR) + "/samples/" + name;
+}
+
+}  // namespace
+
+TEST(HandImageIo, RecognizesImageExtensions) {
+  EXPECT_TRUE(IsSupportedImagePath("a/b.jpg"));
+  EXPECT_TRUE(IsSupportedImagePath("b.JPEG"));
+  EXPECT_TRUE(IsSupportedImagePath("c.Png"));
+  EXPECT_FALSE(IsSupportedImagePath("d.gif"));
+  EXPECT_FALSE(IsSupportedImagePath("noext"));
+}
+
+TEST(HandImageIo, DecodesJpegAndPngToBgr) {
+  BgrImage image;
+  std::string error;
+  ASSERT_TRUE(DecodeImageFile(
+      SamplePath("istockphoto-462908027-612x612.jpg"), &image, &error))
+      << error;
+  EXPECT_EQ(image.width, 612);
+  EXPECT_EQ(image.height, 612);
+  EXPECT_EQ(image.pixels.size(), 612u * 612u * 3u);
+
+  ASSERT_TRUE(DecodeImageFile(SamplePath("two-palms.png"), &image, &error))
+      << error;
+  EXPECT_EQ(image.width, 612);
+  EXPECT_EQ(image.height, 408);
+  EXPECT_EQ(image.pixels.size(), 612u * 408u * 3u);
+}
+
+TEST(HandImageIo, RejectsMissingAndUnsupportedFiles) {
+  BgrImage image;
+  std::string error;
+  EXPECT_FALSE(DecodeImageFile("/nonexistent/image.jpg", &image, &error));
+  EXPECT_FALSE(error.empty());
+
+  error.clear();
+  const std::string model = std::string(HAND_PIPELINE_TEST_ASSETS_DIR) +
+                            "/models/hand_detection.tflite";
+  EXPECT_FALSE(DecodeImageFile(model, &image, &error));
+  EXPECT_FALSE(error.empty());
+  EXPECT_EQ(image.width, 0);
+}
+
+}  // namespace test
+}  // namespace hand_detection_tflite
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "hand_model_registry.h"
+#include "hand_tflite.h"
+#include "include/hand_detection_tflite/hand_pipeline.h"
+
+namespace hand_detection_tflite {
+namespace test {
+
+namespace {
+
+std::string AssetPath(const char* relative) {
+  return std::string(HAND_PIPELINE_TEST_ASSETS_DIR) + "/" + relative;
+}
+
+// Skips the calling test when the bundled TFLite library cannot be loaded
+// (e.g. an incompatible C++ runtime on the test machine).
+bool UseBundledTfLite() {
+  setenv("HAND_TFLITE_LIB",
+         AssetPath("bin/libtensorflowlite_c-linux.so").c_str(), 0);
+  std::string error;
+  return LoadTfLiteApi(&error) != nullptr;
+}
+
+}  // namespace
+
+TEST(ModelRegistry, SharesOneMappingPerFile) {
+  if (!UseBundledTfLite()) GTEST_SKIP() << "TFLite library unavailable";
+  const size_t before = SharedModelCount();
+  std::string error;
+  std::shared_ptr<const SharedModel> a =
+      AcquireSharedModel(AssetPath("models/hand_detection.tflite"), &error);
+  ASSERT_NE(a, nullptr) << error;
+  // Same file through a different spelling of the path.
+  std::shared_ptr<const SharedModel> b = AcquireSharedModel(
+      AssetPath("models/../models/hand_detection.tflite"), &error);
+  ASSERT_NE(b, nullptr) << error;
+  EXPECT_EQ(a.get(), b.get());
+  EXPECT_GT(a->size(), 0u);
+  EXPECT_EQ(SharedModelCount(), before + 1);
+
+  a.reset();
+  b.reset();
+  EXPECT_EQ(SharedModelCount(), before);
+}
+
+TEST(ModelRegistry, RunnersShareTheModel) {
+  if (!UseBundledTfLite()) GTEST_SKIP() << "TFLite library unavailable";
+  const size_t before = SharedModelCount();
+  const std::string path = AssetPath("models/hand_landmark_full.tflite");
+  std::string error;
+  TfLiteModelRunner first;
+  TfLiteModelRunner second;
+  ASSERT_TRUE(first.Load(path, 1, &error)) << error;
+  ASSERT_TRUE(second.Load(path, 1, &error)) << error;
+  EXPECT_EQ(SharedModelCount(), before + 1);
+  EXPECT_TRUE(first.Invoke(&error)) << error;
+  EXPECT_TRUE(second.Invoke(&error)) << error;
+}
+
+TEST(ModelRegistry, ReportsMissingFile) {
+  if (!UseBundledTfLite()) GTEST_SKIP() << "TFLite library unavailable";
+  std::string error;
+  EXPECT_EQ(AcquireSharedModel("/nonexistent/model.tflite", &error), nullptr);
+  EXPECT_NE(error.find("/nonexistent/model.tflite"), std::string::npos);
+
+  EXPECT_EQ(hand_model_acquire(nullptr), nullptr);
+  EXPECT_EQ(hand_model_acquire("/nonexistent/model.tflite"), nullptr);
+  EXPECT_STRNE(hand_pipeline_last_error(), "");
+}
+
+TEST(ModelRegistry, CApiCreatesInterpreters) {
+  if (!UseBundledTfLite()) GTEST_SKIP() << "TFLite library unavailable";
+  const int32_t before = hand_model_live_count();
+  HandModel* model =
+      hand_model_acquire(AssetPath("models/hand_detection.tflite").c_str());
+  ASSERT_NE(model, nullptr) << hand_pipeline_last_error();
+  EXPECT_EQ(hand_model_live_count(), before + 1);
+
+  const TfLiteApi* api = LoadTfLiteApi(nullptr);
+  TfLiteInterpreterOptions* options = api->InterpreterOptionsCreate();
+  api->InterpreterOptionsSetNumThreads(options, 1);
+  auto* interpreter = static_cast<TfLiteInterpreter*>(
+      hand_model_create_interpreter(model, options));
+  api->InterpreterOptionsDelete(options);
+  ASSERT_NE(interpreter, nullptr) << hand_pipeline_last_error();
+  EXPECT_EQ(api->InterpreterAllocateTensors(interpreter), 0);
+  EXPECT_EQ(api->InterpreterInvoke(interpreter), 0);
+  api->InterpreterDelete(interpreter);
+
+  hand_model_release(model);
+  EXPECT_EQ(hand_model_live_count(), before);
+  EXPECT_EQ(hand_model_create_interpreter(nullptr, nullptr), nullptr);
+}
+
+}  // namespace test
+}  // namespace hand_detection_tflite
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "hand_palm_anchors.h"
+
+namespace hand_detection_tflite {
+namespace test {
+
+namespace {
+
+// Reference (cx, cy) per anchor, mirroring PalmDetector.generateAnchors.
+std::vector<float> ReferenceCenters(int32_t input_size) {
+  struct Layer {
+    int32_t stride;
+    int32_t anchors_per_cell;
+  };
+  const Layer layers[] = {{8, 2}, {16, 6}};
+
+  std::vector<float> centers;
+  for (const Layer& layer : layers) {
+    const int32_t grid = (input_size + layer.stride - 1) / layer.stride;
+    for (int32_t y = 0; y < grid; ++y) {
+      for (int32_t x = 0; x < grid; ++x) {
+        for (int32_t a = 0; a < layer.anchors_per_cell; ++a) {
+          centers.push_back((x + 0.5f) / grid);
+          centers.push_back((y + 0.5f) / grid);
+        }
+      }
+    }
+  }
+  return centers;
+}
+
+void ExpectMatchesReference(int32_t input_size, const float* anchors,
+                            int32_t num_anchors) {
+  const std::vector<float> centers = ReferenceCenters(input_size);
+  ASSERT_EQ(static_cast<size_t>(num_anchors) * 2, centers.size());
+  for (int32_t i = 0; i < num_anchors; ++i) {
+    ASSERT_EQ(anchors[i], centers[2 * i]) << "anchor " << i;
+    ASSERT_EQ(anchors[num_anchors + i], centers[2 * i + 1]) << "anchor " << i;
+    ASSERT_EQ(anchors[2 * num_anchors + i], 1.0f) << "anchor " << i;
+    ASSERT_EQ(anchors[3 * num_anchors + i], 1.0f) << "anchor " << i;
+  }
+}
+
+}  // namespace
+
+TEST(HandPalmAnchorsTest, CompileTimeTableMatchesGeneratedAnchors) {
+  std::vector<float> storage;
+  int32_t num_anchors = 0;
+  const float* anchors =
+      PalmAnchors(kPalmAnchorInputSize, &storage, &num_anchors);
+
+  EXPECT_EQ(num_anchors, kNumPalmAnchors);
+  EXPECT_TRUE(storage.empty());
+  ExpectMatchesReference(kPalmAnchorInputSize, anchors, num_anchors);
+}
+
+TEST(HandPalmAnchorsTest, OtherInputSizesAreGeneratedAtRuntime) {
+  std::vector<float> storage;
+  int32_t num_anchors = 0;
+  const float* anchors = PalmAnchors(256, &storage, &num_anchors);
+
+  EXPECT_EQ(num_anchors, 32 * 32 * 2 + 16 * 16 * 6);
+  EXPECT_EQ(anchors, storage.data());
+  ExpectMatchesReference(256, anchors, num_anchors);
+}
+
+}  // namespace test
+}  // namespace hand_detection_tflite
@@ -0,0 +1,253 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "include/hand_detection_tflite/hand_pipeline.h"
+
+namespace hand_detection_tflite {
+namespace test {
+
+namespace {
+
+std::string AssetPath(const char* relative) {
+  return std::string(HAND_PIPELINE_TEST_ASSETS_DIR) + "/" + relative;
+}
+
+// Points the runtime loader at the bundled TFLite library unless the
+// environment already overrides it.
+void UseBundledTfLite() {
+  setenv("HAND_TFLITE_LIB",
+         AssetPath("bin/libtensorflowlite_c-linux.so").c_str(), 0);
+}
+
+HandPipelineOptions DefaultOptions() {
+  HandPipelineOptions options;
+  hand_pipeline_options_init(&options);
+  return options;
+}
+
+// Blank video frames for hand_pipeline_detect_video, recording what the
+// pipeline reports.
+struct BlankVideo {
+  int32_t width = 0;
+  int32_t height = 0;
+  int32_t frames = 0;
+  // Frame whose read fails, or whose report stops the stream; -1 for none.
+  int32_t fail_at = -1;
+  int32_t stop_at = -1;
+  int32_t read = 0;
+  std::vector<int64_t> indices;
+  std::vector<int64_t> timestamps;
+  int32_t hands = 0;
+
+  static int32_t Read(void* user_data, uint8_t* bgr, int64_t* timestamp_us) {
+    BlankVideo* video = static_cast<BlankVideo*>(user_data);
+    if (video->read == video->fail_at) return -1;
+    if (video->read == video->frames) return 0;
+    std::memset(bgr, 0, static_cast<size_t>(video->width) * video->height * 3);
+    *timestamp_us = 1000 + 40000 * video->read++;
+    return 1;
+  }
+
+  static int32_t Report(void* user_data, int64_t frame, int64_t timestamp_us,
+                        const HandPipelineHand*, int32_t count) {
+    BlankVideo* video = static_cast<BlankVideo*>(user_data);
+    video->indices.push_back(frame);
+    video->timestamps.push_back(timestamp_us);
+    video->hands += count;
+    return frame == video->stop_at ? 1 : 0;
+  }
+};
+
+}  // namespace
+
+TEST(HandPipeline, OptionsInitSetsDefaults) {
+  const HandPipelineOptions options = DefaultOptions();
+  EXPECT_EQ(options.struct_size, sizeof(HandPipelineOptions));
+  EXPECT_FLOAT_EQ(options.detector_confidence, 0.6f);
+  EXPECT_EQ(options.max_detections, 10);
+  EXPECT_FLOAT_EQ(options.min_landmark_score, 0.5f);
+  EXPECT_EQ(options.mode, HAND_PIPELINE_MODE_BOXES_AND_LANDMARKS);
+  EXPECT_EQ(options.num_workers, 0);
+  EXPECT_EQ(options.palm_tile_columns, 0);
+  EXPECT_EQ(options.palm_tile_rows, 0);
+  EXPECT_FLOAT_EQ(options.palm_tile_overlap, 0.25f);
+  EXPECT_EQ(options.palm_tile_full_frame, 1);
+  EXPECT_EQ(hand_pipeline_abi_version(), HAND_PIPELINE_ABI_VERSION);
+}
+
+TEST(HandPipeline, CreateRejectsInvalidOptions) {
+  EXPECT_EQ(hand_pipeline_create(nullptr), nullptr);
+  EXPECT_STRNE(hand_pipeline_last_error(), "");
+
+  // Landmark mode without a landmark model.
+  HandPipelineOptions options = DefaultOptions();
+  options.palm_model_path = "palm.tflite";
+  EXPECT_EQ(hand_pipeline_create(&options), nullptr);
+  EXPECT_STRNE(hand_pipeline_last_error(), "");
+
+  options = DefaultOptions();
+  options.palm_model_path = "palm.tflite";
+  options.mode = HAND_PIPELINE_MODE_BOXES;
+  options.palm_tile_overlap = 0.75f;
+  EXPECT_EQ(hand_pipeline_create(&options), nullptr);
+  EXPECT_STRNE(hand_pipeline_last_error(), "");
+}
+
+TEST(HandPipeline, CreateReportsMissingModel) {
+  UseBundledTfLite();
+  HandPipelineOptions options = DefaultOptions();
+  options.palm_model_path = "/nonexistent/hand_detection.tflite";
+  options.mode = HAND_PIPELINE_MODE_BOXES;
+  EXPECT_EQ(hand_pipeline_create(&options), nullptr);
+  EXPECT_STRNE(hand_pipeline_last_error(), "");
+}
+
+TEST(HandPipeline, DetectsNothingInBlankImage) {
+  UseBundledTfLite();
+  const std::string palm = AssetPath("models/hand_detection.tflite");
+  const std::string landmark = AssetPath("models/hand_landmark_full.tflite");
+  HandPipelineOptions options = DefaultOptions();
+  options.palm_model_path = palm.c_str();
+  options.landmark_model_path = landmark.c_str();
+  options.num_threads = 1;
+
+  HandPipeline* pipeline = hand_pipeline_create(&options);
+  if (pipeline == nullptr) {
+    GTEST_SKIP() << hand_pipeline_last_error();
+  }
+
+  const int32_t w = 320;
+  const int32_t h = 240;
+  std::vector<uint8_t> image(w * h * 3, 0);
+  HandPipelineHand hands[4];
+  EXPECT_EQ(hand_pipeline_detect(pipeline, image.data(), w, h, w * 3, hands, 4),
+            0);
+  EXPECT_EQ(hand_pipeline_detect(pipeline, image.data(), w, h, w, hands, 4),
+            HAND_PIPELINE_ERROR_INVALID_ARGUMENT);
+
+  // Black NV12 frame.
+  std::vector<uint8_t> luma(w * h, 16);
+  std::vector<uint8_t> chroma(w * h / 2, 128);
+  const HandYuv420Image nv12 = {luma.data(), chroma.data(), chroma.data() + 1,
+                                w, w, 2};
+  EXPECT_EQ(hand_pipeline_detect_yuv420(pipeline, &nv12, w, h, hands, 4), 0);
+  EXPECT_EQ(hand_pipeline_detect_yuv420(pipeline, nullptr, w, h, hands, 4),
+            HAND_PIPELINE_ERROR_INVALID_ARGUMENT);
+  hand_pipeline_destroy(pipeline);
+}
+
+TEST(HandPipeline, TiledDetectionOnBlankFrames) {
+  UseBundledTfLite();
+  const std::string palm = AssetPath("models/hand_detection.tflite");
+  HandPipelineOptions options = DefaultOptions();
+  options.palm_model_path = palm.c_str();
+  options.mode = HAND_PIPELINE_MODE_BOXES;
+  options.num_threads = 1;
+  options.palm_tile_columns = 3;
+  options.palm_tile_rows = 2;
+
+  for (const int32_t workers : {0, 2}) {
+    options.num_workers = workers;
+    HandPipeline* pipeline = hand_pipeline_create(&options);
+    if (pipeline == nullptr) {
+      GTEST_SKIP() << hand_pipeline_last_error();
+    }
+
+    // Large enough for the full 3x2 grid plus the whole frame, then small
+    // enough to fall back to the whole frame alone.
+    for (const int32_t w : {1280, 256}) {
+      const int32_t h = w * 9 / 16;
+      std::vector<uint8_t> image(w * h * 3, 0);
+      HandPipelineHand hands[4];
+      EXPECT_EQ(
+          hand_pipeline_detect(pipeline, image.data(), w, h, w * 3, hands, 4),
+          0);
+
+      std::vector<uint8_t> luma(w * h, 16);
+      std::vector<uint8_t> chroma(w * h / 2, 128);
+      const HandYuv420Image nv12 = {luma.data(), chroma.data(),
+                                    chroma.data() + 1, w, w, 2};
+      EXPECT_EQ(hand_pipeline_detect_yuv420(pipeline, &nv12, w, h, hands, 4),
+                0);
+    }
+    hand_pipeline_destroy(pipeline);
+  }
+}
+
+TEST(HandPipeline, VideoRejectsInvalidArguments) {
+  HandVideoOptions video;
+  hand_video_options_init(&video);
+  EXPECT_EQ(video.struct_size, sizeof(HandVideoOptions));
+  EXPECT_EQ(video.queue_depth, 4);
+  BlankVideo source;
+  EXPECT_EQ(hand_pipeline_detect_video(nullptr, &video, BlankVideo::Read,
+                                       BlankVideo::Report, &source),
+            HAND_PIPELINE_ERROR_INVALID_ARGUMENT);
+  EXPECT_STRNE(hand_pipeline_last_error(), "");
+}
+
+TEST(HandPipeline, VideoReportsFramesInOrder) {
+  UseBundledTfLite();
+  const std::string palm = AssetPath("models/hand_detection.tflite");
+  const std::string landmark = AssetPath("models/hand_landmark_full.tflite");
+  HandPipelineOptions options = DefaultOptions();
+  options.palm_model_path = palm.c_str();
+  options.landmark_model_path = landmark.c_str();
+  options.num_threads = 1;
+
+  for (const int32_t workers : {0, 2}) {
+    options.num_workers = workers;
+    HandPipeline* pipeline = hand_pipeline_create(&options);
+    if (pipeline == nullptr) {
+      GTEST_SKIP() << hand_pipeline_last_error();
+    }
+    HandVideoOptions video;
+    hand_video_options_init(&video);
+    video.width = 320;
+    video.height = 240;
+    video.queue_depth = 2;
+
+    BlankVideo source;
+    source.width = video.width;
+    source.height = video.height;
+    source.frames = 7;
+    EXPECT_EQ(hand_pipeline_detect_video(pipeline, &video, BlankVideo::Read,
+                                         BlankVideo::Report, &source),
+              7);
+    ASSERT_EQ(source.indices.size(), 7u);
+    for (int32_t i = 0; i < 7; ++i) {
+      EXPECT_EQ(source.indices[i], i);
+      EXPECT_EQ(source.timestamps[i], 1000 + 40000 * i);
+    }
+    EXPECT_EQ(source.hands, 0);
+
+    // Stopped from the result callback after frame 2.
+    BlankVideo stopped = source;
+    stopped.read = 0;
+    stopped.stop_at = 2;
+    stopped.indices.clear();
+    stopped.timestamps.clear();
+    EXPECT_EQ(hand_pipeline_detect_video(pipeline, &video, BlankVideo::Read,
+                                         BlankVideo::Report, &stopped),
+              3);
+    EXPECT_EQ(stopped.indices.size(), 3u);
+
+    // A read error fails the stream.
+    BlankVideo broken = source;
+    broken.read = 0;
+    broken.fail_at = 4;
+    EXPECT_EQ(hand_pipeline_detect_video(pipeline, &video, BlankVideo::Read,
+                                         BlankVideo::Report, &broken),
+              HAND_PIPELINE_ERROR_INVALID_ARGUMENT);
+    EXPECT_STRNE(hand_pipeline_last_error(), "");
+    hand_pipeline_destroy(pipeline);
+  }
+}
+
+}  // namespace test
+}  // namespace hand_detection_tflite
@@ -1,9 +1,16 @@
+import 'dart:typed_data';
 import 'package:flutter_test/flutter_test.dart';
 import 'package:opencv_dart/opencv_dart.dart' as cv;
 import 'package:hand_detection_tflite/hand_detection_tflite.dart';
 import 'package:hand_detection_tflite/src/image_utils.dart';
+import 'package:hand_detection_tflite/src/landmark_smoother.dart';
+import 'package:hand_detection_tflite/src/mat_arena.dart';
 import 'package:hand_detection_tflite/src/palm_detector.dart';
 import 'package:hand_detection_tflite/src/hand_landmark_model.dart';
+import 'package:hand_detection_tflite/src/tensor_memory.dart';
+import 'package:hand_detection_tflite/src/tensor_quantization.dart';
+import 'package:tflite_flutter_custom/tflite_flutter.dart'
+    show Interpreter, TensorType;
 
 void main() {
   TestWidgetsFlutterBinding.ensureInitialized();
@@ -40,11 +47,50 @@ void main() {
           () => runner.run(mat),
           throwsA(isA<StateError>()),
         );
+        expect(
+          () => runner.runBatch([mat, mat]),
+          throwsA(isA<StateError>()),
+        );
       } finally {
         mat.dispose();
       }
     });
 
+    test('runBatch matches per-crop inference', () async {
+      // Three crops in a batch of four, the last slot left as padding.
+      final runner = HandLandmarkModelRunner(maxBatch: 4);
+      await runner.initialize(HandLandmarkModel.full);
+
+      cv.Mat solid(int rows, int cols, cv.Scalar color) =>
+          cv.Mat.zeros(rows, cols, cv.MatType.CV_8UC3)..setTo(color);
+      final crops = [
+        solid(120, 100, cv.Scalar(200, 120, 40, 0)),
+        solid(80, 80, cv.Scalar(30, 180, 90, 0)),
+        solid(60, 90, cv.Scalar(90, 60, 220, 0)),
+      ];
+      try {
+        final batched = await runner.runBatch(crops);
+        expect(batched.length, crops.length);
+
+        for (int i = 0; i < crops.length; i++) {
+          final single = await runner.run(crops[i]);
+          expect(batched[i].score, closeTo(single.score, 1e-4));
+          expect(batched[i].handedness, single.handedness);
+          for (int j = 0; j < single.landmarks.length; j++) {
+            expect(batched[i].landmarks[j].x,
+                closeTo(single.landmarks[j].x, 1e-2));
+            expect(batched[i].landmarks[j].y,
+                closeTo(single.landmarks[j].y, 1e-2));
+          }
+        }
+      } finally {
+        for (final crop in crops) {
+          crop.dispose();
+        }
+        await runner.dispose();
+      }
+    });
+
     test('ensureTFLiteLoaded honors env override', () async {
       HandLandmarkModelRunner.resetNativeLibForTest();
       await HandLandmarkModelRunner.ensureTFLiteLoaded(
@@ -81,6 +127,54 @@ void main() {
     });
   });
 
+  group('TensorMemory', () {
+    test('reads and writes the tensors the interpreter copies', () async {
+      await HandLandmarkModelRunner.ensureTFLiteLoaded();
+      final interpreter = await Interpreter.fromAsset(
+          'packages/hand_detection_tflite/assets/models/hand_detection.tflite');
+      interpreter.allocateTensors();
+
+      final input = Float32List(192 * 192 * 3);
+      for (int i = 0; i < input.length; i++) {
+        input[i] = (i % 251) / 251;
+      }
+      final boxes = Float32List(2016 * 18);
+      final scores = Float32List(2016);
+      interpreter.runForMultipleInputs(
+          [input.buffer], {0: boxes.buffer, 1: scores.buffer});
+
+      try {
+        // Inline, then on an invoker isolate.
+        for (final inline in [true, false]) {
+          final memory =
+              await TensorMemory.create(interpreter, inline: inline);
+          if (memory == null) {
+            markTestSkipped('TensorFlow Lite C API not reachable from Dart');
+            return;
+          }
+          try {
+            memory.inputFloats(0).setAll(0, input);
+            await memory.invoke();
+            final outBoxes = memory.outputFloats(0);
+            final outScores = memory.outputFloats(1);
+            expect(outBoxes.length, boxes.length);
+            expect(outScores.length, scores.length);
+            for (int i = 0; i < boxes.length; i++) {
+              expect(outBoxes[i], closeTo(boxes[i], 1e-5));
+            }
+            for (int i = 0; i < scores.length; i++) {
+              expect(outScores[i], closeTo(scores[i], 1e-5));
+            }
+          } finally {
+            await memory.close();
+          }
+        }
+      } finally {
+        interpreter.close();
+      }
+    });
+  });
+
   group('PalmDetector anchor generation', () {
     test('generates correct number of anchors', () {
       final options = SSDAnchorOptions(
@@ -116,6 +210,39 @@ void main() {
       }
     });
 
+    test('precomputed anchor table matches generated anchors', () {
+      SSDAnchorOptions options({int inputSize = 192}) => SSDAnchorOptions(
+            numLayers: 4,
+            minScale: 0.1484375,
+            maxScale: 0.75,
+            inputSizeHeight: inputSize,
+            inputSizeWidth: inputSize,
+            anchorOffsetX: 0.5,
+            anchorOffsetY: 0.5,
+            strides: [8, 16, 16, 16],
+            aspectRatios: [1.0],
+            reduceBoxesInLowestLayer: false,
+            interpolatedScaleAspectRatio: 1.0,
+            fixedAnchorSize: true,
+          );
+
+      for (final inputSize in [192, 256]) {
+        final anchors = PalmDetector.generateAnchors(
+          options(inputSize: inputSize),
+        );
+        final table = PalmDetector.anchorTable(options(inputSize: inputSize));
+        final n = anchors.length;
+
+        // Struct-of-arrays: cx row, cy row, w row, h row.
+        expect(table.length, n * 4);
+        for (int i = 0; i < n; i++) {
+          for (int k = 0; k < 4; k++) {
+            expect(table[k * n + i], Float32List.fromList([anchors[i][k]])[0]);
+          }
+        }
+      }
+    });
+
     test('normalizeRadians normalizes angles correctly', () {
       // Test values within range
       expect(PalmDetector.normalizeRadians(0), closeTo(0, 0.0001));
@@ -129,6 +256,149 @@ void main() {
     });
   });
 
+  group('DetectionStats', () {
+    test('sums landmark invocations and reports microseconds', () {
+      final stats = DetectionStats()
+        ..decode = const Duration(microseconds: 1500)
+        ..total = const Duration(milliseconds: 9);
+      stats.landmarkInference
+        ..add(const Duration(microseconds: 700))
+        ..add(const Duration(microseconds: 800));
+      expect(stats.landmarkInferenceTotal, const Duration(microseconds: 1500));
+      final map = stats.toMap();
+      expect(map['decode'], 1500);
+      expect(map['landmarkInference'], 1500);
+      expect(map['palmInference'], 0);
+      expect(map['total'], 9000);
+      expect(stats.toString(), contains('landmarkInvocations=2'));
+    });
+  });
+
+  group('PalmTiling', () {
+    test('lays out overlapping tiles after the whole frame', () {
+      const tiling = PalmTiling(columns: 3, rows: 2);
+      final tiles = tiling.tiles(3840, 2160);
+      expect(tiles, hasLength(7));
+      expect(tiles.first, (x: 0, y: 0, width: 3840, height: 2160));
+      expect(tiles.skip(1).map((t) => t.x), [0, 1152, 2304, 0, 1152, 2304]);
+      expect(tiles.skip(1).map((t) => t.y), [0, 0, 0, 926, 926, 926]);
+      expect(tiles[1].width, 1536);
+      expect(tiles[1].height, 1234);
+      expect(tiles.last.height, 2160 - 926);
+    });
+
+    test('never uses tiles smaller than the model input', () {
+      const tiling = PalmTiling(columns: 3, rows: 2, includeFullFrame: false);
+      expect(tiling.tiles(300, 200), [(x: 0, y: 0, width: 300, height: 200)]);
+      expect(
+        const PalmTiling(columns: 2, rows: 1, overlap: 0.5)
+            .tiles(640, 480)
+            .skip(1),
+        [
+          (x: 0, y: 0, width: 427, height: 480),
+          (x: 212, y: 0, width: 428, height: 480),
+        ],
+      );
+      expect(const PalmTiling(columns: 1, rows: 1).isEnabled, isFalse);
+    });
+
+    test('maps tile palms to the image and drops cut hands', () {
+      PalmDetection palm(double score, double x, double y) => PalmDetection(
+            sqnRrSize: 0.5,
+            rotation: 0.0,
+            sqnRrCenterX: x,
+            sqnRrCenterY: y,
+            score: score,
+          );
+      final mapped = PalmDetector.mapTilePalms(
+        [palm(0.9, 0.5, 0.5), palm(0.8, 0.1, 0.5), palm(0.7, 0.5, 1.2)],
+        (x: 100, y: 50, width: 200, height: 100),
+        400,
+        200,
+      );
+      expect(mapped, hasLength(1));
+      expect(mapped.single.score, 0.9);
+      expect(mapped.single.sqnRrCenterX, 0.5);
+      expect(mapped.single.sqnRrCenterY, 0.5);
+      expect(mapped.single.sqnRrSize, 0.25);
+
+      // The whole frame keeps every palm.
+      expect(
+        PalmDetector.mapTilePalms(
+          [palm(0.8, 1.5, 0.5)],
+          (x: 0, y: 0, width: 400, height: 200),
+          400,
+          200,
+        ).single.sqnRrCenterX,
+        1.5,
+      );
+    });
+  });
+
+  group('TensorQuantization', () {
+    test('uint8 [0, 1] inputs store pixels unchanged', () {
+      const q = TensorQuantization(
+        type: TensorType.uint8,
+        scale: 1.0 / 255.0,
+        zeroPoint: 0,
+      );
+      expect(q.isQuantized, isTrue);
+      expect(q.pixelLut(), isNull);
+    });
+
+    test('int8 inputs shift pixels by the zero point', () {
+      const q = TensorQuantization(
+        type: TensorType.int8,
+        scale: 1.0 / 255.0,
+        zeroPoint: -128,
+      );
+      final lut = q.pixelLut()!;
+      final signed = Int8List.sublistView(lut);
+      expect(signed[0], -128);
+      expect(signed[128], 0);
+      expect(signed[255], 127);
+    });
+
+    test('dequantizes uint8 and int8 outputs', () {
+      final out = Float32List(3);
+      const TensorQuantization(
+        type: TensorType.uint8,
+        scale: 0.5,
+        zeroPoint: 10,
+      ).dequantize(Uint8List.fromList([0, 10, 255]), out);
+      expect(out, [-5.0, 0.0, 122.5]);
+
+      const TensorQuantization(
+        type: TensorType.int8,
+        scale: 0.25,
+        zeroPoint: -128,
+      ).dequantize(
+          Uint8List.sublistView(Int8List.fromList([-128, 0, 127])), out);
+      expect(out, [0.0, 32.0, 63.75]);
+    });
+
+    test('letterboxToUint8Tensor pads with the encoded black', () {
+      const q = TensorQuantization(
+        type: TensorType.int8,
+        scale: 1.0 / 255.0,
+        zeroPoint: -128,
+      );
+      final image = cv.Mat.zeros(4, 2, cv.MatType.CV_8UC3)
+        ..setTo(cv.Scalar(255, 255, 255, 0));
+      final buffer = Uint8List(4 * 4 * 3);
+      try {
+        final info = ImageUtils.letterboxToUint8Tensor(image, 4, 4, buffer,
+            lut: q.pixelLut());
+        expect(info.padLeft, 1);
+        final signed = Int8List.sublistView(buffer);
+        expect(signed[0], -128);
+        expect(signed[3], 127);
+      } finally {
+        image.dispose();
+      }
+    });
+  });
+
   group('ImageUtils rotation utilities', () {
     test('keepAspectResizeAndPad maintains aspect ratio', () {
       final source = cv.Mat.zeros(200, 100, cv.MatType.CV_8UC3);
@@ -150,6 +420,22 @@ void main() {
       }
     });
 
+    test('jpegSize reads the JPEG frame header', () {
+      final mat = cv.Mat.zeros(30, 50, cv.MatType.CV_8UC3);
+      try {
+        final (ok, jpeg) = cv.imencode('.jpg', mat);
+        expect(ok, true);
+        expect(ImageUtils.jpegSize(jpeg), (50, 30));
+
+        final (_, png) = cv.imencode('.png', mat);
+        expect(ImageUtils.jpegSize(png), isNull);
+        expect(ImageUtils.jpegSize(Uint8List.fromList([0xFF, 0xD8, 0xFF])),
+            isNull);
+      } finally {
+        mat.dispose();
+      }
+    });
+
     test('palmToRect converts normalized coordinates', () {
       final palm = PalmDetection(
         sqnRrSize: 0.5,
@@ -203,6 +489,259 @@ void main() {
         mat.dispose();
       }
     });
+
+    test('letterboxToTensor pads and normalizes into the given buffer', () {
+      // 100x200 (portrait) blue image letterboxed into 192x192
+      final mat = cv.Mat.zeros(200, 100, cv.MatType.CV_8UC3);
+      mat.setTo(cv.Scalar(255, 0, 0, 0));
+      final buffer = Float32List(192 * 192 * 3);
+
+      try {
+        final info = ImageUtils.letterboxToTensor(mat, 192, 192, buffer);
+
+        expect(info.resizedWidth, 96);
+        expect(info.resizedHeight, 192);
+        expect(info.padLeft, 48);
+        expect(info.padTop, 0);
+
+        // Padding column is black
+        expect(buffer[0], 0.0);
+        expect(buffer[1], 0.0);
+        expect(buffer[2], 0.0);
+
+        // Content is RGB (0, 0, 1)
+        final center = (96 * 192 + 96) * 3;
+        expect(buffer[center], closeTo(0.0, 0.01));
+        expect(buffer[center + 1], closeTo(0.0, 0.01));
+        expect(buffer[center + 2], closeTo(1.0, 0.01));
+      } finally {
+        mat.dispose();
+      }
+    });
+
+    test('letterboxToTensor reads a region in place like its copy', () {
+      // A pattern so that an offset or stride error changes the result.
+      final pixels = Uint8List(120 * 160 * 3);
+      for (int i = 0; i < pixels.length; i++) {
+        pixels[i] = (i * 7) % 256;
+      }
+      final mat = cv.Mat.fromList(120, 160, cv.MatType.CV_8UC3, pixels);
+      final rect = cv.Rect(30, 20, 90, 70);
+      final copy = mat.region(rect).clone();
+      final buffer = Float32List(64 * 64 * 3);
+      final reference = Float32List(64 * 64 * 3);
+
+      try {
+        final info = ImageUtils.letterboxToTensor(mat, 64, 64, buffer,
+            region: rect);
+        final expected =
+            ImageUtils.letterboxToTensor(copy, 64, 64, reference);
+        expect(info, expected);
+        for (int i = 0; i < buffer.length; i++) {
+          expect(buffer[i], closeTo(reference[i], 1e-6));
+        }
+      } finally {
+        copy.dispose();
+        mat.dispose();
+      }
+    });
+  });
+
+  group('LandmarkSmoother', () {
+    Hand handAt(double x, {double size = 100}) => Hand(
+          boundingBox: BoundingBox(
+              left: x - size / 2, top: 0, right: x + size / 2, bottom: size),
+          score: 0.9,
+          landmarks: [
+            for (final type in HandLandmarkType.values)
+              HandLandmark(
+                  type: type, x: x, y: 50, z: 0, visibility: 0.8),
+          ],
+          imageWidth: 640,
+          imageHeight: 480,
+          handedness: Handedness.left,
+          rotation: 0,
+          rotatedCenterX: x,
+          rotatedCenterY: 50,
+          rotatedSize: size,
+        );
+
+    test('passes new hands through and smooths jitter of matched ones', () {
+      final smoother = LandmarkSmoother(
+          const LandmarkSmoothing(frameRate: 30, minCutoff: 1, beta: 0));
+
+      final first = smoother.smoothHands([handAt(100)]);
+      expect(first.single.landmarks.first.x, 100);
+      expect(smoother.trackCount, 1);
+
+      // A 10 px jump moves the smoothed landmark only part of the way.
+      final second = smoother.smoothHands([handAt(110)]);
+      final x = second.single.landmarks.first.x;
+      expect(x, greaterThan(100));
+      expect(x, lessThan(105));
+      expect(second.single.landmarks.first.visibility, 0.8);
+      expect(second.single.handedness, Handedness.left);
+
+      // A hand far from every track starts a new, unsmoothed track.
+      final third = smoother.smoothHands([handAt(110), handAt(400)]);
+      expect(third[1].landmarks.first.x, 400);
+      expect(smoother.trackCount, 2);
+
+      smoother.reset();
+      expect(smoother.trackCount, 0);
+      expect(smoother.smoothHands([handAt(120)]).single.landmarks.first.x,
+          120);
+    });
+
+    test('speed raises the cutoff', () {
+      double lastX(LandmarkSmoothing config) {
+        final smoother = LandmarkSmoother(config);
+        double x = 0;
+        for (int frame = 0; frame < 10; frame++) {
+          x = smoother
+              .smoothHands([handAt(100.0 + 10 * frame)])
+              .single
+              .landmarks
+              .first
+              .x;
+        }
+        return x;
+      }
+
+      final ema = lastX(const LandmarkSmoothing.ema(cutoff: 1, frameRate: 30));
+      final oneEuro = lastX(const LandmarkSmoothing(
+          minCutoff: 1, beta: 10, frameRate: 30));
+      expect(ema, lessThan(190));
+      expect(oneEuro, greaterThan(ema));
+    });
+
+    test('smooths packed frames in place', () {
+      final smoother = LandmarkSmoother(
+          const LandmarkSmoothing(frameRate: 30, minCutoff: 1, beta: 0));
+      PackedHands frame(double x) => PackedHands.fromHands([handAt(x)],
+          imageWidth: 640, imageHeight: 480);
+
+      smoother.smoothPacked(frame(100));
+      final packed = frame(110);
+      smoother.smoothPacked(packed);
+      expect(packed[0].x(HandLandmarkType.wrist), lessThan(105));
+      expect(packed[0].left, 60);
+    });
+  });
+
+  group('MatArena', () {
+    test('reuses released crop slots and grows them in steps', () {
+      final arena = MatArena();
+      try {
+        final a = arena.acquireCrop(100);
+        expect(a.mat.cols, 100);
+        expect(a.capacity, MatArena.cropGranularity * 2);
+        expect(MatArena.slotOf(a.mat), same(a));
+        final b = arena.acquireCrop(50);
+        expect(identical(a, b), isFalse);
+        arena.releaseCrop(a);
+        arena.releaseCrop(b);
+
+        final c = arena.acquireCrop(120);
+        expect(arena.cropSlots, 2);
+        expect(c.capacity, MatArena.cropGranularity * 2);
+        expect(c.mat.rows, 120);
+        arena.releaseCrop(c);
+      } finally {
+        arena.dispose();
+      }
+    });
+
+    test('arena crops match allocated crops', () {
+      final image = cv.Mat.zeros(240, 320, cv.MatType.CV_8UC3);
+      final block = image.region(cv.Rect(100, 60, 90, 120))
+        ..setTo(cv.Scalar(30, 160, 220, 0));
+      block.dispose();
+      const palm = PalmDetection(
+        sqnRrSize: 0.3,
+        rotation: 0.4,
+        sqnRrCenterX: 0.45,
+        sqnRrCenterY: 0.5,
+        score: 0.9,
+      );
+      final arena = MatArena();
+      final expected = ImageUtils.rotateAndCropRectangle(image, palm)!;
+      try {
+        for (int i = 0; i < 2; i++) {
+          final crop =
+              ImageUtils.rotateAndCropRectangle(image, palm, arena: arena)!;
+          final copy = crop.clone();
+          expect(copy.data, expected.data);
+          copy.dispose();
+
+          final buffer = Float32List(224 * 224 * 3);
+          final reference = Float32List(224 * 224 * 3);
+          ImageUtils.letterboxToTensor(crop, 224, 224, buffer);
+          ImageUtils.letterboxToTensor(expected, 224, 224, reference);
+          expect(buffer, reference);
+          arena.releaseCrop(MatArena.slotOf(crop)!);
+        }
+        expect(arena.cropSlots, 1);
+      } finally {
+        image.dispose();
+        expected.dispose();
+        arena.dispose();
+      }
+    });
+
+    test('crops warp straight to the output size', () {
+      final image = cv.Mat.zeros(480, 640, cv.MatType.CV_8UC3);
+      final block = image.region(cv.Rect(200, 120, 180, 240))
+        ..setTo(cv.Scalar(30, 160, 220, 0));
+      block.dispose();
+      // A 512 px square, sampled from pyramid level 1.
+      const palm = PalmDetection(
+        sqnRrSize: 0.8,
+        rotation: 0.4,
+        sqnRrCenterX: 0.45,
+        sqnRrCenterY: 0.5,
+        score: 0.9,
+      );
+      double meanDifference(cv.Mat a, cv.Mat b) {
+        final x = a.clone();
+        final y = b.clone();
+        var sum = 0;
+        for (int i = 0; i < x.data.length; i++) {
+          sum += (x.data[i] - y.data[i]).abs();
+        }
+        final mean = sum / x.data.length;
+        x.dispose();
+        y.dispose();
+        return mean;
+      }
+
+      final arena = MatArena();
+      final full = ImageUtils.rotateAndCropRectangle(image, palm)!;
+      final expected = cv.resize(full, (224, 224));
+      final direct =
+          ImageUtils.rotateAndCropRectangle(image, palm, outputSize: 224)!;
+      arena.cropPyramid.reset(image, ImageUtils.cropBounds(image, palm)!);
+      final fromPyramid = ImageUtils.rotateAndCropRectangle(
+        image,
+        palm,
+        arena: arena,
+        outputSize: 224,
+        pyramid: arena.cropPyramid,
+      )!;
+      try {
+        expect(full.cols, 512);
+        expect((direct.cols, direct.rows), (224, 224));
+        expect((fromPyramid.cols, fromPyramid.rows), (224, 224));
+        expect(meanDifference(direct, expected), lessThan(4));
+        expect(meanDifference(fromPyramid, expected), lessThan(8));
+      } finally {
+        image.dispose();
+        full.dispose();
+        expected.dispose();
+        direct.dispose();
+        arena.dispose();
+      }
+    });
   });
 
   group('Types', () {
@@ -255,5 +794,82 @@ void main() {
       expect(landmarks.handedness, Handedness.left);
       expect(landmarks.score, 0.9);
     });
+
+    test('PackedHands round-trips Hand objects through packed sections', () {
+      Hand hand(double offset, Handedness? handedness) => Hand(
+            boundingBox: BoundingBox(
+                left: offset, top: 1, right: offset + 50, bottom: 60),
+            score: 0.75,
+            landmarks: [
+              for (final type in HandLandmarkType.values)
+                HandLandmark(
+                  type: type,
+                  x: offset + type.index,
+                  y: 2.0 * type.index,
+                  z: -0.5,
+                  visibility: 0.5,
+                ),
+            ],
+            imageWidth: 640,
+            imageHeight: 480,
+            handedness: handedness,
+            rotation: 0.25,
+            rotatedCenterX: offset + 25,
+            rotatedCenterY: 30,
+            rotatedSize: 50,
+          );
+
+      final hands = [hand(10, Handedness.left), hand(200, null)];
+      final packed =
+          PackedHands.fromHands(hands, imageWidth: 640, imageHeight: 480);
+
+      expect(packed.length, 2);
+      expect(packed.hasLandmarks, true);
+      expect(packed.data.length, 2 * (11 + 63));
+      expect(packed.landmarksOffset, 22);
+
+      final second = packed[1];
+      expect(second.left, 200);
+      expect(second.right, 250);
+      expect(second.score, 0.75);
+      expect(second.landmarkScore, 0.5);
+      expect(second.handedness, isNull);
+      expect(packed[0].handedness, Handedness.left);
+      expect(second.rotation, 0.25);
+      expect(second.rotatedCenterX, 225);
+      expect(second.x(HandLandmarkType.pinkyTip), 220);
+      expect(second.y(HandLandmarkType.pinkyTip), 40);
+      expect(second.z(HandLandmarkType.wrist), -0.5);
+
+      final restored = packed.toHands();
+      expect(restored[0].boundingBox.left, 10);
+      expect(restored[0].landmarks.length, 21);
+      expect(restored[1].getLandmark(HandLandmarkType.thumbTip)!.x, 204);
+      expect(restored[1].rotatedSize, 50);
+
+      final selected = packed.select([1]);
+      expect(selected.length, 1);
+      expect(selected[0].left, 200);
+      expect(selected[0].x(HandLandmarkType.wrist), 200);
+      expect(() => packed[2], throwsRangeError);
+    });
+
+    test('PackedHands without landmarks has no landmark section', () {
+      final packed = PackedHands.allocate(
+        3,
+        imageWidth: 10,
+        imageHeight: 10,
+        hasLandmarks: false,
+      );
+      expect(packed.data.length, 33);
+      expect(packed.landmarks, isEmpty);
+      expect(packed[0].toHand().hasLandmarks, false);
+      expect(() => packed[0].x(HandLandmarkType.wrist), throwsStateError);
+      expect(
+        () => PackedHands(Float32List(10),
+            length: 1, imageWidth: 1, imageHeight: 1, hasLandmarks: false),
+        throwsArgumentError,
+      );
+    });
   });
 }
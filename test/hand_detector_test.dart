@@ -122,6 +122,21 @@ void main() {
       }
     });
 
+    test('should throw StateError when detectOnYuv() called before initialize',
+        () async {
+      final detector = HandDetector();
+      final frame = YuvFrame.nv12(Uint8List(4 * 4 * 3 ~/ 2), 4, 4);
+
+      expect(
+        () => detector.detectOnYuv(frame),
+        throwsA(isA<StateError>().having(
+          (e) => e.message,
+          'message',
+          contains('not initialized'),
+        )),
+      );
+    });
+
     test('should return empty list for invalid image bytes', () async {
       final detector = HandDetector();
       await detector.initialize();
@@ -294,6 +309,553 @@ void main() {
     });
   });
 
+  group('HandDetector - overlapping calls', () {
+    test('concurrent detectOnMat() calls match sequential calls', () async {
+      final detector = HandDetector(interpreterPoolSize: 2);
+      await detector.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final landscape = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+      // Different geometry, so mixed-up per-call state would show.
+      final portrait = cv.rotate(landscape, cv.ROTATE_90_CLOCKWISE);
+      try {
+        final expected = [
+          await detector.detectOnMat(landscape),
+          await detector.detectOnMat(portrait),
+        ];
+        final results = await Future.wait([
+          for (int i = 0; i < 3; i++) ...[
+            detector.detectOnMat(landscape),
+            detector.detectOnMat(portrait),
+          ],
+        ]);
+
+        expect(expected[0], isNotEmpty);
+        for (int i = 0; i < results.length; i++) {
+          final hands = results[i];
+          final reference = expected[i % 2];
+          expect(hands.length, reference.length);
+          for (int j = 0; j < hands.length; j++) {
+            expect(hands[j].imageWidth, reference[j].imageWidth);
+            expect(hands[j].boundingBox.left,
+                closeTo(reference[j].boundingBox.left, 1e-6));
+            expect(hands[j].boundingBox.top,
+                closeTo(reference[j].boundingBox.top, 1e-6));
+            expect(hands[j].score, closeTo(reference[j].score, 1e-6));
+          }
+        }
+      } finally {
+        landscape.dispose();
+        portrait.dispose();
+        await detector.dispose();
+      }
+    });
+  });
+
+  group('HandDetector - useWorkerIsolate', () {
+    test('worker isolate matches in-process detection', () async {
+      final detector = HandDetector();
+      await detector.initialize();
+      final worker = HandDetector(useWorkerIsolate: true, collectStats: true);
+      await worker.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final bytes = data.buffer.asUint8List();
+      final mat = cv.imdecode(bytes, cv.IMREAD_COLOR);
+      try {
+        final expected = await detector.detect(bytes);
+        expect(expected, isNotEmpty);
+
+        for (final hands in [
+          await worker.detect(bytes),
+          await worker.detectOnMat(mat),
+          (await worker.detectPacked(bytes)).toHands(),
+          (await worker.detectOnMatPacked(mat)).toHands(),
+        ]) {
+          expect(hands.length, expected.length);
+          for (int i = 0; i < hands.length; i++) {
+            expect(hands[i].imageWidth, mat.cols);
+            expect(hands[i].landmarks.length, 21);
+            expect(hands[i].boundingBox.left,
+                closeTo(expected[i].boundingBox.left, 1e-2));
+            final wrist = hands[i].getLandmark(HandLandmarkType.wrist)!;
+            final expectedWrist =
+                expected[i].getLandmark(HandLandmarkType.wrist)!;
+            expect(wrist.x, closeTo(expectedWrist.x, 1e-2));
+            expect(wrist.y, closeTo(expectedWrist.y, 1e-2));
+          }
+        }
+        expect(worker.lastStats!.palmInference, greaterThan(Duration.zero));
+        expect(await worker.detect([1, 2, 3]), isEmpty);
+      } finally {
+        mat.dispose();
+        await detector.dispose();
+        await worker.dispose();
+      }
+      expect(worker.isInitialized, false);
+    });
+  });
+
+  group('HandDetector - packed results', () {
+    test('detectOnMatPacked() matches detectOnMat()', () async {
+      for (final mode in HandMode.values) {
+        for (final batch in [true, false]) {
+          final detector = HandDetector(mode: mode, batchLandmarks: batch);
+          await detector.initialize();
+          final ByteData data =
+              await rootBundle.load('assets/samples/2-hands.png');
+          final mat = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+          try {
+            final hands = await detector.detectOnMat(mat);
+            final packed = await detector.detectOnMatPacked(mat);
+
+            expect(packed.length, hands.length);
+            expect(packed.hasLandmarks, mode == HandMode.boxesAndLandmarks);
+            expect(packed.imageWidth, mat.cols);
+            for (int i = 0; i < hands.length; i++) {
+              final hand = hands[i];
+              final view = packed[i];
+              expect(view.left, closeTo(hand.boundingBox.left, 1e-3));
+              expect(view.bottom, closeTo(hand.boundingBox.bottom, 1e-3));
+              expect(view.score, closeTo(hand.score, 1e-6));
+              expect(view.handedness, hand.handedness);
+              expect(view.rotation, closeTo(hand.rotation!, 1e-6));
+              for (final lm in hand.landmarks) {
+                expect(view.x(lm.type), closeTo(lm.x, 1e-2));
+                expect(view.y(lm.type), closeTo(lm.y, 1e-2));
+                expect(view.landmarkScore, closeTo(lm.visibility, 1e-6));
+              }
+            }
+          } finally {
+            mat.dispose();
+            await detector.dispose();
+          }
+        }
+      }
+    });
+
+    test('detectPacked() returns an empty frame for invalid bytes', () async {
+      final detector = HandDetector();
+      await detector.initialize();
+      try {
+        final packed = await detector.detectPacked(const <int>[1, 2, 3]);
+        expect(packed.isEmpty, true);
+        expect(packed.hasLandmarks, true);
+      } finally {
+        await detector.dispose();
+      }
+    });
+  });
+
+  group('HandDetector - detectOnYuv() method', () {
+    test('detectOnYuv() matches detectOnMat() on the same frame', () async {
+      final detector = HandDetector(landmarkModel: HandLandmarkModel.full);
+      await detector.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final decoded =
+          cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+      // I420 needs even dimensions.
+      final w = decoded.cols & ~1;
+      final h = decoded.rows & ~1;
+      final mat = cv.resize(decoded, (w, h));
+      final i420 = cv.cvtColor(mat, cv.COLOR_BGR2YUV_I420);
+
+      try {
+        final matResults = await detector.detectOnMat(mat);
+        final yuvResults = await detector.detectOnYuv(
+            YuvFrame.i420(Uint8List.fromList(i420.data), w, h));
+
+        expect(yuvResults.length, matResults.length);
+        for (int i = 0; i < yuvResults.length; i++) {
+          expect(yuvResults[i].imageWidth, w);
+          expect(yuvResults[i].imageHeight, h);
+          expect(yuvResults[i].landmarks.length,
+              matResults[i].landmarks.length);
+          expect(yuvResults[i].boundingBox.left,
+              closeTo(matResults[i].boundingBox.left, 8.0));
+          expect(yuvResults[i].boundingBox.top,
+              closeTo(matResults[i].boundingBox.top, 8.0));
+        }
+      } finally {
+        decoded.dispose();
+        mat.dispose();
+        i420.dispose();
+      }
+
+      await detector.dispose();
+    });
+
+    test('detectOnYuv() converts to BGR when palm tiling is on', () async {
+      // Tiled palm detection has no YUV kernel path and takes the OpenCV
+      // conversion instead, with the same results.
+      final detector = HandDetector(
+        landmarkModel: HandLandmarkModel.full,
+        palmTiling: const PalmTiling(columns: 2, rows: 1),
+      );
+      await detector.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final decoded =
+          cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+      final w = decoded.cols & ~1;
+      final h = decoded.rows & ~1;
+      final mat = cv.resize(decoded, (w, h));
+      final i420 = cv.cvtColor(mat, cv.COLOR_BGR2YUV_I420);
+      final bgr = cv.cvtColor(i420, cv.COLOR_YUV2BGR_I420);
+
+      try {
+        final matResults = await detector.detectOnMat(bgr);
+        final yuvResults = await detector.detectOnYuv(
+            YuvFrame.i420(Uint8List.fromList(i420.data), w, h));
+
+        expect(yuvResults.length, matResults.length);
+        for (int i = 0; i < yuvResults.length; i++) {
+          expect(yuvResults[i].boundingBox.left,
+              closeTo(matResults[i].boundingBox.left, 1e-6));
+          expect(yuvResults[i].boundingBox.top,
+              closeTo(matResults[i].boundingBox.top, 1e-6));
+        }
+      } finally {
+        decoded.dispose();
+        mat.dispose();
+        i420.dispose();
+        bgr.dispose();
+        await detector.dispose();
+      }
+    });
+
+    test('detectOnYuv() smooths landmarks with the native pipeline',
+        () async {
+      // Falls back to the Dart pipeline where libhand_pipeline is unavailable.
+      HandDetector create(LandmarkSmoothing? smoothing) => HandDetector(
+            landmarkModel: HandLandmarkModel.full,
+            useNativePipeline: true,
+            landmarkSmoothing: smoothing,
+          );
+      final plain = create(null);
+      // A near-frozen average: the second frame should stay on the first.
+      final smoothed =
+          create(const LandmarkSmoothing.ema(cutoff: 0.01, frameRate: 30));
+      await plain.initialize();
+      await smoothed.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final decoded =
+          cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+      final w = decoded.cols & ~1;
+      final h = decoded.rows & ~1;
+      final mat = cv.resize(decoded, (w, h));
+      // The same scene 20 px to the left.
+      final shifted = mat.region(cv.Rect(20, 0, w - 20, h)).clone();
+      final i420 = cv.cvtColor(shifted, cv.COLOR_BGR2YUV_I420);
+
+      try {
+        final first = await smoothed.detectOnMat(mat);
+        final frame = YuvFrame.i420(Uint8List.fromList(i420.data), w - 20, h);
+        final raw = await plain.detectOnYuv(frame);
+        final hands = await smoothed.detectOnYuv(frame);
+
+        expect(first, isNotEmpty);
+        expect(hands.length, first.length);
+        expect(raw.length, first.length);
+        for (int i = 0; i < hands.length; i++) {
+          final x = hands[i].landmarks[0].x;
+          expect(x, closeTo(first[i].landmarks[0].x, 4.0));
+          expect((x - raw[i].landmarks[0].x).abs(), greaterThan(10.0));
+        }
+      } finally {
+        decoded.dispose();
+        mat.dispose();
+        shifted.dispose();
+        i420.dispose();
+        await plain.dispose();
+        await smoothed.dispose();
+      }
+    });
+
+    test('detectOnYuv() rejects planes smaller than the frame', () async {
+      final detector = HandDetector(landmarkModel: HandLandmarkModel.full);
+      await detector.initialize();
+
+      final frame = YuvFrame(
+        width: 64,
+        height: 64,
+        y: Uint8List(64 * 64),
+        u: Uint8List(16),
+        v: Uint8List(16),
+        yRowStride: 64,
+        uvRowStride: 32,
+        uvPixelStride: 1,
+      );
+      expect(() => detector.detectOnYuv(frame), throwsArgumentError);
+
+      await detector.dispose();
+    });
+  });
+
+  group('HandDetector - trackHands', () {
+    test('tracked frames match palm detection on a still frame', () async {
+      final detector = HandDetector(landmarkModel: HandLandmarkModel.full);
+      await detector.initialize();
+      final tracker = HandDetector(
+        landmarkModel: HandLandmarkModel.full,
+        trackHands: true,
+      );
+      await tracker.initialize();
+      expect(tracker.trackHands, true);
+      expect(tracker.palmRefreshInterval, 30);
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final mat = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+
+      try {
+        final expected = await detector.detectOnMat(mat);
+        // Frame 0 runs palm detection; frames 1-2 reuse landmark crops.
+        for (int frame = 0; frame < 3; frame++) {
+          final hands = await tracker.detectOnMat(mat);
+          expect(hands.length, expected.length, reason: 'frame $frame');
+          for (int i = 0; i < hands.length; i++) {
+            expect(hands[i].landmarks.length, 21);
+            expect(hands[i].score, closeTo(expected[i].score, 1e-6));
+            final wrist = hands[i].getLandmark(HandLandmarkType.wrist)!;
+            final expectedWrist =
+                expected[i].getLandmark(HandLandmarkType.wrist)!;
+            expect(wrist.x, closeTo(expectedWrist.x, 0.05 * mat.cols));
+            expect(wrist.y, closeTo(expectedWrist.y, 0.05 * mat.rows));
+          }
+        }
+      } finally {
+        mat.dispose();
+      }
+
+      await detector.dispose();
+      await tracker.dispose();
+    });
+
+    test('resetTracking() and frame size changes restart palm detection',
+        () async {
+      final tracker = HandDetector(
+        landmarkModel: HandLandmarkModel.full,
+        trackHands: true,
+        palmRefreshInterval: 0,
+      );
+      await tracker.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final mat = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+      final half = cv.resize(mat, (mat.cols ~/ 2, mat.rows ~/ 2));
+
+      try {
+        final first = await tracker.detectOnMat(mat);
+        tracker.resetTracking();
+        expect((await tracker.detectOnMat(mat)).length, first.length);
+
+        final resized = await tracker.detectOnMat(half);
+        for (final hand in resized) {
+          expect(hand.imageWidth, half.cols);
+          for (final lm in hand.landmarks) {
+            expect(lm.x, inInclusiveRange(0, half.cols));
+            expect(lm.y, inInclusiveRange(0, half.rows));
+          }
+        }
+      } finally {
+        mat.dispose();
+        half.dispose();
+      }
+
+      await tracker.dispose();
+    });
+  });
+
+  group('HandDetector - reducedDecode', () {
+    test('reduced JPEG decode matches full decode', () async {
+      final detector = HandDetector();
+      await detector.initialize();
+      final reduced = HandDetector(reducedDecode: true);
+      await reduced.initialize();
+
+      // A large JPEG, so the palm stage runs on a reduced decode.
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final decoded = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+      final large = cv.resize(decoded, (decoded.cols * 4, decoded.rows * 4));
+      final (_, jpeg) = cv.imencode('.jpg', large);
+      try {
+        final expected = await detector.detect(jpeg);
+        final hands = await reduced.detect(jpeg);
+
+        expect(expected, isNotEmpty);
+        expect(hands.length, expected.length);
+        for (int i = 0; i < hands.length; i++) {
+          expect(hands[i].imageWidth, large.cols);
+          expect(hands[i].imageHeight, large.rows);
+          expect(hands[i].landmarks.length, 21);
+          expect(hands[i].boundingBox.left,
+              closeTo(expected[i].boundingBox.left, 0.03 * large.cols));
+          expect(hands[i].boundingBox.top,
+              closeTo(expected[i].boundingBox.top, 0.03 * large.rows));
+          final wrist = hands[i].getLandmark(HandLandmarkType.wrist)!;
+          final expectedWrist =
+              expected[i].getLandmark(HandLandmarkType.wrist)!;
+          expect(wrist.x, closeTo(expectedWrist.x, 0.03 * large.cols));
+          expect(wrist.y, closeTo(expectedWrist.y, 0.03 * large.rows));
+        }
+      } finally {
+        decoded.dispose();
+        large.dispose();
+        await detector.dispose();
+        await reduced.dispose();
+      }
+    });
+
+    test('detectPacked() uses the reduced decode like detect()', () async {
+      final reduced = HandDetector(reducedDecode: true);
+      await reduced.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final decoded = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+      final large = cv.resize(decoded, (decoded.cols * 4, decoded.rows * 4));
+      final (_, jpeg) = cv.imencode('.jpg', large);
+      try {
+        final expected = await reduced.detect(jpeg);
+        final packed = await reduced.detectPacked(jpeg);
+
+        expect(expected, isNotEmpty);
+        expect(packed.imageWidth, large.cols);
+        expect(packed.imageHeight, large.rows);
+        final hands = packed.toHands();
+        expect(hands.length, expected.length);
+        for (int i = 0; i < hands.length; i++) {
+          expect(hands[i].boundingBox.left,
+              closeTo(expected[i].boundingBox.left, 1e-2));
+          expect(hands[i].rotatedSize!,
+              closeTo(expected[i].rotatedSize!, 1e-2));
+          final wrist = hands[i].getLandmark(HandLandmarkType.wrist)!;
+          final expectedWrist =
+              expected[i].getLandmark(HandLandmarkType.wrist)!;
+          expect(wrist.x, closeTo(expectedWrist.x, 1e-2));
+          expect(wrist.y, closeTo(expectedWrist.y, 1e-2));
+        }
+      } finally {
+        decoded.dispose();
+        large.dispose();
+        await reduced.dispose();
+      }
+    });
+  });
+
+  group('HandDetector - landmarkSmoothing', () {
+    test('smoothed tracking stays on a still frame', () async {
+      final detector = HandDetector();
+      await detector.initialize();
+      final smoothed = HandDetector(
+        trackHands: true,
+        landmarkSmoothing: const LandmarkSmoothing(frameRate: 30),
+      );
+      await smoothed.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final mat = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+      try {
+        final expected = await detector.detectOnMat(mat);
+        for (int frame = 0; frame < 3; frame++) {
+          final hands = await smoothed.detectOnMat(mat);
+          expect(hands.length, expected.length, reason: 'frame $frame');
+          for (int i = 0; i < hands.length; i++) {
+            for (int j = 0; j < 21; j++) {
+              expect(hands[i].landmarks[j].x,
+                  closeTo(expected[i].landmarks[j].x, 0.05 * mat.cols));
+              expect(hands[i].landmarks[j].y,
+                  closeTo(expected[i].landmarks[j].y, 0.05 * mat.rows));
+            }
+          }
+        }
+      } finally {
+        mat.dispose();
+        await detector.dispose();
+        await smoothed.dispose();
+      }
+    });
+  });
+
+  group('HandDetector - detectStream()', () {
+    Future<(List<List<Hand>>, int)> runStream(
+      HandDetector detector,
+      cv.Mat image,
+      int frameCount,
+      FrameDropPolicy policy,
+    ) async {
+      int dropped = 0;
+      // All frames are pushed at once, faster than they can be processed.
+      final frames = Stream<cv.Mat>.fromIterable(
+          List.generate(frameCount, (_) => image.clone()));
+      final results = await detector
+          .detectStream(frames, policy: policy, onFrameDropped: (total) {
+        dropped = total;
+      }).toList();
+      return (results, dropped);
+    }
+
+    test('latestOnly drops frames under overload and keeps order', () async {
+      final detector = HandDetector(landmarkModel: HandLandmarkModel.full);
+      await detector.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final mat = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+
+      try {
+        final expected = await detector.detectOnMat(mat);
+        final (results, dropped) =
+            await runStream(detector, mat, 6, FrameDropPolicy.latestOnly);
+        expect(dropped, greaterThan(0));
+        expect(results.length + dropped, 6);
+        for (final hands in results) {
+          expect(hands.length, expected.length);
+        }
+      } finally {
+        mat.dispose();
+      }
+
+      await detector.dispose();
+    });
+
+    test('blockProducer processes every frame without drops', () async {
+      final detector = HandDetector(landmarkModel: HandLandmarkModel.full);
+      await detector.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final mat = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+
+      try {
+        final (results, dropped) =
+            await runStream(detector, mat, 4, FrameDropPolicy.blockProducer);
+        expect(dropped, 0);
+        expect(results.length, 4);
+      } finally {
+        mat.dispose();
+      }
+
+      await detector.dispose();
+    });
+
+    test('detectStream() forwards errors and rejects invalid queue sizes',
+        () async {
+      final detector = HandDetector();
+      expect(
+        () => detector.detectStream(const Stream<cv.Mat>.empty(),
+            maxQueuedFrames: 0),
+        throwsArgumentError,
+      );
+
+      final mat = cv.Mat.zeros(64, 64, cv.MatType.CV_8UC3);
+      // Not initialized: the frame fails with a StateError event.
+      await expectLater(
+        detector.detectStream(Stream<cv.Mat>.value(mat)),
+        emitsInOrder([emitsError(isA<StateError>()), emitsDone]),
+      );
+    });
+  });
+
   group('HandDetector - Different Model Variants', () {
     test('should work with lite model', () async {
       final detector = HandDetector(landmarkModel: HandLandmarkModel.full);
@@ -550,6 +1112,136 @@ void main() {
 
       await detector.dispose();
     });
+
+    test('useNativePipeline matches the Dart pipeline', () async {
+      final dartDetector = HandDetector(landmarkModel: HandLandmarkModel.full);
+      await dartDetector.initialize();
+
+      // Falls back to the Dart pipeline where libhand_pipeline is unavailable.
+      final nativeDetector = HandDetector(
+        landmarkModel: HandLandmarkModel.full,
+        useNativePipeline: true,
+      );
+      await nativeDetector.initialize();
+      expect(nativeDetector.useNativePipeline, true);
+      expect(nativeDetector.isInitialized, true);
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final Uint8List bytes = data.buffer.asUint8List();
+
+      final dartResults = await dartDetector.detect(bytes);
+      final nativeResults = await nativeDetector.detect(bytes);
+
+      expect(nativeResults.length, dartResults.length);
+      for (int i = 0; i < nativeResults.length; i++) {
+        expect(nativeResults[i].handedness, dartResults[i].handedness);
+        expect(nativeResults[i].landmarks.length,
+            dartResults[i].landmarks.length);
+        expect(nativeResults[i].boundingBox.left,
+            closeTo(dartResults[i].boundingBox.left, 2.0));
+      }
+
+      await dartDetector.dispose();
+      await nativeDetector.dispose();
+    });
+
+    test('palmTiling keeps hands found on a small frame and in a 4K frame',
+        () async {
+      final plain = HandDetector(landmarkModel: HandLandmarkModel.full);
+      final tiled = HandDetector(
+        landmarkModel: HandLandmarkModel.full,
+        palmTiling: const PalmTiling(columns: 3, rows: 2),
+      );
+      await plain.initialize();
+      await tiled.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final image = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+      // The same hand near the corner of a 3840x2160 frame.
+      final large = cv.copyMakeBorder(
+        image,
+        2160 - image.rows - 40,
+        40,
+        3840 - image.cols - 40,
+        40,
+        cv.BORDER_CONSTANT,
+        value: cv.Scalar.all(110),
+      );
+      try {
+        final expected = await plain.detectOnMat(image);
+        expect(await tiled.detectOnMat(image), hasLength(expected.length));
+        expect(
+          (await tiled.detectOnMat(large)).length,
+          greaterThanOrEqualTo((await plain.detectOnMat(large)).length),
+        );
+      } finally {
+        image.dispose();
+        large.dispose();
+        await plain.dispose();
+        await tiled.dispose();
+      }
+    });
+
+    test('collectStats records a stage breakdown of each call', () async {
+      final detector = HandDetector(
+        landmarkModel: HandLandmarkModel.full,
+        collectStats: true,
+      );
+      await detector.initialize();
+      try {
+        expect(detector.lastStats, isNull);
+        final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+        await detector.detect(data.buffer.asUint8List());
+        final stats = detector.lastStats!;
+        expect(stats.decode, greaterThan(Duration.zero));
+        expect(stats.palmInference, greaterThan(Duration.zero));
+        expect(stats.landmarkInference, hasLength(greaterThan(0)));
+        expect(stats.total, greaterThanOrEqualTo(stats.decode));
+        expect(stats.toMap().keys, contains('interpreterLockWait'));
+
+        final image = cv.imdecode(data.buffer.asUint8List(), cv.IMREAD_COLOR);
+        try {
+          await detector.detectOnMat(image);
+        } finally {
+          image.dispose();
+        }
+        expect(detector.lastStats, isNot(same(stats)));
+        expect(detector.lastStats!.decode, Duration.zero);
+      } finally {
+        await detector.dispose();
+      }
+      expect(detector.lastStats, isNull);
+    });
+  });
+
+  group('HandDetector - Shared models', () {
+    test('detectors sharing model weights give identical results', () async {
+      // On Linux both detectors and all pool entries reference one mapping
+      // of each model; elsewhere each interpreter loads its own copy.
+      final a = HandDetector(interpreterPoolSize: 2);
+      final b = HandDetector(interpreterPoolSize: 3);
+      await a.initialize();
+      await b.initialize();
+
+      final ByteData data = await rootBundle.load('assets/samples/hand1.jpg');
+      final Uint8List bytes = data.buffer.asUint8List();
+      final resultsA = await a.detect(bytes);
+
+      // Releasing one detector must not affect the other.
+      await a.dispose();
+      final resultsB = await b.detect(bytes);
+
+      expect(resultsB.length, resultsA.length);
+      for (int i = 0; i < resultsA.length; i++) {
+        expect(resultsB[i].score, closeTo(resultsA[i].score, 1e-6));
+        for (int j = 0; j < resultsA[i].landmarks.length; j++) {
+          expect(resultsB[i].landmarks[j].x,
+              closeTo(resultsA[i].landmarks[j].x, 1e-3));
+        }
+      }
+
+      await b.dispose();
+    });
   });
 
   group('HandDetector - Multiple Images', () {
@@ -0,0 +1,73 @@
+// Regenerates lib/src/palm_anchors.g.dart, the precomputed SSD anchor centers
+// of the bundled palm model. Run from the package root after changing the
+// palm model or its anchor options:
+//
+//   dart run tool/generate_palm_anchors.dart
+//
+// Mirrors PalmDetector.generateAnchors for the palm configuration (192 x 192
+// input, strides [8, 16, 16, 16], fixedAnchorSize) without importing Flutter.
+import 'dart:io';
+
+const int _inputSize = 192;
+const List<int> _strides = [8, 16, 16, 16];
+const int _maxLineLength = 80;
+
+void main() {
+  final xs = <double>[];
+  final ys = <double>[];
+  int layerId = 0;
+  while (layerId < _strides.length) {
+    // Consecutive layers with the same stride share one feature map, two
+    // anchors (aspect ratio 1 plus the interpolated scale) per layer.
+    int lastSameStrideLayer = layerId;
+    int anchorsPerCell = 0;
+    while (lastSameStrideLayer < _strides.length &&
+        _strides[lastSameStrideLayer] == _strides[layerId]) {
+      anchorsPerCell += 2;
+      lastSameStrideLayer++;
+    }
+    final grid = (_inputSize / _strides[layerId]).ceil();
+    for (int y = 0; y < grid; y++) {
+      for (int x = 0; x < grid; x++) {
+        for (int a = 0; a < anchorsPerCell; a++) {
+          xs.add((x + 0.5) / grid);
+          ys.add((y + 0.5) / grid);
+        }
+      }
+    }
+    layerId = lastSameStrideLayer;
+  }
+
+  final out = StringBuffer()
+    ..writeln('// GENERATED CODE - DO NOT MODIFY BY HAND.')
+    ..writeln('// Generated by tool/generate_palm_anchors.dart.')
+    ..writeln()
+    ..writeln('/// Input size the precomputed palm anchors were generated for.')
+    ..writeln('const int palmAnchorInputSize = $_inputSize;')
+    ..writeln()
+    ..writeln('/// Number of SSD anchors of the bundled palm model.')
+    ..writeln('const int palmAnchorCount = ${xs.length};')
+    ..writeln()
+    ..writeln('/// Anchor centers stored struct-of-arrays: all [palmAnchorCount]')
+    ..writeln('/// x centers followed by all y centers. Anchor sizes are fixed at')
+    ..writeln('/// 1 x 1.')
+    ..writeln('const List<double> palmAnchorCenters = <double>[');
+  _writeValues(out, [...xs, ...ys]);
+  out.writeln('];');
+
+  File('lib/src/palm_anchors.g.dart').writeAsStringSync(out.toString());
+}
+
+void _writeValues(StringBuffer out, List<double> values) {
+  var line = StringBuffer('  ');
+  for (final value in values) {
+    final item = '$value,';
+    if (line.length > 2 && line.length + 1 + item.length > _maxLineLength) {
+      out.writeln(line);
+      line = StringBuffer('  ');
+    }
+    if (line.length > 2) line.write(' ');
+    line.write(item);
+  }
+  if (line.length > 2) out.writeln(line);
+}